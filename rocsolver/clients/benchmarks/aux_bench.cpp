@@ -0,0 +1,550 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <boost/program_options.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "bench_output.h"
+#include "bench_timing.h"
+#include "flops.h"
+#include "rocsolver.hpp"
+#include "utility.h"
+// (after rocsolver.hpp)
+#include "rocblas_test_unique_ptr.hpp"
+
+/*
+ * Microbenchmarks of the auxiliaries (larfg, larf, larft, larfb, laswp, lacgv) with
+ * the shapes they are called with by a factorization. The calls made by geqrf, orgqr,
+ * ormqr or getrf on a matrix of the given size are enumerated (following the blocked
+ * algorithms of the library, with the given block sizes), and every distinct shape is
+ * timed in isolation. Every row reports the time of one call, the number of calls of
+ * that shape in the factorization, the number of kernels launched and rocBLAS functions
+ * called (from the phase profiler of the library, when it is available), and the
+ * effective bandwidth.
+ */
+
+namespace po = boost::program_options;
+
+// an auxiliary call. (The vectors of larfg/lacgv have size m; laswp interchanges k rows
+// of an m x n matrix.)
+struct aux_shape {
+  std::string routine;
+  char side;
+  rocblas_int m, n, k;
+
+  bool operator<(const aux_shape &s) const {
+    return std::tie(routine, side, m, n, k) < std::tie(s.routine, s.side, s.m, s.n, s.k);
+  }
+};
+
+// the calls of a factorization, with the number of times every shape is called
+class aux_workload {
+public:
+  // (in the order of their first call)
+  std::vector<std::pair<aux_shape, rocblas_int>> shapes;
+
+  void add(const std::string &routine, char side, rocblas_int m, rocblas_int n, rocblas_int k) {
+    if (m <= 0 || n <= 0 || k <= 0)
+      return;
+    aux_shape s = {routine, side, m, n, k};
+    auto it = index.find(s);
+    if (it == index.end()) {
+      index[s] = shapes.size();
+      shapes.push_back({s, 1});
+    } else
+      shapes[it->second].second++;
+  }
+
+private:
+  std::map<aux_shape, size_t> index;
+};
+
+/* ============================================================================================
+ */
+/*  calls of the factorizations (as in the templates of the library) */
+
+// geqr2 on an m x n block
+static void geqr2_calls(aux_workload &w, bool complex, rocblas_int m, rocblas_int n) {
+  for (rocblas_int j = 0; j < std::min(m, n); ++j) {
+    w.add("larfg", '-', m - j, 1, 1);
+    if (complex) {
+      w.add("lacgv", '-', 1, 1, 1);
+      w.add("lacgv", '-', 1, 1, 1);
+    }
+    w.add("larf", 'L', m - j, n - j - 1, 1);
+  }
+}
+
+static void geqrf_calls(aux_workload &w, bool complex, rocblas_int m, rocblas_int n, rocblas_int nb,
+                        rocblas_int nx) {
+  rocblas_int dim = std::min(m, n);
+  if (m <= nx || n <= nx) {
+    geqr2_calls(w, complex, m, n);
+    return;
+  }
+  rocblas_int j = 0;
+  while (j < dim - nx) {
+    rocblas_int jb = std::min(dim - j, nb);
+    geqr2_calls(w, complex, m - j, jb);
+    if (j + jb < n) {
+      w.add("larft", '-', m - j, 1, jb);
+      w.add("larfb", 'L', m - j, n - j - jb, jb);
+    }
+    j += nb;
+  }
+  if (j < dim)
+    geqr2_calls(w, complex, m - j, n - j);
+}
+
+// org2r on an m x n block with k reflectors
+static void org2r_calls(aux_workload &w, rocblas_int m, rocblas_int n, rocblas_int k) {
+  for (rocblas_int j = k - 1; j >= 0; --j)
+    w.add("larf", 'L', m - j, n - j - 1, 1);
+}
+
+static void orgqr_calls(aux_workload &w, rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int nb,
+                        rocblas_int nx) {
+  if (k <= nx) {
+    org2r_calls(w, m, n, k);
+    return;
+  }
+  rocblas_int j = ((k - nx - 1) / nb) * nb;
+  rocblas_int kk = std::min(k, j + nb);
+  if (kk < n)
+    org2r_calls(w, m - kk, n - kk, k - kk);
+  for (; j >= 0; j -= nb) {
+    if (j + nb < n) {
+      w.add("larft", '-', m - j, 1, nb);
+      w.add("larfb", 'L', m - j, n - j - nb, nb);
+    }
+    org2r_calls(w, m - j, nb, nb);
+  }
+}
+
+static void ormqr_calls(aux_workload &w, bool complex, char side, bool transpose, rocblas_int m,
+                        rocblas_int n, rocblas_int k, rocblas_int nb) {
+  bool left = (side == 'L');
+  rocblas_int order = left ? m : n;
+  if (k <= nb) {
+    // orm2r
+    if (complex && transpose)
+      w.add("lacgv", '-', k, 1, 1);
+    for (rocblas_int i = 0; i < k; ++i)
+      w.add("larf", side, left ? m - i : m, left ? n : n - i, 1);
+    if (complex && transpose)
+      w.add("lacgv", '-', k, 1, 1);
+    return;
+  }
+  for (rocblas_int i = 0; i < k; i += nb) {
+    rocblas_int kb = std::min(nb, k - i);
+    w.add("larft", '-', order - i, 1, kb);
+    w.add("larfb", side, left ? m - i : m, left ? n : n - i, kb);
+  }
+}
+
+// limits of getrf in the library (see rocsolver_get_tuning_parameter)
+struct getrf_limits {
+  rocblas_int small_size; // matrices factorized with a single kernel
+  size_t lds_size;        // bytes of the panels factorized in LDS
+};
+
+// row interchanges of getf2 on an m x n panel
+static void getf2_calls(aux_workload &w, size_t elem_size, const getrf_limits &lim, rocblas_int m,
+                        rocblas_int n) {
+  // (panels that fit in LDS are factorized with a single kernel)
+  if (elem_size * m * n <= lim.lds_size)
+    return;
+  for (rocblas_int j = 0; j < std::min(m, n); ++j)
+    w.add("laswp", '-', m, n, 1);
+}
+
+// row interchanges of the recursive panel factorization of an m x n panel
+static void rgetf2_calls(aux_workload &w, size_t elem_size, const getrf_limits &lim, rocblas_int m,
+                         rocblas_int n, rocblas_int cutoff) {
+  if (n <= cutoff) {
+    getf2_calls(w, elem_size, lim, m, n);
+    return;
+  }
+  rocblas_int n1 = n / 2;
+  rocblas_int n2 = n - n1;
+  rgetf2_calls(w, elem_size, lim, m, n1, cutoff);
+  w.add("laswp", '-', m, n2, n1);
+  rgetf2_calls(w, elem_size, lim, m - n1, n2, cutoff);
+  w.add("laswp", '-', m, n1, n2);
+}
+
+static void getrf_calls(aux_workload &w, size_t elem_size, const getrf_limits &lim, rocblas_int m,
+                        rocblas_int n, rocblas_int nb, rocblas_int cutoff) {
+  // (tiny matrices are factorized with a single kernel)
+  if (m <= lim.small_size && n <= lim.small_size)
+    return;
+  if (m < nb || n < nb) {
+    getf2_calls(w, elem_size, lim, m, n);
+    return;
+  }
+  rocblas_int dim = std::min(m, n);
+  for (rocblas_int j = 0; j < dim; j += nb) {
+    rocblas_int jb = std::min(dim - j, nb);
+    // (tall panels that do not fit in LDS are factorized recursively)
+    if (elem_size * (m - j) * jb > lim.lds_size)
+      rgetf2_calls(w, elem_size, lim, m - j, jb, cutoff);
+    w.add("laswp", '-', m, j, jb);
+    if (j + jb < n)
+      w.add("laswp", '-', m, n - j - jb, jb);
+  }
+}
+
+/* ============================================================================================
+ */
+/*  launch counts */
+
+// kernels launched and rocBLAS functions called by call(), from the phase counters of
+// the library. Returns false if the library was built without the profiler.
+template <typename F>
+static bool count_launches(F call, rocblas_int &kernels, rocblas_int &blas_calls) {
+  kernels = blas_calls = 0;
+  if (rocsolver_start_phase_counters() != rocblas_status_success)
+    return false;
+  call();
+  return rocsolver_stop_phase_counters(&kernels, &blas_calls) == rocblas_status_success;
+}
+
+/* ============================================================================================
+ */
+/*  benchmark */
+
+// (lacgv is only defined for complex precisions)
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+static void aux_lacgv(rocblas_handle handle, rocblas_int n, T *x) {
+  rocsolver_lacgv<T>(handle, n, x, 1);
+}
+
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+static void aux_lacgv(rocblas_handle, rocblas_int, T *) {}
+
+struct aux_options {
+  Arguments argus;
+  std::string from;
+  std::string routine;
+  char precision;
+  char side;
+  char trans;
+  rocblas_int m, n, k;
+  rocblas_int nb, nx, cutoff;
+};
+
+template <typename T>
+static int run_aux_bench(const aux_options &opt) {
+  using rocblas_test::device_free;
+  using rocblas_test::device_malloc;
+
+  rocblas_int m = opt.m, n = opt.n;
+  rocblas_int k = opt.k > 0 ? opt.k : std::min(m, n);
+  bool complex = is_complex<T>;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // the sizes not given are those the library uses for the factorization (with the tuning
+  // table of the handle)
+  rocblas_int size = (opt.from == "orgqr" || opt.from == "ormqr") ? k : std::min(m, n);
+  auto library_value = [&](const char *param, rocblas_int given) {
+    rocblas_int value = given;
+    if (value <= 0 && rocsolver_get_tuning_parameter(handle, param, opt.precision, size, 1,
+                                                     &value) != rocblas_status_success)
+      value = 0;
+    return value;
+  };
+  rocblas_int nb = library_value(opt.from == "getrf"   ? "getrf_blocksize"
+                                 : opt.from == "ormqr" ? "ormqr_blocksize"
+                                                       : "geqrf_blocksize",
+                                 opt.nb);
+  rocblas_int nx = library_value("geqrf_switchsize", opt.nx);
+  rocblas_int cutoff = library_value("getrf_rgetf2_cutoff", opt.cutoff);
+  getrf_limits lim = {library_value("getrf_small_maxsize", 0),
+                      size_t(library_value("getf2_panel_ldssize", 0))};
+  if (nb <= 0 || nx <= 0 || cutoff <= 0 || lim.small_size <= 0 || lim.lds_size == 0) {
+    std::cerr << "Cannot get the block sizes of the library" << std::endl;
+    return -1;
+  }
+
+  aux_workload w;
+  if (opt.from == "geqrf")
+    geqrf_calls(w, complex, m, n, nb, nx);
+  else if (opt.from == "orgqr")
+    orgqr_calls(w, m, n, k, nb, nx);
+  else if (opt.from == "ormqr")
+    ormqr_calls(w, complex, opt.side, opt.trans != 'N', m, n, k, nb);
+  else if (opt.from == "getrf")
+    getrf_calls(w, sizeof(T), lim, m, n, nb, cutoff);
+  else {
+    std::cerr << "Invalid value for --from" << std::endl;
+    return -1;
+  }
+
+  // every call works on the top-left corner of the same buffers
+  rocblas_int ld = std::max(m, n);
+  rocblas_int nbmax = std::max(nb, k);
+  size_t sizeA = size_t(ld) * ld, sizeV = size_t(ld) * nbmax, sizeT = size_t(nbmax) * nbmax;
+  std::vector<T> hA(sizeA), hV(sizeV), htau(ld);
+  std::vector<rocblas_int> hipiv(ld);
+  rocblas_init<T>(hA.data(), ld, ld, ld);
+  rocblas_init<T>(hV.data(), ld, nbmax, ld);
+  rocblas_init<T>(htau.data(), ld, 1, ld);
+  for (rocblas_int i = 0; i < ld; ++i)
+    hipiv[i] = i + 1 + rand() % (ld - i);
+
+  T *dA, *dV, *dT, *dtau;
+  rocblas_int *dipiv;
+  device_malloc(&dA, sizeof(T) * sizeA);
+  device_malloc(&dV, sizeof(T) * sizeV);
+  device_malloc(&dT, sizeof(T) * sizeT);
+  device_malloc(&dtau, sizeof(T) * ld);
+  device_malloc(&dipiv, sizeof(rocblas_int) * ld);
+  if (!dA || !dV || !dT || !dtau || !dipiv) {
+    std::cerr << "Cannot allocate the device buffers" << std::endl;
+    return -1;
+  }
+  CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * sizeA, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dV, hV.data(), sizeof(T) * sizeV, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dtau, htau.data(), sizeof(T) * ld, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dipiv, hipiv.data(), sizeof(rocblas_int) * ld, hipMemcpyHostToDevice));
+
+  // copy of the inputs overwritten by the calls (for cold-cache timing)
+  bench_inputs inputs(opt.argus);
+  inputs.add(dA, sizeof(T) * sizeA);
+  inputs.add(dtau, sizeof(T) * ld);
+
+  rocblas_operation trans = opt.trans == 'N'   ? rocblas_operation_none
+                            : opt.trans == 'T' ? rocblas_operation_transpose
+                                               : rocblas_operation_conjugate_transpose;
+
+  bench_set_context("from", opt.from, true);
+  std::map<std::string, double> totals;
+  double total = 0;
+
+  for (auto &e : w.shapes) {
+    const aux_shape &s = e.first;
+    if (!opt.routine.empty() && opt.routine != s.routine)
+      continue;
+    if (s.routine == "lacgv" && !complex)
+      continue;
+
+    rocblas_side side = s.side == 'R' ? rocblas_side_right : rocblas_side_left;
+    std::function<void()> call;
+    double bytes = 0;
+    if (s.routine == "larfg") {
+      call = [&] { rocsolver_larfg<T>(handle, s.m, dA, dA + 1, 1, dtau); };
+      bytes = larfg_bytes<T>(s.m);
+    } else if (s.routine == "larf") {
+      call = [&] { rocsolver_larf<T>(handle, side, s.m, s.n, dV, 1, dtau, dA, ld); };
+      bytes = larf_bytes<T>(s.side == 'L', s.m, s.n);
+    } else if (s.routine == "larft") {
+      call = [&] {
+        rocsolver_larft<T>(handle, rocblas_forward_direction, rocblas_column_wise, s.m, s.k, dV, ld,
+                           dtau, dT, nbmax);
+      };
+      bytes = larft_bytes<T>(s.m, s.k);
+    } else if (s.routine == "larfb") {
+      // (geqrf applies the reflectors transposed, orgqr not transposed)
+      rocblas_operation t = opt.from == "geqrf" ? rocblas_operation_conjugate_transpose
+                            : opt.from == "orgqr" ? rocblas_operation_none
+                                                  : trans;
+      call = [&, t] {
+        rocsolver_larfb<T>(handle, side, t, rocblas_forward_direction, rocblas_column_wise, s.m, s.n,
+                           s.k, dV, ld, dT, nbmax, dA, ld);
+      };
+      bytes = larfb_bytes<T>(s.side == 'L', s.m, s.n, s.k);
+    } else if (s.routine == "laswp") {
+      call = [&] { rocsolver_laswp<T>(handle, s.n, dA, ld, 1, s.k, dipiv, 1); };
+      bytes = laswp_bytes<T>(s.n, 1, s.k);
+    } else if (s.routine == "lacgv") {
+      call = [&] { aux_lacgv<T>(handle, s.m, dtau); };
+      bytes = lacgv_bytes<T>(s.m);
+    }
+
+    bench_timing t = bench_time(handle, opt.argus, call, &inputs);
+    rocblas_int kernels, blas_calls;
+    bool counted = count_launches(call, kernels, blas_calls);
+
+    bench_set_context("function", s.routine, true);
+    bench_row row;
+    row.add("side", s.side);
+    row.add("M", s.m);
+    row.add("N", s.n);
+    row.add("K", s.k);
+    row.add("calls", e.second);
+    t.add_to(row);
+    row.add("total_time(us)", t.mean * e.second);
+    if (counted) {
+      row.add("kernels", kernels);
+      row.add("rocblas_calls", blas_calls);
+    }
+    bench_add_bandwidth(row, opt.argus, bytes, t.mean);
+    row.print();
+
+    totals[s.routine] += t.mean * e.second;
+    total += t.mean * e.second;
+  }
+
+  // share of every auxiliary in the total time
+  for (auto &r : totals)
+    std::cerr << "# " << r.first << ": " << r.second << " us ("
+              << (total > 0 ? 100.0 * r.second / total : 0.0) << "%)" << std::endl;
+
+  device_free(dA);
+  device_free(dV);
+  device_free(dT);
+  device_free(dtau);
+  device_free(dipiv);
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  aux_options opt;
+  std::string output, output_file;
+  rocblas_int device_id;
+
+  po::options_description desc("rocsolver-aux-bench command line options");
+  desc.add_options()("help,h", "produces this help message")
+      // clang-format off
+        ("from",
+         po::value<std::string>(&opt.from)->default_value("geqrf"),
+         "Factorization whose calls to the auxiliaries are benchmarked: geqrf, orgqr, ormqr or getrf.")
+
+        ("routine",
+         po::value<std::string>(&opt.routine)->default_value(""),
+         "Only benchmark this auxiliary (larfg, larf, larft, larfb, laswp or lacgv).")
+
+        ("precision,r",
+         po::value<char>(&opt.precision)->default_value('s'),
+         "Options: s,d,c,z")
+
+        ("sizem,m",
+         po::value<rocblas_int>(&opt.m)->default_value(1024),
+         "Number of rows of the factorized matrix (of the matrix Q or C for orgqr and ormqr).")
+
+        ("sizen,n",
+         po::value<rocblas_int>(&opt.n)->default_value(1024),
+         "Number of columns of the factorized matrix (of the matrix Q or C for orgqr and ormqr).")
+
+        ("sizek,k",
+         po::value<rocblas_int>(&opt.k)->default_value(0),
+         "Number of Householder reflectors for orgqr and ormqr (min(m,n) by default).")
+
+        ("side",
+         po::value<char>(&opt.side)->default_value('L'),
+         "L = left, R = right. Side of ormqr.")
+
+        ("trans",
+         po::value<char>(&opt.trans)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose. Operation of ormqr.")
+
+        ("nb",
+         po::value<rocblas_int>(&opt.nb)->default_value(0),
+         "Block size of the factorization (by default, that of the library for the given sizes).")
+
+        ("nx",
+         po::value<rocblas_int>(&opt.nx)->default_value(0),
+         "Size below which geqrf and orgqr use the unblocked algorithm (by default, that of the library).")
+
+        ("cutoff",
+         po::value<rocblas_int>(&opt.cutoff)->default_value(0),
+         "Number of columns below which the recursive panel factorization of getrf stops "
+         "(by default, that of the library).")
+
+        ("iters,i",
+         po::value<rocblas_int>(&opt.argus.iters)->default_value(10),
+         "Iterations to run inside timing loop")
+
+        ("warmup",
+         po::value<rocblas_int>(&opt.argus.warmup)->default_value(2),
+         "Untimed calls before the timing loop")
+
+        ("cold",
+         po::bool_switch()->default_value(false),
+         "Cold-cache timing: the inputs are restored and the device L2 cache is flushed before every call.")
+
+        ("peak_bandwidth",
+         po::value<double>(&opt.argus.peak_bandwidth)->default_value(0),
+         "Peak memory bandwidth of the device in GB/s, to report the percentage achieved.")
+
+        ("output",
+         po::value<std::string>(&output)->default_value("csv"),
+         "Format of the results: csv or json.")
+
+        ("output_file",
+         po::value<std::string>(&output_file),
+         "Write the results to this file instead of stdout.")
+
+        ("device",
+         po::value<rocblas_int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs");
+  // clang-format on
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+  opt.argus.cold = vm["cold"].as<bool>();
+
+  if (query_device_property() <= device_id) {
+    std::cerr << "Error: invalid device ID" << std::endl;
+    return -1;
+  }
+  set_device(device_id);
+
+  if (output == "json")
+    bench_set_format(bench_format_json);
+  else if (output != "csv") {
+    std::cerr << "Invalid value for --output" << std::endl;
+    return -1;
+  }
+
+  std::ofstream file;
+  if (!output_file.empty()) {
+    file.open(output_file);
+    if (!file) {
+      std::cerr << "Cannot open " << output_file << std::endl;
+      return -1;
+    }
+    bench_set_stream(file);
+  }
+
+  hipDeviceProp_t props;
+  char version[256], commit[256];
+  CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device_id));
+  rocsolver_get_version_string(version, sizeof(version));
+  rocsolver_get_commit_string(commit, sizeof(commit));
+  bench_set_context("device", props.name, false);
+  bench_set_context("rocsolver_version", version, false);
+  bench_set_context("rocsolver_commit", commit, false);
+  bench_set_context("precision", std::string(1, opt.precision), true);
+
+  switch (opt.precision) {
+  case 's':
+    return run_aux_bench<float>(opt);
+  case 'd':
+    return run_aux_bench<double>(opt);
+  case 'c':
+    return run_aux_bench<rocblas_float_complex>(opt);
+  case 'z':
+    return run_aux_bench<rocblas_double_complex>(opt);
+  default:
+    std::cerr << "Invalid value for --precision" << std::endl;
+    return -1;
+  }
+}
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include <boost/program_options.hpp>
+#include <fstream>
 #include <iostream>
 #include <stdio.h>
 
@@ -18,6 +19,12 @@
 #include "testing_getrs.hpp"
 #include "testing_getrs_batched.hpp"
 #include "testing_getrs_strided_batched.hpp"
+#include "testing_gesv.hpp"
+#include "testing_gesv_batched.hpp"
+#include "testing_gesv_strided_batched.hpp"
+#include "testing_gesv_mixed.hpp"
+#include "testing_gesv_mixed_batched.hpp"
+#include "testing_gesv_mixed_strided_batched.hpp"
 #include "testing_potf2_potrf.hpp"
 #include "testing_potf2_potrf_batched.hpp"
 #include "testing_potf2_potrf_strided_batched.hpp"
@@ -34,207 +41,16 @@
 #include "testing_orgbr_ungbr.hpp"
 #include "testing_ormbr_unmbr.hpp"
 #include "utility.h"
+#include "bench_output.h"
+#include "bench_suite.h"
 
 namespace po = boost::program_options;
 
-int main(int argc, char *argv[]) 
+// runs the benchmark of function for a single point
+static int run_function(const std::string &function, char precision, const Arguments &argus)
 {
-  Arguments argus;
-  
-  //disable unit_check in client benchmark, it is only
-  // used in gtest unit test
-  argus.unit_check = 0; 
-
-  // enable timing check,otherwise no performance data collected
-  argus.timing = 1;
-
-  std::string function;
-  char precision;
-
-  rocblas_int device_id;
-  vector<rocblas_int> range = {-1, -1, -1};
-
-  po::options_description desc("rocsolver client command line options");
-  desc.add_options()("help,h", "produces this help message")
-      // clang-format off
-//        ("range",
-//         po::value<vector<rocblas_int>>(&range)->multitoken(),
-//         "Range matrix size testing: BLAS-3 benchmarking only. Accept three positive integers. "
-//         "Usage: "
-//         "--range start end step"
-//         ". e.g "
-//         "--range 100 1000 200"
-//         ". Diabled if not specified. If enabled, user specified m,n,k will be nullified")
-        
-        ("sizem,m",
-         po::value<rocblas_int>(&argus.M)->default_value(1024),
-         "Specific matrix size testing: the number of rows of a matrix.")
-        
-        ("sizen,n",
-         po::value<rocblas_int>(&argus.N)->default_value(1024),
-         "Specific matrix/vector/order size testing: the number of columns of a matrix,"
-         "or the order of a system or transformation.")
-
-        ("sizek,k",
-         po::value<rocblas_int>(&argus.K)->default_value(1024),
-         "Specific...  the number of columns in "
-         "A & C  and rows in B.")
-
-        ("k1",
-         po::value<rocblas_int>(&argus.k1)->default_value(1),
-         "First index for row interchange, used with laswp. ")
-        
-        ("k2",
-         po::value<rocblas_int>(&argus.k2)->default_value(2),
-         "Last index for row interchange, used with laswp. ")
-        
-        ("lda",
-         po::value<rocblas_int>(&argus.lda)->default_value(1024),
-         "Specific leading dimension of matrix A, is only applicable to "
-         "BLAS-2 & BLAS-3: the number of rows.")
-
-        ("ldb",
-         po::value<rocblas_int>(&argus.ldb)->default_value(1024),
-         "Specific leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3: the number "
-         "of rows.")
-
-        ("ldc",
-         po::value<rocblas_int>(&argus.ldc)->default_value(1024),
-         "Specific leading dimension of matrix C, is only applicable to BLAS-2 & "
-         "BLAS-3: the number of rows.")
-
-        ("ldv",
-         po::value<rocblas_int>(&argus.ldv)->default_value(1024),
-         "Specific leading dimension.")
-        
-        ("ldt",
-         po::value<rocblas_int>(&argus.ldt)->default_value(1024),
-         "Specific leading dimension.")
-
-        ("bsa",
-         po::value<rocblas_int>(&argus.bsa)->default_value(1024*1024),
-         "Specific stride of strided_batched matrix A, is only applicable to strided batched"
-         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
-
-        ("bsb",
-         po::value<rocblas_int>(&argus.bsb)->default_value(1024*1024),
-         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
-         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
-
-        ("bsc",
-         po::value<rocblas_int>(&argus.bsc)->default_value(1024*1024),
-         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
-         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
-
-        ("bsp",
-         po::value<rocblas_int>(&argus.bsp)->default_value(1024),
-         "Specific stride of batched pivots vector Ipiv, is only applicable to batched and strided_batched"
-         "factorizations: min(first dimension, second dimension).")
-
-        ("incx",
-         po::value<rocblas_int>(&argus.incx)->default_value(1),
-         "increment between values in x vector")
-
-        ("incy",
-         po::value<rocblas_int>(&argus.incy)->default_value(1),
-         "increment between values in y vector")
-
-        ("alpha", 
-          po::value<double>(&argus.alpha)->default_value(1.0), "specifies the scalar alpha")
-        
-        ("beta",
-         po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
-              
-        ("function,f",
-         po::value<std::string>(&function)->default_value("potf2"),
-         "LAPACK function to test. Options: potf2, getf2, getrf, getrs")
-        
-        ("precision,r", 
-         po::value<char>(&precision)->default_value('s'), "Options: h,s,d,c,z")
-        
-        ("transposeA",
-         po::value<char>(&argus.transA_option)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
-        
-        ("transposeB",
-         po::value<char>(&argus.transB_option)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
-        
-        ("transposeH",
-         po::value<char>(&argus.transH_option)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
-        
-        ("side",
-         po::value<char>(&argus.side_option)->default_value('L'),
-         "L = left, R = right. Only applicable to certain routines")
-        
-        ("uplo",
-         po::value<char>(&argus.uplo_option)->default_value('U'),
-         "U = upper, L = lower. Only applicable to certain routines") // xsymv xsyrk xsyr2k xtrsm
-                                                                     // xtrmm
-        ("diag",
-         po::value<char>(&argus.diag_option)->default_value('N'),
-         "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm
-                                                                                          // xtrmm
-        ("direct",
-         po::value<char>(&argus.direct_option)->default_value('F'),
-         "F = forward, B = backward. Only applicable to certain routines") // xtrsm
-        
-        ("storev",
-         po::value<char>(&argus.storev)->default_value('C'),
-         "C = column_wise, R = row_wise. Only applicable to certain routines") // xtrsm
-        
-        ("batch",
-         po::value<rocblas_int>(&argus.batch_count)->default_value(1),
-         "Number of matrices. Only applicable to batched routines") // xtrsm xtrmm xgemm
-
-        ("verify,v",
-         po::value<rocblas_int>(&argus.norm_check)->default_value(0),
-         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
-
-        ("iters,i",
-         po::value<rocblas_int>(&argus.iters)->default_value(10),
-         "Iterations to run inside timing loop")
-        
-        ("device",
-         po::value<rocblas_int>(&device_id)->default_value(0),
-         "Set default device to be used for subsequent program runs");
-  // clang-format on
-
-  po::variables_map vm;
-  po::store(po::parse_command_line(argc, argv, desc), vm);
-  po::notify(vm);
-
-  if (vm.count("help")) {
-    std::cout << desc << std::endl;
-    return 0;
-  }
-
-  if (precision != 'h' && precision != 's' && precision != 'd' &&
-      precision != 'c' && precision != 'z') {
-    std::cerr << "Invalid value for --precision" << std::endl;
-    return -1;
-  }
-
-  // Device Query
-  rocblas_int device_count = query_device_property();
-
-  if (device_count <= device_id) {
-    printf("Error: invalid device ID. There may not be such device ID. Will "
-           "exit \n");
-    return -1;
-  } else {
-    set_device(device_id);
-  }
-  /* ============================================================================================
-   */
- // if (argus.M < 0 || argus.N < 0 || argus.K < 0) {
- //   printf("Invalide matrix dimension\n");
- // }
-
-  //argus.start = range[0];
-  //argus.step = range[1];
-  //argus.end = range[2];
+  bench_set_context("function", function, true);
+  bench_set_context("precision", std::string(1, precision), true);
 
   if (function == "potf2") {
     if (precision == 's')
@@ -522,6 +338,60 @@ int main(int argc, char *argv[])
     else if (precision == 'z')
       testing_getrs_strided_batched<rocblas_double_complex,double>(argus);
   } 
+  else if (function == "gesv") {
+    if (precision == 's')
+      testing_gesv<float,float>(argus);
+    else if (precision == 'd')
+      testing_gesv<double,double>(argus);
+    if (precision == 'c')
+      testing_gesv<rocblas_float_complex,float>(argus);
+    else if (precision == 'z')
+      testing_gesv<rocblas_double_complex,double>(argus);
+  } 
+  else if (function == "gesv_batched") {
+    if (precision == 's')
+      testing_gesv_batched<float,float>(argus);
+    else if (precision == 'd')
+      testing_gesv_batched<double,double>(argus);
+    if (precision == 'c')
+      testing_gesv_batched<rocblas_float_complex,float>(argus);
+    else if (precision == 'z')
+      testing_gesv_batched<rocblas_double_complex,double>(argus);
+  } 
+  else if (function == "gesv_strided_batched") {
+    if (precision == 's')
+      testing_gesv_strided_batched<float,float>(argus);
+    else if (precision == 'd')
+      testing_gesv_strided_batched<double,double>(argus);
+    if (precision == 'c')
+      testing_gesv_strided_batched<rocblas_float_complex,float>(argus);
+    else if (precision == 'z')
+      testing_gesv_strided_batched<rocblas_double_complex,double>(argus);
+  } 
+  else if (function == "sgesv") {
+    if (precision == 'd')
+      testing_gesv_mixed<double,double>(argus);
+  } 
+  else if (function == "cgesv") {
+    if (precision == 'z')
+      testing_gesv_mixed<rocblas_double_complex,double>(argus);
+  } 
+  else if (function == "sgesv_batched") {
+    if (precision == 'd')
+      testing_gesv_mixed_batched<double,double>(argus);
+  } 
+  else if (function == "cgesv_batched") {
+    if (precision == 'z')
+      testing_gesv_mixed_batched<rocblas_double_complex,double>(argus);
+  } 
+  else if (function == "sgesv_strided_batched") {
+    if (precision == 'd')
+      testing_gesv_mixed_strided_batched<double,double>(argus);
+  } 
+  else if (function == "cgesv_strided_batched") {
+    if (precision == 'z')
+      testing_gesv_mixed_strided_batched<rocblas_double_complex,double>(argus);
+  } 
   else if (function == "larfg") {
     if (precision == 's')
       testing_larfg<float,float>(argus);
@@ -689,3 +559,446 @@ int main(int argc, char *argv[])
 
   return 0;
 }
+
+// expands a sweep "start end step" into its points
+static bool sweep_points(const vector<rocblas_int> &range, vector<rocblas_int> &points)
+{
+  if (range.size() != 3 || range[0] < 0 || range[1] < range[0] || range[2] <= 0)
+    return false;
+
+  for (rocblas_int p = range[0]; ; p += range[2]) {
+    points.push_back(p);
+    if (range[1] - p < range[2])
+      break;
+  }
+  return true;
+}
+
+// sets the sizes in dims (any of m, n and k) for a point of a size sweep. The leading
+// dimensions and strides follow the sizes, so that they are valid for every function:
+// they are the largest of the sizes in dims and the sizes given explicitly (in fixed).
+// (The sizes left at their default values are not used by every function, and would
+// otherwise make the matrices of a sweep of small sizes as large as the default.)
+static void set_sweep_size(Arguments &argus, const std::string &dims, const std::string &fixed,
+                           rocblas_int size)
+{
+  rocblas_int ld = std::max(1, size);
+  auto set = [&](char dim, rocblas_int &value) {
+    if (dims.find(dim) != std::string::npos)
+      value = size;
+    else if (fixed.find(dim) != std::string::npos)
+      ld = std::max(ld, value);
+  };
+  set('m', argus.M);
+  set('n', argus.N);
+  set('k', argus.K);
+
+  argus.lda = argus.ldb = argus.ldc = argus.ldv = argus.ldt = ld;
+  argus.bsa = argus.bsb = argus.bsc = ld * ld;
+  argus.bsp = ld;
+}
+
+// options of a benchmark: the function, its arguments and the sweeps of sizes and batch counts
+struct bench_options
+{
+  Arguments argus;
+  std::string function;
+  char precision;
+  vector<rocblas_int> range = {-1, -1, -1};
+  vector<rocblas_int> batch_range = {-1, -1, -1};
+  std::string sweep;
+  bool cold = false;
+
+  bench_options()
+  {
+    //disable unit_check in client benchmark, it is only
+    // used in gtest unit test
+    argus.unit_check = 0; 
+
+    // enable timing check,otherwise no performance data collected
+    argus.timing = 1;
+  }
+};
+
+// options of the client, that apply to all the benchmarks
+struct client_options
+{
+  std::string file;
+  std::string output;
+  std::string output_file;
+  rocblas_int device_id;
+};
+
+static void add_client_options(po::options_description &desc, client_options &opt)
+{
+  desc.add_options()("help,h", "produces this help message")
+      // clang-format off
+        ("file",
+         po::value<std::string>(&opt.file),
+         "Benchmark suite to run, in a single process: a YAML file with a list of entries "
+         "that give the options of every benchmark by their long names, e.g. "
+         "'- {function: getrf, precision: d, sizem: 1024, sizen: 1024}'. "
+         "The options given in the command line apply to the entries that do not set them.")
+
+        ("output",
+         po::value<std::string>(&opt.output)->default_value("csv"),
+         "Format of the results: csv (one table for all the points) or json (one object per line). "
+         "The JSON records also include the device and the version and commit of the library.")
+
+        ("output_file",
+         po::value<std::string>(&opt.output_file),
+         "Write the results to this file instead of stdout.")
+
+        ("device",
+         po::value<rocblas_int>(&opt.device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs");
+  // clang-format on
+}
+
+static void add_benchmark_options(po::options_description &desc, bench_options &opt)
+{
+  desc.add_options()
+      // clang-format off
+        ("range",
+         po::value<vector<rocblas_int>>(&opt.range)->multitoken(),
+         "Range of matrix sizes to test, in a single run. Accepts three non-negative integers. "
+         "Usage: "
+         "--range start end step"
+         ". e.g "
+         "--range 100 1000 200"
+         ". Disabled if not specified. If enabled, the sizes given in --sweep take every value "
+         "of the range, and the leading dimensions and strides are set accordingly.")
+
+        ("sweep",
+         po::value<std::string>(&opt.sweep)->default_value("mnk"),
+         "Sizes that follow --range: any combination of m, n and k. The other sizes keep "
+         "the values of --sizem, --sizen and --sizek.")
+
+        ("batch_range",
+         po::value<vector<rocblas_int>>(&opt.batch_range)->multitoken(),
+         "Range of batch counts to test, in a single run. "
+         "Usage: "
+         "--batch_range start end step"
+         ". Disabled if not specified. If enabled, --batch is ignored. It can be combined "
+         "with --range (every size is tested with every batch count).")
+
+        ("sizem,m",
+         po::value<rocblas_int>(&opt.argus.M)->default_value(1024),
+         "Specific matrix size testing: the number of rows of a matrix.")
+        
+        ("sizen,n",
+         po::value<rocblas_int>(&opt.argus.N)->default_value(1024),
+         "Specific matrix/vector/order size testing: the number of columns of a matrix,"
+         "or the order of a system or transformation.")
+
+        ("sizek,k",
+         po::value<rocblas_int>(&opt.argus.K)->default_value(1024),
+         "Specific...  the number of columns in "
+         "A & C  and rows in B.")
+
+        ("k1",
+         po::value<rocblas_int>(&opt.argus.k1)->default_value(1),
+         "First index for row interchange, used with laswp. ")
+        
+        ("k2",
+         po::value<rocblas_int>(&opt.argus.k2)->default_value(2),
+         "Last index for row interchange, used with laswp. ")
+        
+        ("lda",
+         po::value<rocblas_int>(&opt.argus.lda)->default_value(1024),
+         "Specific leading dimension of matrix A, is only applicable to "
+         "BLAS-2 & BLAS-3: the number of rows.")
+
+        ("ldb",
+         po::value<rocblas_int>(&opt.argus.ldb)->default_value(1024),
+         "Specific leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3: the number "
+         "of rows.")
+
+        ("ldc",
+         po::value<rocblas_int>(&opt.argus.ldc)->default_value(1024),
+         "Specific leading dimension of matrix C, is only applicable to BLAS-2 & "
+         "BLAS-3: the number of rows.")
+
+        ("ldv",
+         po::value<rocblas_int>(&opt.argus.ldv)->default_value(1024),
+         "Specific leading dimension.")
+        
+        ("ldt",
+         po::value<rocblas_int>(&opt.argus.ldt)->default_value(1024),
+         "Specific leading dimension.")
+
+        ("bsa",
+         po::value<rocblas_int>(&opt.argus.bsa)->default_value(1024*1024),
+         "Specific stride of strided_batched matrix A, is only applicable to strided batched"
+         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
+
+        ("bsb",
+         po::value<rocblas_int>(&opt.argus.bsb)->default_value(1024*1024),
+         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
+         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
+
+        ("bsc",
+         po::value<rocblas_int>(&opt.argus.bsc)->default_value(1024*1024),
+         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
+         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
+
+        ("bsp",
+         po::value<rocblas_int>(&opt.argus.bsp)->default_value(1024),
+         "Specific stride of batched pivots vector Ipiv, is only applicable to batched and strided_batched"
+         "factorizations: min(first dimension, second dimension).")
+
+        ("incx",
+         po::value<rocblas_int>(&opt.argus.incx)->default_value(1),
+         "increment between values in x vector")
+
+        ("incy",
+         po::value<rocblas_int>(&opt.argus.incy)->default_value(1),
+         "increment between values in y vector")
+
+        ("alpha", 
+          po::value<double>(&opt.argus.alpha)->default_value(1.0), "specifies the scalar alpha")
+        
+        ("beta",
+         po::value<double>(&opt.argus.beta)->default_value(0.0), "specifies the scalar beta")
+              
+        ("function,f",
+         po::value<std::string>(&opt.function)->default_value("potf2"),
+         "LAPACK function to test. Options: potf2, getf2, getrf, getrs")
+        
+        ("precision,r", 
+         po::value<char>(&opt.precision)->default_value('s'), "Options: h,s,d,c,z")
+        
+        ("transposeA",
+         po::value<char>(&opt.argus.transA_option)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+        
+        ("transposeB",
+         po::value<char>(&opt.argus.transB_option)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+        
+        ("transposeH",
+         po::value<char>(&opt.argus.transH_option)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+        
+        ("side",
+         po::value<char>(&opt.argus.side_option)->default_value('L'),
+         "L = left, R = right. Only applicable to certain routines")
+        
+        ("uplo",
+         po::value<char>(&opt.argus.uplo_option)->default_value('U'),
+         "U = upper, L = lower. Only applicable to certain routines") // xsymv xsyrk xsyr2k xtrsm
+                                                                     // xtrmm
+        ("diag",
+         po::value<char>(&opt.argus.diag_option)->default_value('N'),
+         "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm
+                                                                                          // xtrmm
+        ("direct",
+         po::value<char>(&opt.argus.direct_option)->default_value('F'),
+         "F = forward, B = backward. Only applicable to certain routines") // xtrsm
+        
+        ("storev",
+         po::value<char>(&opt.argus.storev)->default_value('C'),
+         "C = column_wise, R = row_wise. Only applicable to certain routines") // xtrsm
+        
+        ("batch",
+         po::value<rocblas_int>(&opt.argus.batch_count)->default_value(1),
+         "Number of matrices. Only applicable to batched routines") // xtrsm xtrmm xgemm
+
+        ("verify,v",
+         po::value<rocblas_int>(&opt.argus.norm_check)->default_value(0),
+         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
+
+        ("iters,i",
+         po::value<rocblas_int>(&opt.argus.iters)->default_value(10),
+         "Iterations to run inside timing loop. Every iteration is timed separately with hipEvents; "
+         "the mean, min, median, 95th percentile and standard deviation are reported, "
+         "together with the median host time of a call (host_time).")
+
+        ("warmup",
+         po::value<rocblas_int>(&opt.argus.warmup)->default_value(2),
+         "Untimed calls to run before the timing loop")
+
+        ("cold",
+         po::bool_switch(&opt.cold),
+         "Cold-cache timing: before every call, the inputs overwritten by the function are "
+         "restored to their original values and the device L2 cache is flushed (outside of "
+         "the timed region). By default, the calls run back to back on the same data.")
+
+        ("peak_gflops",
+         po::value<double>(&opt.argus.peak_gflops)->default_value(0),
+         "Peak GFLOP/s of the device in the tested precision. If given, the achieved "
+         "GFLOP/s are also reported as a percentage of the peak (%peak).")
+
+        ("peak_bandwidth",
+         po::value<double>(&opt.argus.peak_bandwidth)->default_value(0),
+         "Peak memory bandwidth of the device in GB/s. If given, the effective bandwidth of "
+         "the auxiliary functions is also reported as a percentage of the peak (%peak_bw).");
+  // clang-format on
+}
+
+// runs all the points of a benchmark
+static int run_benchmark(bench_options &opt, const po::variables_map &vm)
+{
+  Arguments &argus = opt.argus;
+  char precision = opt.precision;
+
+  if (precision != 'h' && precision != 's' && precision != 'd' &&
+      precision != 'c' && precision != 'z') {
+    std::cerr << "Invalid value for --precision" << std::endl;
+    return -1;
+  }
+
+  argus.cold = opt.cold ? 1 : 0;
+
+  // size and batch sweeps (a single point when they are not given)
+  vector<rocblas_int> sizes, batches;
+  if (vm.count("range") && !sweep_points(opt.range, sizes)) {
+    std::cerr << "Invalid value for --range" << std::endl;
+    return -1;
+  }
+  if (vm.count("batch_range") && !sweep_points(opt.batch_range, batches)) {
+    std::cerr << "Invalid value for --batch_range" << std::endl;
+    return -1;
+  }
+  if (sizes.empty())
+    sizes.push_back(-1);
+  if (batches.empty())
+    batches.push_back(argus.batch_count);
+
+  // sizes given explicitly
+  std::string fixed;
+  if (!vm["sizem"].defaulted())
+    fixed += 'm';
+  if (!vm["sizen"].defaulted())
+    fixed += 'n';
+  if (!vm["sizek"].defaulted())
+    fixed += 'k';
+
+  for (rocblas_int size : sizes) {
+    if (size >= 0)
+      set_sweep_size(argus, opt.sweep, fixed, size);
+    for (rocblas_int batch : batches) {
+      argus.batch_count = batch;
+      if (run_function(opt.function, precision, argus))
+        return -1;
+    }
+  }
+
+  return 0;
+}
+
+// runs the entries of a benchmark suite. The options of the command line (other than
+// those of the client) apply to the entries that do not set them.
+static int run_suite(const client_options &client, int argc, char *argv[])
+{
+  std::vector<bench_suite_entry> entries;
+  std::string error;
+  if (!bench_read_suite(client.file, entries, error)) {
+    std::cerr << error << std::endl;
+    return -1;
+  }
+
+  // all the entries share a handle, and the device buffers of an entry are
+  // reused by the following ones when the sizes allow
+  rocblas_test::reuse_resources(true);
+
+  int failed = 0;
+  for (size_t e = 0; e < entries.size(); ++e) {
+    bench_options opt;
+    client_options ignored;
+    po::options_description entry_desc, command_desc;
+    add_benchmark_options(entry_desc, opt);
+    add_client_options(command_desc, ignored);
+    command_desc.add(entry_desc);
+
+    po::variables_map vm;
+    try {
+      // (the values stored first take precedence)
+      po::store(po::command_line_parser(bench_suite_args(entries[e])).options(entry_desc).run(), vm);
+      po::store(po::parse_command_line(argc, argv, command_desc), vm);
+      po::notify(vm);
+    } catch (const po::error &err) {
+      std::cerr << client.file << ": entry " << e + 1 << ": " << err.what() << std::endl;
+      ++failed;
+      continue;
+    }
+
+    if (run_benchmark(opt, vm)) {
+      std::cerr << client.file << ": entry " << e + 1 << " failed" << std::endl;
+      ++failed;
+    }
+  }
+
+  rocblas_test::reuse_resources(false);
+
+  if (failed) {
+    std::cerr << failed << " of " << entries.size() << " entries failed" << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[]) 
+{
+  client_options client;
+  bench_options opt;
+
+  po::options_description desc("rocsolver client command line options");
+  add_client_options(desc, client);
+  add_benchmark_options(desc, opt);
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  // Device Query
+  rocblas_int device_count = query_device_property();
+
+  if (device_count <= client.device_id) {
+    printf("Error: invalid device ID. There may not be such device ID. Will "
+           "exit \n");
+    return -1;
+  } else {
+    set_device(client.device_id);
+  }
+  /* ============================================================================================
+   */
+  if (client.output == "json")
+    bench_set_format(bench_format_json);
+  else if (client.output != "csv") {
+    std::cerr << "Invalid value for --output" << std::endl;
+    return -1;
+  }
+
+  std::ofstream file;
+  if (!client.output_file.empty()) {
+    file.open(client.output_file);
+    if (!file) {
+      std::cerr << "Cannot open " << client.output_file << std::endl;
+      return -1;
+    }
+    bench_set_stream(file);
+  }
+
+  // device and library information (only written in the JSON records)
+  hipDeviceProp_t props;
+  char version[256], commit[256];
+  CHECK_HIP_ERROR(hipGetDeviceProperties(&props, client.device_id));
+  rocsolver_get_version_string(version, sizeof(version));
+  rocsolver_get_commit_string(commit, sizeof(commit));
+  bench_set_context("device", props.name, false);
+  bench_set_context("rocsolver_version", version, false);
+  bench_set_context("rocsolver_commit", commit, false);
+
+  // all the points (and all the entries of a suite) run in this process,
+  // so that the initialization of HIP and rocBLAS is paid only once
+  if (!client.file.empty())
+    return run_suite(client, argc, argv);
+
+  return run_benchmark(opt, vm);
+}
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright 2020 Advanced Micro Devices, Inc.
+# ########################################################################
+
+"""Compares two result files of rocsolver-bench (written with --output json)
+and flags the statistically significant slowdowns.
+
+Records are matched by function, precision and all their arguments (sizes,
+leading dimensions, strides, batch count, options). A record is flagged as
+slower (faster) when its mean GPU time changed by more than --threshold and a
+one-sided Welch's t-test on the timed iterations gives a p-value below --alpha.
+
+The exit status is 1 if any slowdown is found, so that the script can be used
+to gate library upgrades.
+
+Usage: rocsolver-bench-compare.py old.json new.json [--threshold 5] [--alpha 0.01]
+"""
+
+import argparse
+import json
+import math
+import sys
+
+# fields that are measurements or metadata, and do not identify a test case
+RESULT_FIELDS = {'iters', 'gpu_time(us)', 'gpu_min(us)', 'gpu_median(us)', 'gpu_p95(us)',
+                 'gpu_stddev(us)', 'host_time(us)', 'cpu_time(us)', 'gflops', '%peak',
+                 'GB/s', '%peak_bw', 'matrices/s', 'norm_error_host_ptr'}
+METADATA_FIELDS = {'device', 'rocsolver_version', 'rocsolver_commit'}
+
+
+def load(filename):
+    """returns the records of a file, indexed by test case (lines that are not JSON
+    records, such as the messages of the client, are skipped)"""
+    records = {}
+    metadata = set()
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith('{'):
+                continue
+            try:
+                r = json.loads(line)
+            except ValueError:
+                continue
+            key = tuple(sorted((k, str(v)) for k, v in r.items()
+                               if k not in RESULT_FIELDS and k not in METADATA_FIELDS))
+            records[key] = r
+            metadata.add(tuple(str(r.get(k, '')) for k in sorted(METADATA_FIELDS)))
+    return records, metadata
+
+
+def betacf(a, b, x):
+    """continued fraction of the incomplete beta function (modified Lentz's method)"""
+    tiny = 1e-300
+    c, d = 1.0, 1.0 - (a + b) * x / (a + 1.0)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        for num in (m * (b - m) * x / ((a + m2 - 1.0) * (a + m2)),
+                    -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0))):
+            d = 1.0 + num * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + num / c
+            c = c if abs(c) > tiny else tiny
+            h *= d * c
+        if abs(d * c - 1.0) < 1e-12:
+            break
+    return h
+
+
+def betainc(a, b, x):
+    """regularized incomplete beta function I_x(a, b)"""
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    lbeta = math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b)
+    front = math.exp(lbeta + a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * betacf(a, b, x) / a
+    return 1.0 - front * betacf(b, a, 1.0 - x) / b
+
+
+def t_sf(t, df):
+    """probability that a Student's t variable with df degrees of freedom exceeds t"""
+    p = 0.5 * betainc(0.5 * df, 0.5, df / (df + t * t))
+    return p if t > 0 else 1.0 - p
+
+
+def welch_pvalue(m1, s1, n1, m2, s2, n2):
+    """one-sided p-value of the hypothesis mean2 > mean1"""
+    v1, v2 = s1 * s1 / n1, s2 * s2 / n2
+    if v1 + v2 == 0.0:
+        return 0.0 if m2 > m1 else 1.0
+    t = (m2 - m1) / math.sqrt(v1 + v2)
+
+    # Welch-Satterthwaite degrees of freedom
+    den = 0.0
+    if n1 > 1:
+        den += v1 * v1 / (n1 - 1)
+    if n2 > 1:
+        den += v2 * v2 / (n2 - 1)
+    df = (v1 + v2) ** 2 / den if den > 0.0 else 1.0
+    return t_sf(t, df)
+
+
+def describe(key):
+    return ' '.join('%s=%s' % kv for kv in key)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compares two rocsolver-bench JSON result files.')
+    parser.add_argument('old', help='reference results')
+    parser.add_argument('new', help='results to compare with the reference')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='minimum change of the mean time to report, in percent (default: 5)')
+    parser.add_argument('--alpha', type=float, default=0.01,
+                        help='significance level of the t-test (default: 0.01)')
+    parser.add_argument('--all', action='store_true', help='also print the unchanged records')
+    args = parser.parse_args()
+
+    old, old_meta = load(args.old)
+    new, new_meta = load(args.new)
+    if old_meta != new_meta:
+        print('note: the files come from different devices or library builds:')
+        print('  old: %s' % sorted(old_meta))
+        print('  new: %s' % sorted(new_meta))
+
+    slower = faster = 0
+    for key in sorted(set(old) & set(new)):
+        o, n = old[key], new[key]
+        m1, m2 = o.get('gpu_time(us)'), n.get('gpu_time(us)')
+        if not m1 or not m2:
+            continue
+        s1, s2 = o.get('gpu_stddev(us)') or 0.0, n.get('gpu_stddev(us)') or 0.0
+        n1, n2 = max(1, o.get('iters', 1)), max(1, n.get('iters', 1))
+
+        change = 100.0 * (m2 - m1) / m1
+        if change > 0:
+            p = welch_pvalue(m1, s1, n1, m2, s2, n2)
+        else:
+            p = welch_pvalue(m2, s2, n2, m1, s1, n1)
+
+        status = ''
+        if abs(change) > args.threshold and p < args.alpha:
+            status = 'SLOWER' if change > 0 else 'faster'
+            slower += change > 0
+            faster += change < 0
+        if status or args.all:
+            print('%-6s %+7.1f%%  %10.2f -> %10.2f us  (p = %.2g)  %s'
+                  % (status, change, m1, m2, p, describe(key)))
+
+    only_old = set(old) - set(new)
+    only_new = set(new) - set(old)
+    for key in sorted(only_old):
+        print('only in %s: %s' % (args.old, describe(key)))
+    for key in sorted(only_new):
+        print('only in %s: %s' % (args.new, describe(key)))
+
+    print('%d records compared: %d slower, %d faster'
+          % (len(set(old) & set(new)), slower, faster))
+    return 1 if slower else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "bench_output.h"
+#include <iostream>
+
+static bench_format current_format = bench_format_csv;
+static std::ostream *out = &std::cout;
+static std::string last_header;
+
+// fields added to every row
+struct context_field {
+  std::string name;
+  std::string value;
+  bool csv;
+};
+static std::vector<context_field> context;
+
+void bench_set_format(bench_format format) {
+  current_format = format;
+  last_header.clear();
+}
+
+void bench_set_stream(std::ostream &stream) {
+  out = &stream;
+  last_header.clear();
+}
+
+void bench_set_context(const std::string &name, const std::string &value, bool csv) {
+  for (auto &f : context) {
+    if (f.name == name) {
+      f.value = value;
+      f.csv = csv;
+      return;
+    }
+  }
+  context.push_back({name, value, csv});
+}
+
+static std::string json_escape(const std::string &s) {
+  std::string r;
+  for (char c : s) {
+    if (c == '"' || c == '\\')
+      r += '\\';
+    r += c;
+  }
+  return r;
+}
+
+void bench_row::print() const {
+  if (current_format == bench_format_json) {
+    *out << "{";
+    // (the fields that are also in the CSV rows go first)
+    bool first = true;
+    for (int csv = 1; csv >= 0; --csv) {
+      for (auto &f : context) {
+        if (f.csv != bool(csv))
+          continue;
+        *out << (first ? "" : ", ") << "\"" << json_escape(f.name) << "\": \"" << json_escape(f.value) << "\"";
+        first = false;
+      }
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      *out << (first ? "" : ", ") << "\"" << json_escape(columns[i].first) << "\": ";
+      first = false;
+      const std::string &v = columns[i].second;
+      if (quoted[i])
+        *out << "\"" << json_escape(v) << "\"";
+      else if (v.find_first_of("ni") != std::string::npos) // (inf and nan are not valid JSON)
+        *out << "null";
+      else
+        *out << v;
+    }
+    *out << "}" << std::endl;
+    return;
+  }
+
+  std::string header, row;
+  for (auto &f : context) {
+    if (f.csv) {
+      header += (header.empty() ? "" : ",") + f.name;
+      row += (row.empty() ? "" : ",") + f.value;
+    }
+  }
+  for (size_t i = 0; i < columns.size(); ++i) {
+    header += (header.empty() ? "" : ",") + columns[i].first;
+    row += (row.empty() ? "" : ",") + columns[i].second;
+  }
+
+  if (header != last_header) {
+    *out << header << std::endl;
+    last_header = header;
+  }
+  *out << row << std::endl;
+}
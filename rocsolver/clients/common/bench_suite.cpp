@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "bench_suite.h"
+#include <fstream>
+
+static std::string trim(const std::string &s) {
+  size_t b = s.find_first_not_of(" \t\r");
+  if (b == std::string::npos)
+    return "";
+  size_t e = s.find_last_not_of(" \t\r");
+  return s.substr(b, e - b + 1);
+}
+
+static std::string unquote(const std::string &s) {
+  if (s.size() >= 2 && (s[0] == '"' || s[0] == '\'') && s.back() == s[0])
+    return s.substr(1, s.size() - 2);
+  return s;
+}
+
+// removes a comment (a # at the beginning of the line or after a blank)
+static std::string strip_comment(const std::string &line) {
+  char quote = 0;
+  for (size_t i = 0; i < line.size(); ++i) {
+    char c = line[i];
+    if (quote)
+      quote = c == quote ? 0 : quote;
+    else if (c == '"' || c == '\'')
+      quote = c;
+    else if (c == '#' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t'))
+      return line.substr(0, i);
+  }
+  return line;
+}
+
+// splits s at the commas that are not inside brackets or quotes
+static std::vector<std::string> split(const std::string &s) {
+  std::vector<std::string> parts;
+  std::string part;
+  int depth = 0;
+  char quote = 0;
+  for (char c : s) {
+    if (quote)
+      quote = c == quote ? 0 : quote;
+    else if (c == '"' || c == '\'')
+      quote = c;
+    else if (c == '[' || c == '{')
+      ++depth;
+    else if (c == ']' || c == '}')
+      --depth;
+    else if (c == ',' && depth == 0) {
+      parts.push_back(trim(part));
+      part.clear();
+      continue;
+    }
+    part += c;
+  }
+  if (!trim(part).empty())
+    parts.push_back(trim(part));
+  return parts;
+}
+
+// parses "key: value" (the value may be a list in brackets) and adds it to entry
+static bool add_pair(const std::string &text, bench_suite_entry &entry, std::string &error) {
+  size_t colon = text.find(':');
+  if (colon == std::string::npos) {
+    error = "expected 'option: value'";
+    return false;
+  }
+  std::string key = trim(text.substr(0, colon));
+  std::string value = trim(text.substr(colon + 1));
+  if (key.empty()) {
+    error = "missing option name";
+    return false;
+  }
+
+  std::vector<std::string> values;
+  if (!value.empty() && value[0] == '[') {
+    if (value.back() != ']') {
+      error = "unterminated list";
+      return false;
+    }
+    for (auto &v : split(value.substr(1, value.size() - 2)))
+      values.push_back(unquote(v));
+  } else
+    values.push_back(unquote(value));
+
+  entry.emplace_back(key, values);
+  return true;
+}
+
+bool bench_read_suite(const std::string &filename, std::vector<bench_suite_entry> &entries,
+                      std::string &error) {
+  std::ifstream file(filename);
+  if (!file) {
+    error = "cannot open " + filename;
+    return false;
+  }
+
+  std::string line;
+  int line_number = 0;
+  bool in_entry = false; // (block style entries continue in the following lines)
+
+  while (std::getline(file, line)) {
+    ++line_number;
+    std::string text = trim(strip_comment(line));
+    if (text.empty() || text == "---" || text == "...")
+      continue;
+
+    std::string message;
+    bool ok = true;
+    if (text[0] == '-' && (text.size() == 1 || text[1] == ' ')) {
+      // a new entry
+      entries.emplace_back();
+      text = trim(text.substr(1));
+      in_entry = true;
+      if (text.empty())
+        continue;
+      if (text[0] == '{') {
+        if (text.back() != '}') {
+          message = "unterminated mapping";
+          ok = false;
+        } else {
+          for (auto &pair : split(text.substr(1, text.size() - 2)))
+            ok = ok && add_pair(pair, entries.back(), message);
+        }
+        in_entry = false;
+      } else
+        ok = add_pair(text, entries.back(), message);
+    } else if (in_entry && (line[0] == ' ' || line[0] == '\t'))
+      ok = add_pair(text, entries.back(), message);
+    else {
+      message = "expected an entry ('- option: value' or '- {option: value, ...}')";
+      ok = false;
+    }
+
+    if (!ok) {
+      error = filename + ":" + std::to_string(line_number) + ": " + message;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::vector<std::string> bench_suite_args(const bench_suite_entry &entry) {
+  std::vector<std::string> args;
+  for (auto &option : entry) {
+    const std::vector<std::string> &values = option.second;
+    // (switches are given as true or false)
+    if (values.size() == 1 && values[0] == "false")
+      continue;
+    args.push_back("--" + option.first);
+    if (values.size() == 1 && values[0] == "true")
+      continue;
+    for (auto &v : values)
+      args.push_back(v);
+  }
+  return args;
+}
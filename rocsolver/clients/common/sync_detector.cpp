@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "sync_detector.h"
+#include <hip/hip_runtime.h>
+#include <sstream>
+
+#ifdef __HIP_PLATFORM_HCC__
+
+#include <cstring>
+#include <dlfcn.h>
+
+// (the counts are kept per thread, so that only the calls of the tested thread are seen)
+static thread_local bool counting = false;
+static thread_local sync_counts rocsolver_counts;
+static thread_local sync_counts other_counts;
+
+// returns true if the code at address belongs to the rocSOLVER library
+static bool is_rocsolver_code(void *address) {
+  Dl_info info;
+  return dladdr(address, &info) && info.dli_fname &&
+         strstr(info.dli_fname, "librocsolver");
+}
+
+// returns the definition of a HIP function in the HIP runtime
+template <typename F> static F hip_function(const char *name) {
+  return (F)dlsym(RTLD_NEXT, name);
+}
+
+// (a macro, as the return address must be taken in the intercepted function itself)
+#define COUNT_SYNC(kind)                                                       \
+  if (counting) {                                                              \
+    if (is_rocsolver_code(__builtin_return_address(0)))                        \
+      ++rocsolver_counts.kind;                                                 \
+    else                                                                       \
+      ++other_counts.kind;                                                     \
+  }
+
+hipError_t hipMalloc(void **ptr, size_t size) {
+  COUNT_SYNC(malloc);
+  static auto next = hip_function<hipError_t (*)(void **, size_t)>("hipMalloc");
+  return next(ptr, size);
+}
+
+hipError_t hipFree(void *ptr) {
+  COUNT_SYNC(free);
+  static auto next = hip_function<hipError_t (*)(void *)>("hipFree");
+  return next(ptr);
+}
+
+hipError_t hipMemcpy(void *dst, const void *src, size_t size,
+                     hipMemcpyKind kind) {
+  COUNT_SYNC(memcpy);
+  static auto next =
+      hip_function<hipError_t (*)(void *, const void *, size_t, hipMemcpyKind)>(
+          "hipMemcpy");
+  return next(dst, src, size, kind);
+}
+
+hipError_t hipMemcpyAsync(void *dst, const void *src, size_t size,
+                          hipMemcpyKind kind, hipStream_t stream) {
+  // (a copy from or to pageable host memory waits for the device)
+  if (kind != hipMemcpyDeviceToDevice) {
+    COUNT_SYNC(memcpy);
+  }
+  static auto next = hip_function<hipError_t (*)(
+      void *, const void *, size_t, hipMemcpyKind, hipStream_t)>("hipMemcpyAsync");
+  return next(dst, src, size, kind, stream);
+}
+
+hipError_t hipMemset(void *dst, int value, size_t size) {
+  COUNT_SYNC(memset);
+  static auto next = hip_function<hipError_t (*)(void *, int, size_t)>("hipMemset");
+  return next(dst, value, size);
+}
+
+hipError_t hipDeviceSynchronize(void) {
+  COUNT_SYNC(synchronize);
+  static auto next = hip_function<hipError_t (*)(void)>("hipDeviceSynchronize");
+  return next();
+}
+
+hipError_t hipStreamSynchronize(hipStream_t stream) {
+  COUNT_SYNC(synchronize);
+  static auto next =
+      hip_function<hipError_t (*)(hipStream_t)>("hipStreamSynchronize");
+  return next(stream);
+}
+
+hipError_t hipEventSynchronize(hipEvent_t event) {
+  COUNT_SYNC(synchronize);
+  static auto next =
+      hip_function<hipError_t (*)(hipEvent_t)>("hipEventSynchronize");
+  return next(event);
+}
+
+bool sync_detector_available() { return true; }
+
+void sync_detector_start() {
+  rocsolver_counts = sync_counts();
+  other_counts = sync_counts();
+  counting = true;
+}
+
+sync_counts sync_detector_stop(sync_counts *others) {
+  counting = false;
+  if (others)
+    *others = other_counts;
+  return rocsolver_counts;
+}
+
+#else
+
+// (on the CUDA platform the HIP functions are inline wrappers and cannot be intercepted)
+bool sync_detector_available() { return false; }
+
+void sync_detector_start() {}
+
+sync_counts sync_detector_stop(sync_counts *others) {
+  if (others)
+    *others = sync_counts();
+  return sync_counts();
+}
+
+#endif
+
+std::string sync_counts_string(const sync_counts &counts) {
+  std::ostringstream s;
+  auto add = [&](const char *name, int n) {
+    if (n)
+      s << (s.tellp() > 0 ? ", " : "") << name << ": " << n;
+  };
+  add("hipMalloc", counts.malloc);
+  add("hipFree", counts.free);
+  add("hipMemcpy", counts.memcpy);
+  add("hipMemset", counts.memset);
+  add("synchronize", counts.synchronize);
+  return s.str();
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, vector<int>> gesv_tuple;
+
+// vector of vector, each vector is a {N, lda, ldb};
+// add/delete as a group
+// (the systems of at most 32 equations are solved by a single kernel)
+const vector<vector<int>> matrix_sizeA_range = {
+    {-1, 1, 1}, {0, 1, 1}, {10, 2, 10}, {10, 10, 2}, {6, 6, 6}, {20, 20, 20}, {24, 30, 24},
+    {32, 32, 40}, {33, 33, 33}, {50, 60, 60}
+};
+
+// vector of vector, each vector is a {nrhs};
+const vector<vector<int>> matrix_sizeB_range = {
+    {-1}, {0}, {1}, {10}, {30},
+};
+
+const vector<vector<int>> large_matrix_sizeA_range = {
+    {70, 70, 100}, {192, 192, 192}, {600, 700, 645}, {1000, 1000, 1000}
+};
+
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100}, {150}, {524},
+};
+
+
+Arguments setup_gesv_arguments(gesv_tuple tup) {
+
+  vector<int> matrix_sizeA = std::get<0>(tup);
+  vector<int> matrix_sizeB = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_sizeA[0];
+  arg.N = matrix_sizeB[0];
+  arg.lda = matrix_sizeA[1];
+  arg.ldb = matrix_sizeA[2];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class LUsolver_gesv : public ::TestWithParam<gesv_tuple> {
+protected:
+  LUsolver_gesv() {}
+  virtual ~LUsolver_gesv() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUsolver_gesv, gesv_float) {
+  Arguments arg = setup_gesv_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<float,float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(LUsolver_gesv, gesv_double) {
+  Arguments arg = setup_gesv_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<double,double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(LUsolver_gesv, gesv_float_complex) {
+  Arguments arg = setup_gesv_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_float_complex,float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(LUsolver_gesv, gesv_double_complex) {
+  Arguments arg = setup_gesv_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_double_complex,double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// This function mainly test the scope of matrix_size.
+INSTANTIATE_TEST_CASE_P(daily_lapack, LUsolver_gesv,
+                        Combine(ValuesIn(large_matrix_sizeA_range),
+                                ValuesIn(large_matrix_sizeB_range)));
+
+// THis function mainly test the scope of uplo_range, the scope of
+// matrix_size_range is small
+INSTANTIATE_TEST_CASE_P(checkin_lapack, LUsolver_gesv,
+                        Combine(ValuesIn(matrix_sizeA_range),
+                                ValuesIn(matrix_sizeB_range)));
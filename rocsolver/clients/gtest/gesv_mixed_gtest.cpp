@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_mixed.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, vector<int>> gesvm_tuple;
+
+// vector of vector, each vector is a {N, lda, ldb, ldx};
+// add/delete as a group
+const vector<vector<int>> matrix_sizeA_range = {
+    {-1, 1, 1, 1}, {0, 1, 1, 1}, {10, 2, 10, 10}, {10, 10, 2, 10}, {10, 10, 10, 2}, 
+    {20, 20, 20, 20}, {30, 50, 30, 40}, {50, 60, 60, 50}
+};
+
+// vector of vector, each vector is a {nrhs, fallback};
+// if fallback != 0 the system is solved in double precision with iter = fallback
+const vector<vector<int>> matrix_sizeB_range = {
+    {-1, 0}, {0, 0}, {10, 0}, {20, -2}, {30, -3}, {25, -31},
+};
+
+const vector<vector<int>> large_matrix_sizeA_range = {
+    {70, 70, 100, 70}, {192, 192, 192, 192}, {600, 700, 645, 600}, {1000, 1000, 1000, 1000}
+};
+
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100, 0}, {150, -2}, {200, -3}, {250, -31}, {524, 0},
+};
+
+
+Arguments setup_gesvm_arguments(gesvm_tuple tup) {
+
+  vector<int> matrix_sizeA = std::get<0>(tup);
+  vector<int> matrix_sizeB = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_sizeA[0];
+  arg.N = matrix_sizeB[0];
+  arg.lda = matrix_sizeA[1];
+  arg.ldb = matrix_sizeA[2];
+  arg.ldc = matrix_sizeA[3];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class MixedSolver : public ::TestWithParam<gesvm_tuple> {
+protected:
+  MixedSolver() {}
+  virtual ~MixedSolver() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(MixedSolver, gesv_mixed_double) {
+  Arguments arg = setup_gesvm_arguments(GetParam());
+  rocblas_int fallback = std::get<1>(GetParam())[1];
+
+  rocblas_status status = testing_gesv_mixed<double,double>(arg, fallback);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M || arg.ldc < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(MixedSolver, gesv_mixed_double_complex) {
+  Arguments arg = setup_gesvm_arguments(GetParam());
+  rocblas_int fallback = std::get<1>(GetParam())[1];
+
+  rocblas_status status = testing_gesv_mixed<rocblas_double_complex,double>(arg, fallback);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M || arg.ldc < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// This function mainly test the scope of matrix_size.
+INSTANTIATE_TEST_CASE_P(daily_lapack, MixedSolver,
+                        Combine(ValuesIn(large_matrix_sizeA_range),
+                                ValuesIn(large_matrix_sizeB_range)));
+
+// THis function mainly test the scope of uplo_range, the scope of
+// matrix_size_range is small
+INSTANTIATE_TEST_CASE_P(checkin_lapack, MixedSolver,
+                        Combine(ValuesIn(matrix_sizeA_range),
+                                ValuesIn(matrix_sizeB_range)));
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_mixed_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, vector<int>> gesvmSB_tuple;
+
+// **** THIS FUNCTION ONLY TESTS NORMNAL USE CASE
+//      I.E. WHEN STRIDEA >= LDA*N, STRIDEB >= LDB*NRHS,
+//      STRIDEX >= LDX*NRHS AND STRIDEP >= N ****
+
+// vector of vector, each vector is a {N, lda, ldb, ldx};
+// add/delete as a group
+const vector<vector<int>> matrix_sizeA_range = {
+    {-1, 1, 1, 1}, {0, 1, 1, 1}, {10, 2, 10, 10}, {10, 10, 2, 10}, {10, 10, 10, 2}, 
+    {20, 20, 20, 20}, {30, 50, 30, 40}, {50, 60, 60, 50}
+};
+
+// vector of vector, each vector is a {nrhs, std, fallback};
+// if std = 0 strides are the minimum
+// if std = 1 strides are larger
+// if fallback != 0 the first system is solved in double precision with iter = fallback
+const vector<vector<int>> matrix_sizeB_range = {
+    {-1, 0, 0}, {0, 0, 0}, {10, 0, 0}, {20, 1, -2}, {30, 0, -3}, {25, 1, -31},
+};
+
+const vector<vector<int>> large_matrix_sizeA_range = {
+    {70, 70, 100, 70}, {192, 192, 192, 192}, {600, 700, 645, 600}, {1000, 1000, 1000, 1000}
+};
+
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100, 0, 0}, {150, 1, -2}, {200, 0, -3}, {250, 1, -31}, {524, 1, 0},
+};
+
+
+Arguments setup_gesvmSB_arguments(gesvmSB_tuple tup) {
+
+  vector<int> matrix_sizeA = std::get<0>(tup);
+  vector<int> matrix_sizeB = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_sizeA[0];
+  arg.N = matrix_sizeB[0];
+  arg.lda = matrix_sizeA[1];
+  arg.ldb = matrix_sizeA[2];
+  arg.ldc = matrix_sizeA[3];
+
+  arg.bsa = arg.M * arg.lda + matrix_sizeB[1]*10;
+  arg.bsb = arg.N * arg.ldb + matrix_sizeB[1]*10;
+  arg.bsc = arg.N * arg.ldc + matrix_sizeB[1]*10;
+  arg.bsp = arg.M + matrix_sizeB[1]*10;
+
+  arg.batch_count = 3;
+  arg.timing = 0;
+
+  return arg;
+}
+
+class MixedSolver_sb : public ::TestWithParam<gesvmSB_tuple> {
+protected:
+  MixedSolver_sb() {}
+  virtual ~MixedSolver_sb() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(MixedSolver_sb, gesv_mixed_strided_batched_double) {
+  Arguments arg = setup_gesvmSB_arguments(GetParam());
+  rocblas_int fallback = std::get<1>(GetParam())[2];
+
+  rocblas_status status = testing_gesv_mixed_strided_batched<double,double>(arg, fallback);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M || arg.ldc < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(MixedSolver_sb, gesv_mixed_strided_batched_double_complex) {
+  Arguments arg = setup_gesvmSB_arguments(GetParam());
+  rocblas_int fallback = std::get<1>(GetParam())[2];
+
+  rocblas_status status = testing_gesv_mixed_strided_batched<rocblas_double_complex,double>(arg, fallback);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M || arg.ldc < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// This function mainly test the scope of matrix_size.
+INSTANTIATE_TEST_CASE_P(daily_lapack, MixedSolver_sb,
+                        Combine(ValuesIn(large_matrix_sizeA_range),
+                                ValuesIn(large_matrix_sizeB_range)));
+
+// THis function mainly test the scope of uplo_range, the scope of
+// matrix_size_range is small
+INSTANTIATE_TEST_CASE_P(checkin_lapack, MixedSolver_sb,
+                        Combine(ValuesIn(matrix_sizeA_range),
+                                ValuesIn(matrix_sizeB_range)));
@@ -0,0 +1,195 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, vector<int>> gesvSB_tuple;
+
+// **** THIS FUNCTION ONLY TESTS NORMNAL USE CASE
+//      I.E. WHEN STRIDEA >= LDA*N,
+//      STRIDEB >= LDB*NRHS, AND STRIDEP >= N ****
+
+// vector of vector, each vector is a {N, lda, ldb};
+// add/delete as a group
+// (the systems of at most 32 equations are solved by a single kernel)
+const vector<vector<int>> matrix_sizeA_range = {
+    {-1, 1, 1}, {0, 1, 1}, {10, 2, 10}, {10, 10, 2}, {6, 6, 6}, {20, 20, 20}, {24, 30, 24},
+    {32, 32, 40}, {33, 33, 33}, {50, 60, 60}
+};
+
+// vector of vector, each vector is a {nrhs, std};
+// if std = 0 strides are the minimum
+// if std = 1 strides are larger
+const vector<vector<int>> matrix_sizeB_range = {
+    {-1, 0}, {0, 0}, {1, 0}, {10, 1}, {30, 0},
+};
+
+const vector<vector<int>> large_matrix_sizeA_range = {
+    {70, 70, 100}, {192, 192, 192}, {600, 700, 645}, {1000, 1000, 1000}
+};
+
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100, 0}, {150, 1}, {524, 1},
+};
+
+// vector of vector, each vector is a {N, nrhs} with a singular system in the batch
+// (on both sides of the size of the systems solved by a single kernel)
+const vector<vector<int>> singular_size_range = {
+    {6, 1}, {32, 10}, {33, 10}, {100, 30},
+};
+
+
+Arguments setup_gesvSB_arguments(gesvSB_tuple tup) {
+
+  vector<int> matrix_sizeA = std::get<0>(tup);
+  vector<int> matrix_sizeB = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_sizeA[0];
+  arg.N = matrix_sizeB[0];
+  arg.lda = matrix_sizeA[1];
+  arg.ldb = matrix_sizeA[2];
+
+  arg.bsa = arg.M * arg.lda + matrix_sizeB[1]*10;
+  arg.bsb = arg.N * arg.ldb + matrix_sizeB[1]*10;
+  arg.bsp = arg.M + matrix_sizeB[1]*10;
+
+  arg.batch_count = 3;
+  arg.timing = 0;
+
+  return arg;
+}
+
+class LUsolver_gesv_sb : public ::TestWithParam<gesvSB_tuple> {
+protected:
+  LUsolver_gesv_sb() {}
+  virtual ~LUsolver_gesv_sb() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUsolver_gesv_sb, gesv_strided_batched_float) {
+  Arguments arg = setup_gesvSB_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_strided_batched<float,float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(LUsolver_gesv_sb, gesv_strided_batched_double) {
+  Arguments arg = setup_gesvSB_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_strided_batched<double,double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(LUsolver_gesv_sb, gesv_strided_batched_float_complex) {
+  Arguments arg = setup_gesvSB_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_strided_batched<rocblas_float_complex,float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(LUsolver_gesv_sb, gesv_strided_batched_double_complex) {
+  Arguments arg = setup_gesvSB_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_strided_batched<rocblas_double_complex,double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+class LUsolver_gesv_sb_singular : public ::TestWithParam<vector<int>> {
+protected:
+  LUsolver_gesv_sb_singular() {}
+  virtual ~LUsolver_gesv_sb_singular() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUsolver_gesv_sb_singular, gesv_strided_batched_float) {
+  vector<int> size = GetParam();
+  testing_gesv_strided_batched_singular<float,float>(size[0], size[1]);
+}
+
+TEST_P(LUsolver_gesv_sb_singular, gesv_strided_batched_double) {
+  vector<int> size = GetParam();
+  testing_gesv_strided_batched_singular<double,double>(size[0], size[1]);
+}
+
+TEST_P(LUsolver_gesv_sb_singular, gesv_strided_batched_float_complex) {
+  vector<int> size = GetParam();
+  testing_gesv_strided_batched_singular<rocblas_float_complex,float>(size[0], size[1]);
+}
+
+TEST_P(LUsolver_gesv_sb_singular, gesv_strided_batched_double_complex) {
+  vector<int> size = GetParam();
+  testing_gesv_strided_batched_singular<rocblas_double_complex,double>(size[0], size[1]);
+}
+
+// This function mainly test the scope of matrix_size.
+INSTANTIATE_TEST_CASE_P(daily_lapack, LUsolver_gesv_sb,
+                        Combine(ValuesIn(large_matrix_sizeA_range),
+                                ValuesIn(large_matrix_sizeB_range)));
+
+// THis function mainly test the scope of uplo_range, the scope of
+// matrix_size_range is small
+INSTANTIATE_TEST_CASE_P(checkin_lapack, LUsolver_gesv_sb,
+                        Combine(ValuesIn(matrix_sizeA_range),
+                                ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, LUsolver_gesv_sb_singular,
+                        ValuesIn(singular_size_range));
@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_hidden_sync.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<string, vector<int>> hidden_sync_tuple;
+
+// every routine, with its batched and strided_batched versions
+// (there are no batched versions of the auxiliaries and of the org/orm routines)
+const vector<string> routine_range = {
+    "lacgv", "laswp", "larfg", "larf", "larft", "larfb",
+    "getf2", "getf2_batched", "getf2_strided_batched",
+    "getrf", "getrf_batched", "getrf_strided_batched",
+    "potf2", "potf2_batched", "potf2_strided_batched",
+    "potrf", "potrf_batched", "potrf_strided_batched",
+    "getrs", "getrs_batched", "getrs_strided_batched",
+    "gesv", "gesv_batched", "gesv_strided_batched",
+    "geqr2", "geqr2_batched", "geqr2_strided_batched",
+    "geqrf", "geqrf_batched", "geqrf_strided_batched",
+    "gelq2", "gelq2_batched", "gelq2_strided_batched",
+    "gelqf", "gelqf_batched", "gelqf_strided_batched",
+    "org2r", "orgqr", "orgl2", "orglq", "orgbr",
+    "orm2r", "ormqr", "orml2", "ormlq", "ormbr",
+};
+
+// vector of vector, each vector is a {M, N, batch_count};
+// (small sizes, and sizes large enough for the blocked algorithms)
+const vector<vector<int>> size_range = {
+    {16, 16, 5}, {130, 100, 3},
+};
+
+const vector<vector<int>> large_size_range = {
+    {512, 512, 2}, {1000, 300, 1},
+};
+
+
+class HiddenSync : public ::TestWithParam<hidden_sync_tuple> {
+protected:
+  HiddenSync() {}
+  virtual ~HiddenSync() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(HiddenSync, float) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_hidden_sync<float>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(HiddenSync, double) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_hidden_sync<double>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(HiddenSync, float_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_hidden_sync<rocblas_float_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(HiddenSync, double_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_hidden_sync<rocblas_double_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, HiddenSync,
+                        Combine(ValuesIn(routine_range), ValuesIn(large_size_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, HiddenSync,
+                        Combine(ValuesIn(routine_range), ValuesIn(size_range)));
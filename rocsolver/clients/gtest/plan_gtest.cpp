@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_plan.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<string, vector<int>> plan_tuple;
+
+// routines with plans
+const vector<string> plan_routine_range = {
+    "getrf", "getrf_batched", "getrf_strided_batched",
+    "potrf", "potrf_batched", "potrf_strided_batched",
+    "geqrf", "geqrf_batched", "geqrf_strided_batched",
+    "getrs", "getrs_batched", "getrs_strided_batched",
+};
+
+// vector of vector, each vector is a {M, N, batch_count};
+// (small sizes, and sizes large enough for the blocked algorithms)
+const vector<vector<int>> plan_size_range = {
+    {16, 16, 5}, {130, 100, 3},
+};
+
+const vector<vector<int>> plan_large_size_range = {
+    {512, 512, 2},
+};
+
+
+class Plan : public ::TestWithParam<plan_tuple> {
+protected:
+  Plan() {}
+  virtual ~Plan() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(Plan, float) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan<float>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(Plan, double) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan<double>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(Plan, float_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan<rocblas_float_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(Plan, double_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan<rocblas_double_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+class PlanGraphs : public ::TestWithParam<plan_tuple> {
+protected:
+  PlanGraphs() {}
+  virtual ~PlanGraphs() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(PlanGraphs, float) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan_graphs<float>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(PlanGraphs, double) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan_graphs<double>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(PlanGraphs, float_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan_graphs<rocblas_float_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(PlanGraphs, double_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_plan_graphs<rocblas_double_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, Plan,
+                        Combine(ValuesIn(plan_routine_range), ValuesIn(plan_large_size_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, Plan,
+                        Combine(ValuesIn(plan_routine_range), ValuesIn(plan_size_range)));
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, PlanGraphs,
+                        Combine(ValuesIn(plan_routine_range), ValuesIn(plan_large_size_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, PlanGraphs,
+                        Combine(ValuesIn(plan_routine_range), ValuesIn(plan_size_range)));
@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_workspace.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<string, vector<int>> workspace_tuple;
+
+// routines that need device workspace for the sizes below
+const vector<string> workspace_routine_range = {
+    "getrf", "getrf_batched", "getrf_strided_batched",
+    "potrf", "potrf_strided_batched",
+    "gesv_strided_batched",
+    "geqrf", "geqrf_batched",
+    "gelqf_strided_batched",
+};
+
+// vector of vector, each vector is a {M, N, batch_count};
+// (sizes large enough for the blocked algorithms)
+const vector<vector<int>> workspace_size_range = {
+    {130, 100, 3},
+};
+
+const vector<vector<int>> workspace_large_size_range = {
+    {512, 512, 2},
+};
+
+
+class Workspace : public ::TestWithParam<workspace_tuple> {
+protected:
+  Workspace() {}
+  virtual ~Workspace() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(Workspace, float) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace<float>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(Workspace, double) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace<double>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(Workspace, float_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace<rocblas_float_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(Workspace, double_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace<rocblas_double_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, Workspace,
+                        Combine(ValuesIn(workspace_routine_range), ValuesIn(workspace_large_size_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, Workspace,
+                        Combine(ValuesIn(workspace_routine_range), ValuesIn(workspace_size_range)));
+
+class WorkspaceRetired : public ::TestWithParam<workspace_tuple> {
+protected:
+  WorkspaceRetired() {}
+  virtual ~WorkspaceRetired() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(WorkspaceRetired, float) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_retired<float>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(WorkspaceRetired, double) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_retired<double>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(WorkspaceRetired, float_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_retired<rocblas_float_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(WorkspaceRetired, double_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_retired<rocblas_double_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, WorkspaceRetired,
+                        Combine(ValuesIn(workspace_routine_range), ValuesIn(workspace_size_range)));
+
+class WorkspaceRocblasHandles : public ::TestWithParam<workspace_tuple> {
+protected:
+  WorkspaceRocblasHandles() {}
+  virtual ~WorkspaceRocblasHandles() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(WorkspaceRocblasHandles, float) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_rocblas_handles<float>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(WorkspaceRocblasHandles, double) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_rocblas_handles<double>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(WorkspaceRocblasHandles, float_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_rocblas_handles<rocblas_float_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+TEST_P(WorkspaceRocblasHandles, double_complex) {
+  vector<int> size = std::get<1>(GetParam());
+  testing_workspace_rocblas_handles<rocblas_double_complex>(std::get<0>(GetParam()), size[0], size[1], size[2]);
+}
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, WorkspaceRocblasHandles,
+                        Combine(ValuesIn(workspace_routine_range), ValuesIn(workspace_size_range)));
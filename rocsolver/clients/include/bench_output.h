@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BENCH_OUTPUT_H
+#define _BENCH_OUTPUT_H
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!\file
+ * \brief output of the results of the benchmark client. Every timed call
+ * produces one row; rows are written (to stdout by default) as CSV or as JSON.
+ */
+
+enum bench_format { bench_format_csv, bench_format_json };
+
+/*! \brief sets the format of the rows printed from now on. In CSV format the
+ * header is only printed when the columns change, so that all the points of a
+ * sweep form a single table. In JSON format every row is an object in its own line. */
+void bench_set_format(bench_format format);
+
+/*! \brief sets the stream where the rows are written (stdout by default) */
+void bench_set_stream(std::ostream &stream);
+
+/*! \brief sets a field that is added at the beginning of every row, such as the name
+ * of the function or the device. If csv is false, the field is only written in JSON format. */
+void bench_set_context(const std::string &name, const std::string &value, bool csv);
+
+/*! \brief a row of results, with the columns in the order they are added */
+class bench_row {
+public:
+  bench_row &add(const std::string &name, const std::string &value) {
+    columns.emplace_back(name, value);
+    quoted.push_back(true);
+    return *this;
+  }
+
+  bench_row &add(const std::string &name, const char *value) {
+    return add(name, std::string(value));
+  }
+
+  bench_row &add(const std::string &name, char value) {
+    return add(name, std::string(1, value));
+  }
+
+  template <typename V> bench_row &add(const std::string &name, const V &value) {
+    std::ostringstream s;
+    s << value;
+    columns.emplace_back(name, s.str());
+    quoted.push_back(false);
+    return *this;
+  }
+
+  void print() const;
+
+private:
+  std::vector<std::pair<std::string, std::string>> columns;
+  std::vector<bool> quoted;
+};
+
+#endif
@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BENCH_SUITE_H
+#define _BENCH_SUITE_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!\file
+ * \brief benchmark suites: files listing the tests that the benchmark client runs
+ * in a single process. A suite is written in a subset of YAML: a sequence of
+ * mappings from the (long) names of the command line options to their values,
+ * either in block or in flow style. Lists are given in brackets, and switches
+ * take the values true or false. For example:
+ *
+ *   # LU factorization of a single matrix, for several sizes
+ *   - function: getrf
+ *     precision: d
+ *     range: [256, 4096, 256]
+ *   - {function: getrf_strided_batched, precision: s, sizem: 32, sizen: 32, batch: 10000, cold: true}
+ */
+
+/*! \brief an entry of a suite: the options in the order they are given, and their values */
+typedef std::vector<std::pair<std::string, std::vector<std::string>>> bench_suite_entry;
+
+/*! \brief reads the entries of the suite in filename. On error, returns false with a
+ * message (including the line of the file) in error. */
+bool bench_read_suite(const std::string &filename, std::vector<bench_suite_entry> &entries,
+                      std::string &error);
+
+/*! \brief returns the command line arguments equivalent to an entry */
+std::vector<std::string> bench_suite_args(const bench_suite_entry &entry);
+
+#endif
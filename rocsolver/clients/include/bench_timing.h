@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BENCH_TIMING_H
+#define _BENCH_TIMING_H
+
+#include "bench_output.h"
+#include "rocblas.h"
+#include "utility.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+/*!\file
+ * \brief timing of the calls in the benchmark client. Every timed call is
+ * bracketed by a pair of hipEvents recorded on the stream of the handle.
+ */
+
+/*! \brief statistics of the timed calls (in microseconds) */
+struct bench_timing {
+  double mean = 0;
+  double min = 0;
+  double median = 0;
+  double p95 = 0;
+  double stddev = 0;
+
+  // median time spent on the host by a call, from the API entry to its return.
+  // When it gets close to the GPU time, the call is bound by the launch overhead
+  // (or it synchronizes with the device).
+  double host = 0;
+
+  // number of timed calls
+  rocblas_int iters = 0;
+
+  void add_to(bench_row &row) const {
+    row.add("iters", iters);
+    row.add("gpu_time(us)", mean);
+    row.add("gpu_min(us)", min);
+    row.add("gpu_median(us)", median);
+    row.add("gpu_p95(us)", p95);
+    row.add("gpu_stddev(us)", stddev);
+    row.add("host_time(us)", host);
+  }
+};
+
+/*! \brief copies of the input buffers that a call overwrites, taken right after they are
+ * initialized. In cold-cache mode (--cold) they are restored before every call, so that
+ * every call works on the original data and not on the result of the previous one.
+ * (Nothing is copied otherwise.) */
+class bench_inputs {
+public:
+  explicit bench_inputs(const Arguments &argus) : enabled(argus.cold) {}
+
+  bench_inputs(const bench_inputs &) = delete;
+  bench_inputs &operator=(const bench_inputs &) = delete;
+
+  ~bench_inputs() {
+    for (auto &b : buffers)
+      hipFree(b.copy);
+  }
+
+  void add(void *buffer, size_t bytes) {
+    if (!enabled || !bytes)
+      return;
+    void *copy;
+    CHECK_HIP_ERROR(hipMalloc(&copy, bytes));
+    CHECK_HIP_ERROR(hipMemcpy(copy, buffer, bytes, hipMemcpyDeviceToDevice));
+    buffers.push_back({buffer, copy, bytes});
+  }
+
+  void restore(hipStream_t stream) const {
+    for (auto &b : buffers)
+      hipMemcpyAsync(b.buffer, b.copy, b.bytes, hipMemcpyDeviceToDevice, stream);
+  }
+
+private:
+  struct buffer_copy {
+    void *buffer;
+    void *copy;
+    size_t bytes;
+  };
+  bool enabled;
+  std::vector<buffer_copy> buffers;
+};
+
+/*! \brief evicts the data of the previous calls from the device caches, by writing
+ * a scratch buffer several times larger than the L2 cache */
+inline void bench_flush_cache(hipStream_t stream) {
+  // (the buffer is kept until the end of the process)
+  static size_t size = 0;
+  static void *scratch = nullptr;
+  static unsigned char value = 0;
+
+  if (!scratch) {
+    int device;
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device));
+    size = std::max<size_t>(4 * size_t(props.l2CacheSize), 64 << 20);
+    CHECK_HIP_ERROR(hipMalloc(&scratch, size));
+  }
+  hipMemsetAsync(scratch, value++, size, stream);
+}
+
+/*! \brief runs call() argus.warmup times without timing, and then argus.iters
+ * times, recording the device time and the host time of every call. In cold-cache
+ * mode (argus.cold) the inputs are restored and the caches are flushed before
+ * every call, outside of the timed region. */
+template <typename F>
+bench_timing bench_time(rocblas_handle handle, const Arguments &argus, F call,
+                        const bench_inputs *inputs = nullptr) {
+  bench_timing t;
+  rocblas_int iters = std::max(1, argus.iters);
+  t.iters = iters;
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  auto prepare = [&] {
+    if (argus.cold) {
+      if (inputs)
+        inputs->restore(stream);
+      bench_flush_cache(stream);
+    }
+  };
+
+  for (rocblas_int i = 0; i < argus.warmup; ++i) {
+    prepare();
+    call();
+  }
+
+  // (the events are synchronized after the last call, so that the calls
+  // are queued back to back as in an application)
+  std::vector<hipEvent_t> start(iters), stop(iters);
+  for (rocblas_int i = 0; i < iters; ++i) {
+    hipEventCreate(&start[i]);
+    hipEventCreate(&stop[i]);
+  }
+
+  std::vector<double> gpu(iters), host(iters);
+  for (rocblas_int i = 0; i < iters; ++i) {
+    prepare();
+    hipEventRecord(start[i], stream);
+    auto t0 = std::chrono::steady_clock::now();
+    call();
+    auto t1 = std::chrono::steady_clock::now();
+    hipEventRecord(stop[i], stream);
+    host[i] = std::chrono::duration<double, std::micro>(t1 - t0).count();
+  }
+  hipEventSynchronize(stop[iters - 1]);
+
+  for (rocblas_int i = 0; i < iters; ++i) {
+    float ms = 0;
+    hipEventElapsedTime(&ms, start[i], stop[i]);
+    gpu[i] = ms * 1000.0;
+    hipEventDestroy(start[i]);
+    hipEventDestroy(stop[i]);
+  }
+
+  std::sort(gpu.begin(), gpu.end());
+  std::sort(host.begin(), host.end());
+
+  for (double x : gpu)
+    t.mean += x;
+  t.mean /= iters;
+  for (double x : gpu)
+    t.stddev += (x - t.mean) * (x - t.mean);
+  t.stddev = iters > 1 ? std::sqrt(t.stddev / (iters - 1)) : 0;
+
+  t.min = gpu[0];
+  t.median = iters % 2 ? gpu[iters / 2] : (gpu[iters / 2 - 1] + gpu[iters / 2]) / 2;
+  t.p95 = gpu[std::max(0, rocblas_int(std::ceil(0.95 * iters)) - 1)];
+  t.host = iters % 2 ? host[iters / 2] : (host[iters / 2 - 1] + host[iters / 2]) / 2;
+
+  return t;
+}
+
+#endif
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _FLOPS_H
+#define _FLOPS_H
+
+#include "bench_output.h"
+#include "rocblas.h"
+#include "utility.h"
+#include <algorithm>
+
+/*!\file
+ * \brief operation counts of the LAPACK routines, used by the benchmark client
+ * to report the achieved GFLOP/s. The counts of multiplications and additions are
+ * those of LAPACK Working Note 41; a complex multiplication counts as 6 flops and
+ * a complex addition as 2 flops.
+ */
+
+template <typename T> inline double flops(double muls, double adds) {
+  return is_complex<T> ? 6.0 * muls + 2.0 * adds : muls + adds;
+}
+
+/* ============================================================================================
+ */
+/*  factorizations and linear systems */
+
+template <typename T> inline double getrf_flops(double m, double n) {
+  double k = std::min(m, n), l = std::max(m, n);
+  double muls = 0.5 * k * (k * (l - k / 3.0 - 1.0) + l) + 2.0 * k / 3.0;
+  double adds = 0.5 * k * (k * (l - k / 3.0) - l) + k / 6.0;
+  return flops<T>(muls, adds);
+}
+
+template <typename T> inline double getrs_flops(double n, double nrhs) {
+  return flops<T>(nrhs * n * n, nrhs * n * (n - 1.0));
+}
+
+template <typename T> inline double potrf_flops(double n) {
+  return flops<T>(n * ((n / 6.0 + 0.5) * n + 1.0 / 3.0), n * (n * n / 6.0 - 1.0 / 6.0));
+}
+
+template <typename T> inline double geqrf_flops(double m, double n) {
+  double muls, adds;
+  if (m > n) {
+    muls = n * (n * (0.5 - n / 3.0 + m) + m + 23.0 / 6.0);
+    adds = n * (n * (0.5 - n / 3.0 + m) + 5.0 / 6.0);
+  } else {
+    muls = m * (m * (-0.5 - m / 3.0 + n) + 2.0 * n + 23.0 / 6.0);
+    adds = m * (m * (-0.5 - m / 3.0 + n) + n + 5.0 / 6.0);
+  }
+  return flops<T>(muls, adds);
+}
+
+template <typename T> inline double gelqf_flops(double m, double n) {
+  return geqrf_flops<T>(n, m);
+}
+
+/* ============================================================================================
+ */
+/*  generation and application of orthogonal/unitary matrices */
+
+template <typename T> inline double orgqr_flops(double m, double n, double k) {
+  double muls = k * (2.0 * m * n + 2.0 * n - 5.0 / 3.0 + k * (2.0 / 3.0 * k - (m + n) - 1.0));
+  double adds = k * (2.0 * m * n + n - m + 1.0 / 3.0 + k * (2.0 / 3.0 * k - (m + n)));
+  return flops<T>(muls, adds);
+}
+
+template <typename T> inline double orglq_flops(double m, double n, double k) {
+  return orgqr_flops<T>(n, m, k);
+}
+
+template <typename T> inline double ormqr_flops(bool left, double m, double n, double k) {
+  double muls, adds;
+  if (left) {
+    muls = 2.0 * n * m * k - n * k * k + 2.0 * n * k;
+    adds = 2.0 * n * m * k - n * k * k + n * k;
+  } else {
+    muls = 2.0 * n * m * k - m * k * k + m * k + n * k - 0.5 * k * k + 0.5 * k;
+    adds = 2.0 * n * m * k - m * k * k + m * k;
+  }
+  return flops<T>(muls, adds);
+}
+
+template <typename T> inline double ormlq_flops(bool left, double m, double n, double k) {
+  return ormqr_flops<T>(left, m, n, k);
+}
+
+/* ============================================================================================
+ */
+/*  auxiliaries */
+
+template <typename T> inline double larfg_flops(double n) {
+  // norm of x and scaling of x
+  return flops<T>(2.0 * n, n);
+}
+
+template <typename T> inline double larf_flops(bool left, double m, double n) {
+  // w = A'v and A = A - tau*v*w'
+  return flops<T>(2.0 * m * n + (left ? n : m), 2.0 * m * n);
+}
+
+template <typename T> inline double larft_flops(double n, double k) {
+  // triangular part of V'V and k triangular matrix-vector products
+  return flops<T>(0.5 * n * k * k + k * k * k / 6.0, 0.5 * n * k * k + k * k * k / 6.0);
+}
+
+template <typename T> inline double larfb_flops(bool left, double m, double n, double k) {
+  // W = C'V, W = W*T' and C = C - V*W'
+  double q = left ? n : m;
+  return flops<T>(2.0 * m * n * k + 0.5 * q * k * k, 2.0 * m * n * k + 0.5 * q * k * k);
+}
+
+/* ============================================================================================
+ */
+/*  minimum memory traffic (in bytes) of the bandwidth-bound auxiliaries */
+
+template <typename T> inline double larfg_bytes(double n) {
+  // x is read twice (norm and scaling) and written once
+  return 3.0 * n * sizeof(T);
+}
+
+template <typename T> inline double larf_bytes(bool left, double m, double n) {
+  // A is read and written, v is read
+  return (2.0 * m * n + (left ? m : n)) * sizeof(T);
+}
+
+template <typename T> inline double larft_bytes(double n, double k) {
+  // V is read and the triangular factor is written
+  return (n * k + 0.5 * k * k) * sizeof(T);
+}
+
+template <typename T> inline double larfb_bytes(bool left, double m, double n, double k) {
+  // A is read and written, V and the triangular factor are read
+  return (2.0 * m * n + (left ? m : n) * k + 0.5 * k * k) * sizeof(T);
+}
+
+template <typename T> inline double laswp_bytes(double n, double k1, double k2) {
+  // every interchange reads and writes two rows
+  return 4.0 * n * (k2 - k1 + 1.0) * sizeof(T);
+}
+
+template <typename T> inline double lacgv_bytes(double n) {
+  return 2.0 * n * sizeof(T);
+}
+
+/* ============================================================================================
+ */
+/*  reporting */
+
+/*! \brief adds the achieved GFLOP/s for the given operation count and time (in microseconds),
+ * and the percentage of the peak given with --peak_gflops */
+inline void bench_add_gflops(bench_row &row, const Arguments &argus, double flops, double time_us) {
+  double gflops = flops / (time_us * 1e3);
+  row.add("gflops", gflops);
+  if (argus.peak_gflops > 0)
+    row.add("%peak", 100.0 * gflops / argus.peak_gflops);
+}
+
+/*! \brief adds the effective bandwidth for the given memory traffic and time (in microseconds),
+ * and the percentage of the peak given with --peak_bandwidth */
+inline void bench_add_bandwidth(bench_row &row, const Arguments &argus, double bytes, double time_us) {
+  double gbytes = bytes / (time_us * 1e3);
+  row.add("GB/s", gbytes);
+  if (argus.peak_bandwidth > 0)
+    row.add("%peak_bw", 100.0 * gbytes / argus.peak_bandwidth);
+}
+
+#endif
@@ -1,36 +1,124 @@
-#ifndef GUARD_ROCBLAS_MANAGE_PTR
-#define GUARD_ROCBLAS_MANAGE_PTR
-
-#include <memory>
-
-#define PRINT_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                             \
-  {                                                                            \
-    hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;                  \
-    if (TMP_STATUS_FOR_CHECK != hipSuccess) {                                  \
-      fprintf(stderr, "hip error code: %d at %s:%d\n", TMP_STATUS_FOR_CHECK,   \
-              __FILE__, __LINE__);                                             \
-    }                                                                          \
-  }
-
-namespace rocblas_test {
-// device_malloc wraps hipMalloc and provides same API as malloc
-static void *device_malloc(size_t byte_size) {
-  void *pointer;
-  PRINT_IF_HIP_ERROR(hipMalloc(&pointer, byte_size));
-  return pointer;
-}
-
-// device_free wraps hipFree and provides same API as free
-static void device_free(void *ptr) { PRINT_IF_HIP_ERROR(hipFree(ptr)); }
-
-struct handle_struct {
-  rocblas_handle handle;
-  handle_struct() { rocsolver_create_handle(&handle); }
-
-  ~handle_struct() { rocsolver_destroy_handle(handle); }
-};
-} // namespace rocblas_test
-
-using rocblas_unique_ptr = std::unique_ptr<void, void (*)(void *)>;
-
-#endif
+#ifndef GUARD_ROCBLAS_MANAGE_PTR
+#define GUARD_ROCBLAS_MANAGE_PTR
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#define PRINT_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                             \
+  {                                                                            \
+    hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;                  \
+    if (TMP_STATUS_FOR_CHECK != hipSuccess) {                                  \
+      fprintf(stderr, "hip error code: %d at %s:%d\n", TMP_STATUS_FOR_CHECK,   \
+              __FILE__, __LINE__);                                             \
+    }                                                                          \
+  }
+
+namespace rocblas_test {
+// When the resources are reused (as in a benchmark suite, where many tests run in
+// the same process), all the tests share a single handle, and the device buffers are
+// not released when they are freed but kept for the following tests. A buffer is
+// reused by a later allocation of the same size or slightly smaller (so that the
+// library workspace attached to the handle is also kept from test to test).
+struct reusable_resources {
+  bool enabled = false;
+  rocblas_handle handle = nullptr;
+  std::unordered_map<void *, size_t> sizes;   // sizes of the buffers in use
+  std::multimap<size_t, void *> free_buffers; // buffers kept for reuse
+
+  static reusable_resources &get() {
+    static reusable_resources r;
+    return r;
+  }
+
+  void release_buffers() {
+    for (auto &b : free_buffers)
+      PRINT_IF_HIP_ERROR(hipFree(b.second));
+    free_buffers.clear();
+  }
+};
+
+// enables (or disables) the reuse of handles and device buffers by the following tests
+inline void reuse_resources(bool enable) {
+  auto &r = reusable_resources::get();
+  if (!enable) {
+    r.release_buffers();
+    if (r.handle)
+      rocsolver_destroy_handle(r.handle);
+    r.handle = nullptr;
+  }
+  r.enabled = enable;
+}
+
+// device_malloc wraps hipMalloc and provides same API as malloc
+static void *device_malloc(size_t byte_size) {
+  auto &r = reusable_resources::get();
+  void *pointer = nullptr;
+
+  if (r.enabled) {
+    // (a buffer up to twice as large as requested can be reused)
+    auto it = r.free_buffers.lower_bound(byte_size);
+    if (it != r.free_buffers.end() && it->first <= 2 * std::max<size_t>(byte_size, 1)) {
+      pointer = it->second;
+      r.sizes[pointer] = it->first;
+      r.free_buffers.erase(it);
+      return pointer;
+    }
+    if (hipMalloc(&pointer, byte_size) != hipSuccess) {
+      // the cached buffers may be taking the memory
+      r.release_buffers();
+      pointer = nullptr;
+    } else {
+      r.sizes[pointer] = byte_size;
+      return pointer;
+    }
+  }
+
+  PRINT_IF_HIP_ERROR(hipMalloc(&pointer, byte_size));
+  if (r.enabled && pointer)
+    r.sizes[pointer] = byte_size;
+  return pointer;
+}
+
+template <typename P> static void device_malloc(P **pointer, size_t byte_size) {
+  *pointer = static_cast<P *>(device_malloc(byte_size));
+}
+
+// device_free wraps hipFree and provides same API as free
+static void device_free(void *ptr) {
+  auto &r = reusable_resources::get();
+  auto it = r.sizes.find(ptr);
+  if (it != r.sizes.end()) {
+    if (r.enabled)
+      r.free_buffers.emplace(it->second, ptr);
+    else
+      PRINT_IF_HIP_ERROR(hipFree(ptr));
+    r.sizes.erase(it);
+    return;
+  }
+  PRINT_IF_HIP_ERROR(hipFree(ptr));
+}
+
+struct handle_struct {
+  rocblas_handle handle;
+  handle_struct() {
+    auto &r = reusable_resources::get();
+    if (r.enabled) {
+      if (!r.handle)
+        rocsolver_create_handle(&r.handle);
+      handle = r.handle;
+    } else
+      rocsolver_create_handle(&handle);
+  }
+
+  ~handle_struct() {
+    if (handle != reusable_resources::get().handle)
+      rocsolver_destroy_handle(handle);
+  }
+};
+} // namespace rocblas_test
+
+using rocblas_unique_ptr = std::unique_ptr<void, void (*)(void *)>;
+
+#endif
@@ -1044,6 +1044,187 @@ rocsolver_getrs_strided_batched(rocblas_handle handle, rocblas_operation trans,
     return rocsolver_zgetrs_strided_batched(handle,trans,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,batch_count);
 }
 
+//gesv
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda,
+               rocblas_int *ipiv, T *B, rocblas_int ldb, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda,
+               rocblas_int *ipiv, float *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_sgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda,
+               rocblas_int *ipiv, double *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_dgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda,
+               rocblas_int *ipiv, rocblas_float_complex *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_cgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda,
+               rocblas_int *ipiv, rocblas_double_complex *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_zgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+//gesv_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *const A[], rocblas_int lda,
+               rocblas_int *ipiv, rocblas_int strideP, T *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *const A[], rocblas_int lda,
+               rocblas_int *ipiv, rocblas_int strideP, float *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *const A[], rocblas_int lda,
+               rocblas_int *ipiv, rocblas_int strideP, double *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *const A[], rocblas_int lda,
+               rocblas_int *ipiv, rocblas_int strideP, rocblas_float_complex *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *const A[], rocblas_int lda,
+               rocblas_int *ipiv, rocblas_int strideP, rocblas_double_complex *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+//gesv_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, rocblas_int strideA,
+               rocblas_int *ipiv, rocblas_int strideP, T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, rocblas_int strideA,
+               rocblas_int *ipiv, rocblas_int strideP, float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, rocblas_int strideA,
+               rocblas_int *ipiv, rocblas_int strideP, double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda, rocblas_int strideA,
+               rocblas_int *ipiv, rocblas_int strideP, rocblas_float_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda, rocblas_int strideA,
+               rocblas_int *ipiv, rocblas_int strideP, rocblas_double_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+//gesv_mixed (dsgesv and zcgesv)
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_mixed(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     T *A, rocblas_int lda, rocblas_int *ipiv, T *B, rocblas_int ldb,
+                     T *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     double *A, rocblas_int lda, rocblas_int *ipiv, double *B, rocblas_int ldb,
+                     double *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info) {
+    return rocsolver_dsgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,X,ldx,iter,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     rocblas_double_complex *A, rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, rocblas_int ldb,
+                     rocblas_double_complex *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info) {
+    return rocsolver_zcgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,X,ldx,iter,info);
+}
+
+//gesv_mixed_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_mixed_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     T *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP, T *const B[], rocblas_int ldb,
+                     T *const X[], rocblas_int ldx, rocblas_int *iter, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     double *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP, double *const B[], rocblas_int ldb,
+                     double *const X[], rocblas_int ldx, rocblas_int *iter, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dsgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,X,ldx,iter,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     rocblas_double_complex *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP,
+                     rocblas_double_complex *const B[], rocblas_int ldb, rocblas_double_complex *const X[], rocblas_int ldx,
+                     rocblas_int *iter, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zcgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,X,ldx,iter,info,batch_count);
+}
+
+//gesv_mixed_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_mixed_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     T *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                     T *B, rocblas_int ldb, rocblas_int strideB, T *X, rocblas_int ldx, rocblas_int strideX,
+                     rocblas_int *iter, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     double *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                     double *B, rocblas_int ldb, rocblas_int strideB, double *X, rocblas_int ldx, rocblas_int strideX,
+                     rocblas_int *iter, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dsgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,X,ldx,strideX,iter,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                     rocblas_double_complex *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                     rocblas_double_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_double_complex *X, rocblas_int ldx, rocblas_int strideX,
+                     rocblas_int *iter, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zcgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,X,ldx,strideX,iter,info,batch_count);
+}
+
 
 //geqr2
 
@@ -1465,4 +1646,640 @@ inline rocblas_status rocsolver_gelqf_strided_batched(rocblas_handle handle, roc
   return rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
 }
 
+//getrf plans
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_plan_create(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_create<float>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgetrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_create<double>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgetrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgetrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgetrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_plan_execute(rocsolver_plan plan, T *A, rocblas_int *ipiv, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_execute(rocsolver_plan plan, float *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_sgetrf_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_execute(rocsolver_plan plan, double *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_dgetrf_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_cgetrf_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_zgetrf_plan_execute(plan, A, ipiv, info);
+}
+
+//getrf_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_batched_plan_create(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_create<float>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgetrf_batched_plan_create(handle, m, n, lda, strideP, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_create<double>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgetrf_batched_plan_create(handle, m, n, lda, strideP, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgetrf_batched_plan_create(handle, m, n, lda, strideP, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgetrf_batched_plan_create(handle, m, n, lda, strideP, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_batched_plan_execute(rocsolver_plan plan, T *const A[], rocblas_int *ipiv, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_execute(rocsolver_plan plan, float *const A[], rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_sgetrf_batched_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_execute(rocsolver_plan plan, double *const A[], rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_dgetrf_batched_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_cgetrf_batched_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_zgetrf_batched_plan_execute(plan, A, ipiv, info);
+}
+
+//getrf_strided_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_create(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_create<float>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgetrf_strided_batched_plan_create(handle, m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_create<double>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgetrf_strided_batched_plan_create(handle, m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgetrf_strided_batched_plan_create(handle, m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgetrf_strided_batched_plan_create(handle, m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_execute(rocsolver_plan plan, T *A, rocblas_int *ipiv, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_execute(rocsolver_plan plan, float *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_sgetrf_strided_batched_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_execute(rocsolver_plan plan, double *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_dgetrf_strided_batched_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_cgetrf_strided_batched_plan_execute(plan, A, ipiv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int *ipiv, rocblas_int *info) {
+  return rocsolver_zgetrf_strided_batched_plan_execute(plan, A, ipiv, info);
+}
+
+//potrf plans
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_plan_create(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_create<float>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_spotrf_plan_create(handle, uplo, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_create<double>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dpotrf_plan_create(handle, uplo, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cpotrf_plan_create(handle, uplo, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zpotrf_plan_create(handle, uplo, n, lda, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_plan_execute(rocsolver_plan plan, T *A, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_execute(rocsolver_plan plan, float *A, rocblas_int *info) {
+  return rocsolver_spotrf_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_execute(rocsolver_plan plan, double *A, rocblas_int *info) {
+  return rocsolver_dpotrf_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int *info) {
+  return rocsolver_cpotrf_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int *info) {
+  return rocsolver_zpotrf_plan_execute(plan, A, info);
+}
+
+//potrf_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_batched_plan_create(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_create<float>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_spotrf_batched_plan_create(handle, uplo, n, lda, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_create<double>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dpotrf_batched_plan_create(handle, uplo, n, lda, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cpotrf_batched_plan_create(handle, uplo, n, lda, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zpotrf_batched_plan_create(handle, uplo, n, lda, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_batched_plan_execute(rocsolver_plan plan, T *const A[], rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_execute(rocsolver_plan plan, float *const A[], rocblas_int *info) {
+  return rocsolver_spotrf_batched_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_execute(rocsolver_plan plan, double *const A[], rocblas_int *info) {
+  return rocsolver_dpotrf_batched_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], rocblas_int *info) {
+  return rocsolver_cpotrf_batched_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], rocblas_int *info) {
+  return rocsolver_zpotrf_batched_plan_execute(plan, A, info);
+}
+
+//potrf_strided_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_create(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_create<float>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_spotrf_strided_batched_plan_create(handle, uplo, n, lda, strideA, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_create<double>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dpotrf_strided_batched_plan_create(handle, uplo, n, lda, strideA, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cpotrf_strided_batched_plan_create(handle, uplo, n, lda, strideA, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zpotrf_strided_batched_plan_create(handle, uplo, n, lda, strideA, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_execute(rocsolver_plan plan, T *A, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_execute(rocsolver_plan plan, float *A, rocblas_int *info) {
+  return rocsolver_spotrf_strided_batched_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_execute(rocsolver_plan plan, double *A, rocblas_int *info) {
+  return rocsolver_dpotrf_strided_batched_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int *info) {
+  return rocsolver_cpotrf_strided_batched_plan_execute(plan, A, info);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int *info) {
+  return rocsolver_zpotrf_strided_batched_plan_execute(plan, A, info);
+}
+
+//geqrf plans
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_plan_create(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_create<float>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgeqrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_create<double>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgeqrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgeqrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgeqrf_plan_create(handle, m, n, lda, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_plan_execute(rocsolver_plan plan, T *A, T *ipiv);
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_execute(rocsolver_plan plan, float *A, float *ipiv) {
+  return rocsolver_sgeqrf_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_execute(rocsolver_plan plan, double *A, double *ipiv) {
+  return rocsolver_dgeqrf_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_float_complex *ipiv) {
+  return rocsolver_cgeqrf_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_double_complex *ipiv) {
+  return rocsolver_zgeqrf_plan_execute(plan, A, ipiv);
+}
+
+//geqrf_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_batched_plan_create(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_create<float>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgeqrf_batched_plan_create(handle, m, n, lda, stridep, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_create<double>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgeqrf_batched_plan_create(handle, m, n, lda, stridep, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgeqrf_batched_plan_create(handle, m, n, lda, stridep, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgeqrf_batched_plan_create(handle, m, n, lda, stridep, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_batched_plan_execute(rocsolver_plan plan, T *const A[], T *ipiv);
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_execute(rocsolver_plan plan, float *const A[], float *ipiv) {
+  return rocsolver_sgeqrf_batched_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_execute(rocsolver_plan plan, double *const A[], double *ipiv) {
+  return rocsolver_dgeqrf_batched_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], rocblas_float_complex *ipiv) {
+  return rocsolver_cgeqrf_batched_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], rocblas_double_complex *ipiv) {
+  return rocsolver_zgeqrf_batched_plan_execute(plan, A, ipiv);
+}
+
+//geqrf_strided_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_create(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_create<float>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgeqrf_strided_batched_plan_create(handle, m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_create<double>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgeqrf_strided_batched_plan_create(handle, m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgeqrf_strided_batched_plan_create(handle, m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int lda, rocblas_int strideA, rocblas_int stridep, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgeqrf_strided_batched_plan_create(handle, m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_execute(rocsolver_plan plan, T *A, T *ipiv);
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_execute(rocsolver_plan plan, float *A, float *ipiv) {
+  return rocsolver_sgeqrf_strided_batched_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_execute(rocsolver_plan plan, double *A, double *ipiv) {
+  return rocsolver_dgeqrf_strided_batched_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_float_complex *ipiv) {
+  return rocsolver_cgeqrf_strided_batched_plan_execute(plan, A, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_double_complex *ipiv) {
+  return rocsolver_zgeqrf_strided_batched_plan_execute(plan, A, ipiv);
+}
+
+//getrs plans
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_plan_create(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int ldb,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_create<float>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int ldb,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgetrs_plan_create(handle, trans, n, nrhs, lda, ldb, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_create<double>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int ldb,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgetrs_plan_create(handle, trans, n, nrhs, lda, ldb, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int ldb,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgetrs_plan_create(handle, trans, n, nrhs, lda, ldb, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int ldb,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgetrs_plan_create(handle, trans, n, nrhs, lda, ldb, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_plan_execute(rocsolver_plan plan, T *A, const rocblas_int *ipiv, T *B);
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_execute(rocsolver_plan plan, float *A, const rocblas_int *ipiv, float *B) {
+  return rocsolver_sgetrs_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_execute(rocsolver_plan plan, double *A, const rocblas_int *ipiv, double *B) {
+  return rocsolver_dgetrs_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, const rocblas_int *ipiv, rocblas_float_complex *B) {
+  return rocsolver_cgetrs_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, const rocblas_int *ipiv, rocblas_double_complex *B) {
+  return rocsolver_zgetrs_plan_execute(plan, A, ipiv, B);
+}
+
+//getrs_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_batched_plan_create(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideP, rocblas_int ldb, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_create<float>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideP, rocblas_int ldb, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgetrs_batched_plan_create(handle, trans, n, nrhs, lda, strideP, ldb, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_create<double>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideP, rocblas_int ldb, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgetrs_batched_plan_create(handle, trans, n, nrhs, lda, strideP, ldb, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideP, rocblas_int ldb, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgetrs_batched_plan_create(handle, trans, n, nrhs, lda, strideP, ldb, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideP, rocblas_int ldb, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgetrs_batched_plan_create(handle, trans, n, nrhs, lda, strideP, ldb, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_batched_plan_execute(rocsolver_plan plan, T *const A[], const rocblas_int *ipiv, T *const B[]);
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_execute(rocsolver_plan plan, float *const A[], const rocblas_int *ipiv, float *const B[]) {
+  return rocsolver_sgetrs_batched_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_execute(rocsolver_plan plan, double *const A[], const rocblas_int *ipiv, double *const B[]) {
+  return rocsolver_dgetrs_batched_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], const rocblas_int *ipiv, rocblas_float_complex *const B[]) {
+  return rocsolver_cgetrs_batched_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], const rocblas_int *ipiv, rocblas_double_complex *const B[]) {
+  return rocsolver_zgetrs_batched_plan_execute(plan, A, ipiv, B);
+}
+
+//getrs_strided_batched plans
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_create(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count,
+                                      rocsolver_plan *plan);
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_create<float>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_sgetrs_strided_batched_plan_create(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_create<double>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_dgetrs_strided_batched_plan_create(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_create<rocblas_float_complex>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_cgetrs_strided_batched_plan_create(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_create<rocblas_double_complex>(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int nrhs, rocblas_int lda, rocblas_int strideA, rocblas_int strideP, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count,
+                                      rocsolver_plan *plan) {
+  return rocsolver_zgetrs_strided_batched_plan_create(handle, trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_execute(rocsolver_plan plan, T *A, const rocblas_int *ipiv, T *B);
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_execute(rocsolver_plan plan, float *A, const rocblas_int *ipiv, float *B) {
+  return rocsolver_sgetrs_strided_batched_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_execute(rocsolver_plan plan, double *A, const rocblas_int *ipiv, double *B) {
+  return rocsolver_dgetrs_strided_batched_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, const rocblas_int *ipiv, rocblas_float_complex *B) {
+  return rocsolver_cgetrs_strided_batched_plan_execute(plan, A, ipiv, B);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, const rocblas_int *ipiv, rocblas_double_complex *B) {
+  return rocsolver_zgetrs_strided_batched_plan_execute(plan, A, ipiv, B);
+}
+
 #endif /* ROCSOLVER_HPP */
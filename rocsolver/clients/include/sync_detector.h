@@ -0,0 +1,46 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _SYNC_DETECTOR_H
+#define _SYNC_DETECTOR_H
+
+#include <string>
+
+/* =====================================================================
+
+    Hidden synchronization detector: the test client defines the HIP
+    functions that synchronize the host with the device (or may do so),
+    counts the calls made to them, and forwards them to the HIP runtime.
+    A call is counted when it is made directly by the rocSOLVER library
+    (the calls made by rocBLAS on behalf of rocSOLVER are counted apart).
+
+   =================================================================== */
+
+/*! \brief number of calls to each kind of synchronizing HIP function */
+struct sync_counts {
+  int malloc = 0;      // hipMalloc
+  int free = 0;        // hipFree
+  int memcpy = 0;      // hipMemcpy, and hipMemcpyAsync from or to the host
+  int memset = 0;      // hipMemset
+  int synchronize = 0; // hipDeviceSynchronize, hipStreamSynchronize, hipEventSynchronize
+
+  int total() const { return malloc + free + memcpy + memset + synchronize; }
+};
+
+/*! \brief returns false if the HIP calls cannot be intercepted on this platform */
+bool sync_detector_available();
+
+/*! \brief resets the counts and starts counting the calls made by the current thread */
+void sync_detector_start();
+
+/*! \brief stops counting; the calls made by rocSOLVER since sync_detector_start are
+    returned, and those made by other libraries (i.e. rocBLAS) are added to others */
+sync_counts sync_detector_stop(sync_counts *others = nullptr);
+
+/*! \brief lists the non-zero counts (e.g. "hipMalloc: 1, hipFree: 1") */
+std::string sync_counts_string(const sync_counts &counts);
+
+#endif
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -41,7 +44,6 @@ rocblas_status testing_gelq2_gelqf_strided_batched(Arguments argus) {
     rocblas_int stridep = argus.bsp;
     rocblas_int strideA = argus.bsa;
     rocblas_int batch_count = argus.batch_count;
-    int hot_calls = argus.iters;
 
     std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
     rocblas_handle handle = unique_ptr_handle->handle;
@@ -106,7 +108,12 @@ rocblas_status testing_gelq2_gelqf_strided_batched(Arguments argus) {
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * size_A);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -169,38 +176,34 @@ rocblas_status testing_gelq2_gelqf_strided_batched(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
         if(gelqf) {
-            for(int iter = 0; iter < cold_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_gelqf_strided_batched<T>(handle, M, N, dA, lda, strideA, dIpiv, stridep, batch_count);
-            gpu_time_used = get_time_us();
-            for(int iter = 0; iter < hot_calls; iter++)
-                rocsolver_gelqf_strided_batched<T>(handle, M, N, dA, lda, strideA, dIpiv, stridep, batch_count);
-            gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;
+            }, &inputs);
         }
         else {
-            for(int iter = 0; iter < cold_calls; iter++)
-                rocsolver_gelq2_strided_batched<T>(handle, M, N, dA, lda, strideA, dIpiv, stridep, batch_count);
-            gpu_time_used = get_time_us();
-            for(int iter = 0; iter < hot_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_gelq2_strided_batched<T>(handle, M, N, dA, lda, strideA, dIpiv, stridep, batch_count);
-            gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;
+            }, &inputs);
         }
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "M,N,lda,strideA,strideP,batch_count,gpu_time(us),cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << ",norm_error_host_ptr";
-
-        cout << endl;
-        cout << M << "," << N << "," << lda << "," << strideA << "," << stridep << "," << batch_count << "," << gpu_time_used << ","<< cpu_time_used;
+        bench_row row;
+        row.add("M", M);
+        row.add("N", N);
+        row.add("lda", lda);
+        row.add("strideA", strideA);
+        row.add("strideP", stridep);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * gelqf_flops<T>(M, N), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << "," << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
+#include "cblas_interface.h"
+#include "flops.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the solution
+#define GETRF_ERROR_EPS_MULTIPLIER 3000
+// AS IN THE ORIGINAL ROCSOLVER TEST UNITS, WE CURRENTLY USE A HIGH TOLERANCE
+// AND THE MAX NORM TO EVALUATE THE ERROR. THIS IS NOT "NUMERICALLY SOUND";
+// A MAJOR REFACTORING OF ALL UNIT TESTS WILL BE REQUIRED.
+
+using namespace std;
+
+// **** THIS FUNCTION ONLY TESTS NORMNAL USE CASE
+//      I.E. WHEN STRIDEP >= N ****
+
+template <typename T, typename U> rocblas_status testing_gesv_batched(Arguments argus) {
+
+    rocblas_int N = argus.M;
+    rocblas_int nhrs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int strideP = argus.bsp;
+    rocblas_int batch_count = argus.batch_count;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_B = ldb * max(nhrs, 1);
+    rocblas_int size_P = N;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check here to prevent undefined memory allocation error
+    // (without right hand sides, A is still factorized, so it needs its full size)
+    if (batch_count < 1 || N < 1 || nhrs < 0 || lda < N || ldb < N) {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*)), rocblas_test::device_free};
+        T **dA = (T **)dA_managed.get();
+
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*)), rocblas_test::device_free};
+        T **dB = (T **)dB_managed.get();
+
+        auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+        auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+
+        if (!dA || !dIpiv || !dB || !dInfo) {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocsolver_gesv_batched<T>(handle, N, nhrs, dA, lda, dIpiv, strideP,
+                                         dB, ldb, dInfo, batch_count);
+    }
+
+    size_P += strideP * (batch_count - 1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA[batch_count];
+    vector<T> hB[batch_count];
+    vector<T> hBRes[batch_count];
+    vector<int> hIpiv(size_P);
+    vector<int> hInfo(batch_count);
+    for(int b=0; b < batch_count; ++b) {
+        hA[b] = vector<T>(size_A);
+        hB[b] = vector<T>(size_B);
+        hBRes[b] = vector<T>(size_B);
+    }
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
+    double error_eps_multiplier = GETRF_ERROR_EPS_MULTIPLIER;
+    double eps = std::numeric_limits<U>::epsilon();
+
+    // allocate memory on device
+    T* A[batch_count];
+    T* B[batch_count];
+    for(int b=0; b < batch_count; ++b) {
+        rocblas_test::device_malloc(&A[b], sizeof(T) * size_A);
+        rocblas_test::device_malloc(&B[b], sizeof(T) * size_B);
+    }
+    T **dA, **dB;
+    rocblas_test::device_malloc(&dA,sizeof(T*) * batch_count);
+    rocblas_test::device_malloc(&dB,sizeof(T*) * batch_count);
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * size_P), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+
+    if (!dA || !dIpiv || !dB || !dInfo || !A[batch_count-1] || !B[batch_count-1]) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //  initialize full random matrix h and hB
+    for(int b=0; b < batch_count; ++b) {
+        rocblas_init<T>(hA[b].data(), N, N, lda);
+        rocblas_init<T>(hB[b].data(), N, nhrs, ldb);
+
+        // put it into [0, 1]
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                if (i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    // now copy the matrices to the GPU
+    for(int b=0;b<batch_count;b++) {
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b].data(), sizeof(T)*size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(B[b], hB[b].data(), sizeof(T)*size_B, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, A, sizeof(T*)*batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, B, sizeof(T*)*batch_count, hipMemcpyHostToDevice));
+
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    for(int b=0;b<batch_count;++b) {
+        inputs.add(A[b], sizeof(T) * size_A);
+        inputs.add(B[b], sizeof(T) * size_B);
+    }
+
+    double max_err_1 = 0.0, max_val = 0.0, diff, err;
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    if (argus.unit_check || argus.norm_check) {
+        //GPU lapack
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_batched<T>(handle, N, nhrs, dA, lda, dIpiv, strideP,
+                                                      dB, ldb, dInfo, batch_count));
+        for(int b=0;b<batch_count;b++)
+            CHECK_HIP_ERROR(hipMemcpy(hBRes[b].data(), B[b], sizeof(T) * size_B, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+        //CPU lapack
+        cpu_time_used = get_time_us();
+        for(int b=0; b < batch_count; ++b) {
+            int retCBLAS = 0;
+            cblas_getrf<T>(N, N, hA[b].data(), lda, (hIpiv.data() + b*strideP), &retCBLAS);
+            cblas_getrs<T>('N', N, nhrs, hA[b].data(), lda, (hIpiv.data() + b*strideP), hB[b].data(), ldb);
+        }
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // Error Check
+        for(int b=0; b < batch_count; ++b) {
+#ifdef GOOGLE_TEST
+            EXPECT_EQ(0, hInfo[b]);
+#endif
+            err = 0.0;
+            max_val = 0.0;
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < nhrs; j++) {
+                    diff = abs(hB[b][i + j * ldb]);
+                    max_val = max_val > diff ? max_val : diff;
+                    diff = abs(hBRes[b][i + j * ldb] - hB[b][i + j * ldb]);
+                    err = err > diff ? err : diff;
+                }
+            }
+            if (max_val > 0)
+                err = err / max_val;
+            max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+
+        getrs_err_res_check<U>(max_err_1, N, nhrs, error_eps_multiplier, eps);
+    }
+
+    if (argus.timing) {
+        // GPU rocBLAS
+        gpu_time = bench_time(handle, argus, [&] {
+            rocsolver_gesv_batched<T>(handle, N, nhrs, dA, lda, dIpiv, strideP,
+                                      dB, ldb, dInfo, batch_count);
+        }, &inputs);
+
+        // only norm_check return an norm error, unit check won't return anything
+        bench_row row;
+        row.add("N", N);
+        row.add("nhrs", nhrs);
+        row.add("lda", lda);
+        row.add("strideP", strideP);
+        row.add("ldb", ldb);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * (getrf_flops<T>(N, N) + getrs_flops<T>(N, nhrs)), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
+
+        if (argus.norm_check)
+            row.add("norm_error_host_ptr", max_err_1);
+
+        row.print();
+    }
+
+    for(int b=0;b<batch_count;++b) {
+        rocblas_test::device_free(A[b]);
+        rocblas_test::device_free(B[b]);
+    }
+    rocblas_test::device_free(dA);
+    rocblas_test::device_free(dB);
+
+    return rocblas_status_success;
+}
+
+#undef GETRF_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,269 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
+#include "cblas_interface.h"
+#include "flops.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the solution
+#define GETRF_ERROR_EPS_MULTIPLIER 3000
+// AS IN THE ORIGINAL ROCSOLVER TEST UNITS, WE CURRENTLY USE A HIGH TOLERANCE
+// AND THE MAX NORM TO EVALUATE THE ERROR. THIS IS NOT "NUMERICALLY SOUND";
+// A MAJOR REFACTORING OF ALL UNIT TESTS WILL BE REQUIRED.
+
+using namespace std;
+
+// **** THIS FUNCTION ONLY TESTS NORMNAL USE CASE
+//      I.E. WHEN STRIDEP >= N ****
+
+// if fallback is not zero, the system in the middle of the batch cannot be solved in single
+// precision and it must be solved in double precision with iter = fallback (-2, -3 or -31, see
+// rocblas_init_gesv_mixed_fallback). (The other systems converge, so that the systems solved
+// in double precision are not a prefix of the batch.)
+template <typename T, typename U> rocblas_status testing_gesv_mixed_batched(Arguments argus, rocblas_int fallback = 0) {
+
+    rocblas_int N = argus.M;
+    rocblas_int nhrs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int ldx = argus.ldc;
+    rocblas_int strideP = argus.bsp;
+    rocblas_int batch_count = argus.batch_count;
+    rocblas_int fb = batch_count / 2;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_B = ldb * nhrs;
+    rocblas_int size_X = ldx * nhrs;
+    rocblas_int size_P = N;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check here to prevent undefined memory allocation error
+    if (batch_count < 1 || N < 1 || nhrs < 1 || lda < N || ldb < N || ldx < N) {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*)), rocblas_test::device_free};
+        T **dA = (T **)dA_managed.get();
+
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*)), rocblas_test::device_free};
+        T **dB = (T **)dB_managed.get();
+
+        auto dX_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*)), rocblas_test::device_free};
+        T **dX = (T **)dX_managed.get();
+
+        auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+        auto dIter_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dIter = (rocblas_int *)dIter_managed.get();
+
+        auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+
+        if (!dA || !dIpiv || !dB || !dX || !dIter || !dInfo) {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocsolver_gesv_mixed_batched<T>(handle, N, nhrs, dA, lda, dIpiv, strideP,
+                                               dB, ldb, dX, ldx, dIter, dInfo, batch_count);
+    }
+
+    size_P += strideP * (batch_count - 1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA[batch_count];
+    vector<T> hB[batch_count];
+    vector<T> hXRes[batch_count];
+    vector<int> hIpiv(size_P);
+    vector<int> hIter(batch_count);
+    vector<int> hInfo(batch_count);
+    for(int b=0; b < batch_count; ++b) {
+        hA[b] = vector<T>(size_A);
+        hB[b] = vector<T>(size_B);
+        hXRes[b] = vector<T>(size_X);
+    }
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
+    double error_eps_multiplier = GETRF_ERROR_EPS_MULTIPLIER;
+    double eps = std::numeric_limits<U>::epsilon();
+
+    // allocate memory on device
+    T* A[batch_count];
+    T* B[batch_count];
+    T* X[batch_count];
+    for(int b=0; b < batch_count; ++b) {
+        rocblas_test::device_malloc(&A[b], sizeof(T) * size_A);
+        rocblas_test::device_malloc(&B[b], sizeof(T) * size_B);
+        rocblas_test::device_malloc(&X[b], sizeof(T) * size_X);
+    }
+    T **dA, **dB, **dX;
+    rocblas_test::device_malloc(&dA,sizeof(T*) * batch_count);
+    rocblas_test::device_malloc(&dB,sizeof(T*) * batch_count);
+    rocblas_test::device_malloc(&dX,sizeof(T*) * batch_count);
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * size_P), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    auto dIter_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dIter = (rocblas_int *)dIter_managed.get();
+
+    auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+
+    if (!dA || !dIpiv || !dB || !dX || !dIter || !dInfo || !A[batch_count-1] || !B[batch_count-1] || !X[batch_count-1]) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //  initialize full random matrix h and hB
+    for(int b=0; b < batch_count; ++b) {
+        rocblas_init<T>(hA[b].data(), N, N, lda);
+        rocblas_init<T>(hB[b].data(), N, nhrs, ldb);
+
+        // put it into [0, 1]
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                if (i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    if (fallback)
+        rocblas_init_gesv_mixed_fallback<T>(hA[fb].data(), N, lda, fallback);
+    // (copies to compute the backward error of an ill-conditioned system)
+    vector<T> hA0, hB0;
+    if (fallback == -31) {
+        hA0 = hA[fb];
+        hB0 = hB[fb];
+    }
+
+    // now copy the matrices to the GPU
+    for(int b=0;b<batch_count;b++) {
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b].data(), sizeof(T)*size_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(B[b], hB[b].data(), sizeof(T)*size_B, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, A, sizeof(T*)*batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, B, sizeof(T*)*batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dX, X, sizeof(T*)*batch_count, hipMemcpyHostToDevice));
+
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    for(int b=0;b<batch_count;++b)
+        inputs.add(A[b], sizeof(T) * size_A);
+
+    double max_err_1 = 0.0, max_val = 0.0, diff, err;
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    if (argus.unit_check || argus.norm_check) {
+        //GPU lapack
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_mixed_batched<T>(handle, N, nhrs, dA, lda, dIpiv, strideP,
+                                                            dB, ldb, dX, ldx, dIter, dInfo, batch_count));
+        for(int b=0;b<batch_count;b++)
+            CHECK_HIP_ERROR(hipMemcpy(hXRes[b].data(), X[b], sizeof(T) * size_X, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hIter.data(), dIter, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+        //CPU lapack (the solution is computed in double precision)
+        cpu_time_used = get_time_us();
+        for(int b=0; b < batch_count; ++b) {
+            int retCBLAS = 0;
+            cblas_getrf<T>(N, N, hA[b].data(), lda, (hIpiv.data() + b*strideP), &retCBLAS);
+            cblas_getrs<T>('N', N, nhrs, hA[b].data(), lda, (hIpiv.data() + b*strideP), hB[b].data(), ldb);
+        }
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // Error Check
+        for(int b=0; b < batch_count; ++b) {
+#ifdef GOOGLE_TEST
+            EXPECT_EQ(0, hInfo[b]);
+            if (fallback && b == fb)
+                EXPECT_EQ(fallback, hIter[b]);
+            else
+                EXPECT_GE(hIter[b], 0);
+#endif
+            // (the solution of an ill-conditioned system is checked through its backward error)
+            if (fallback == -31 && b == fb) {
+                err = gesv_backward_error<T>(N, nhrs, hA0.data(), lda, hB0.data(), ldb, hXRes[b].data(), ldx);
+            } else {
+                err = 0.0;
+                max_val = 0.0;
+                for (int i = 0; i < N; i++) {
+                    for (int j = 0; j < nhrs; j++) {
+                        diff = abs(hB[b][i + j * ldb]);
+                        max_val = max_val > diff ? max_val : diff;
+                        diff = abs(hXRes[b][i + j * ldx] - hB[b][i + j * ldb]);
+                        err = err > diff ? err : diff;
+                    }
+                }
+                err = err / max_val;
+            }
+            max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+
+        getrs_err_res_check<U>(max_err_1, N, nhrs, error_eps_multiplier, eps);
+    }
+
+    if (argus.timing) {
+        // GPU rocBLAS
+        gpu_time = bench_time(handle, argus, [&] {
+            rocsolver_gesv_mixed_batched<T>(handle, N, nhrs, dA, lda, dIpiv, strideP,
+                                            dB, ldb, dX, ldx, dIter, dInfo, batch_count);
+        }, &inputs);
+
+        // only norm_check return an norm error, unit check won't return anything
+        bench_row row;
+        row.add("N", N);
+        row.add("nhrs", nhrs);
+        row.add("lda", lda);
+        row.add("strideP", strideP);
+        row.add("ldb", ldb);
+        row.add("ldx", ldx);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * (getrf_flops<T>(N, N) + getrs_flops<T>(N, nhrs)), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
+
+        if (argus.norm_check)
+            row.add("norm_error_host_ptr", max_err_1);
+
+        row.print();
+    }
+
+    for(int b=0;b<batch_count;++b) {
+        rocblas_test::device_free(A[b]);
+        rocblas_test::device_free(B[b]);
+        rocblas_test::device_free(X[b]);
+    }
+    rocblas_test::device_free(dA);
+    rocblas_test::device_free(dB);
+    rocblas_test::device_free(dX);
+
+    return rocblas_status_success;
+}
+
+#undef GETRF_ERROR_EPS_MULTIPLIER
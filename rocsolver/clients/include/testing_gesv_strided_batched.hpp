@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
+#include "cblas_interface.h"
+#include "flops.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the solution
+#define GETRF_ERROR_EPS_MULTIPLIER 3000
+// AS IN THE ORIGINAL ROCSOLVER TEST UNITS, WE CURRENTLY USE A HIGH TOLERANCE 
+// AND THE MAX NORM TO EVALUATE THE ERROR. THIS IS NOT "NUMERICALLY SOUND"; 
+// A MAJOR REFACTORING OF ALL UNIT TESTS WILL BE REQUIRED.  
+
+using namespace std;
+
+// **** THIS FUNCTION ONLY TESTS NORMNAL USE CASE
+//      I.E. WHEN STRIDEA >= LDA*N,
+//      STRIDEB >= LDB*NRHS, AND STRIDEP >= N ****
+
+template <typename T, typename U> rocblas_status testing_gesv_strided_batched(Arguments argus) {
+
+    rocblas_int N = argus.M;
+    rocblas_int nhrs = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int strideA = argus.bsa;
+    rocblas_int strideB = argus.bsb;
+    rocblas_int strideP = argus.bsp;
+    rocblas_int batch_count = argus.batch_count;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_B = ldb * max(nhrs, 1);
+    rocblas_int size_P = N;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check here to prevent undefined memory allocation error
+    // (without right hand sides, A is still factorized, so it needs its full size)
+    if (batch_count < 1 || N < 1 || nhrs < 0 || lda < N || ldb < N) {
+        auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+        T *dA = (T *)dA_managed.get();
+
+        auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T)), rocblas_test::device_free};
+        T *dB = (T *)dB_managed.get();
+
+        auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+        auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+        rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+
+        if (!dA || !dIpiv || !dB || !dInfo) {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+
+        return rocsolver_gesv_strided_batched<T>(handle, N, nhrs, dA, lda, strideA, dIpiv, strideP,
+                                                 dB, ldb, strideB, dInfo, batch_count);
+    }
+
+    size_A += strideA * (batch_count -1);
+    size_B += strideB * (batch_count -1);
+    size_P += strideP * (batch_count -1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hBRes(size_B);
+    vector<int> hIpiv(size_P);
+    vector<int> hInfo(batch_count);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
+    double error_eps_multiplier = GETRF_ERROR_EPS_MULTIPLIER;
+    double eps = std::numeric_limits<U>::epsilon();
+
+    // allocate memory on device
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B), rocblas_test::device_free};
+    T *dB = (T *)dB_managed.get();
+
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * size_P), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  
+    if (!dA || !dIpiv || !dB || !dInfo) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //  initialize full random matrix h and hB 
+    for(int b=0; b < batch_count; ++b) {
+        rocblas_init<T>((hA.data() + b*strideA), N, N, lda);
+        rocblas_init<T>((hB.data() + b*strideB), N, nhrs, ldb);
+
+        // put it into [0, 1]
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                if (i == j)
+                    (hA.data() + b*strideA)[i + j * lda] += 400;
+                else
+                    (hA.data() + b*strideA)[i + j * lda] -= 4;
+            }
+        }
+    }
+
+    // now copy the matrices to the GPU
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * size_A);
+    inputs.add(dB, sizeof(T) * size_B);
+
+    double max_err_1 = 0.0, max_val = 0.0, diff, err;
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    if (argus.unit_check || argus.norm_check) {
+        //GPU lapack
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_strided_batched<T>(handle, N, nhrs, dA, lda, strideA, dIpiv, strideP,
+                                                              dB, ldb, strideB, dInfo, batch_count));
+        CHECK_HIP_ERROR(hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+        //CPU lapack
+        cpu_time_used = get_time_us();
+        for(int b=0; b < batch_count; ++b) {
+            int retCBLAS = 0;
+            cblas_getrf<T>(N, N, (hA.data() + b*strideA), lda, (hIpiv.data() + b*strideP), &retCBLAS);
+            cblas_getrs<T>('N', N, nhrs, (hA.data() + b*strideA), lda, (hIpiv.data() + b*strideP), (hB.data() + b*strideB), ldb);
+        }
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // Error Check
+        for(int b=0; b < batch_count; ++b) {
+#ifdef GOOGLE_TEST
+            EXPECT_EQ(0, hInfo[b]);
+#endif
+            err = 0.0;
+            max_val = 0.0;
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < nhrs; j++) {
+                    diff = abs((hB.data() + b*strideB)[i + j * ldb]);
+                    max_val = max_val > diff ? max_val : diff;
+                    diff = abs((hBRes.data() + b*strideB)[i + j * ldb] - (hB.data() + b*strideB)[i + j * ldb]);
+                    err = err > diff ? err : diff;
+                }
+            }
+            if (max_val > 0)
+                err = err / max_val;
+            max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+
+        getrs_err_res_check<U>(max_err_1, N, nhrs, error_eps_multiplier, eps);
+    }
+
+    if (argus.timing) {
+        // GPU rocBLAS
+        gpu_time = bench_time(handle, argus, [&] {
+            rocsolver_gesv_strided_batched<T>(handle, N, nhrs, dA, lda, strideA, dIpiv, strideP,
+                                              dB, ldb, strideB, dInfo, batch_count);
+        }, &inputs);
+
+        // only norm_check return an norm error, unit check won't return anything
+        bench_row row;
+        row.add("N", N);
+        row.add("nhrs", nhrs);
+        row.add("lda", lda);
+        row.add("strideA", strideA);
+        row.add("strideP", strideP);
+        row.add("ldb", ldb);
+        row.add("strideB", strideB);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * (getrf_flops<T>(N, N) + getrs_flops<T>(N, nhrs)), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
+
+        if (argus.norm_check)
+            row.add("norm_error_host_ptr", max_err_1);
+
+        row.print();
+    }
+    
+    return rocblas_status_success;
+}
+
+#ifdef GOOGLE_TEST
+// The second system of the batch is singular (its column n/2 is zero): gesv must return
+// info = n/2 + 1 for it and leave its right hand sides unchanged, and solve the other systems.
+template <typename T, typename U>
+void testing_gesv_strided_batched_singular(rocblas_int N, rocblas_int nhrs) {
+
+    rocblas_int lda = N;
+    rocblas_int ldb = N;
+    rocblas_int strideA = lda * N;
+    rocblas_int strideB = ldb * nhrs;
+    rocblas_int strideP = N;
+    rocblas_int batch_count = 3;
+    rocblas_int zcol = N / 2;
+
+    rocblas_int size_A = strideA * batch_count;
+    rocblas_int size_B = strideB * batch_count;
+    rocblas_int size_P = strideP * batch_count;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hB0(size_B);
+    vector<T> hBRes(size_B);
+    vector<int> hIpiv(size_P);
+    vector<int> hInfo(batch_count);
+
+    double eps = std::numeric_limits<U>::epsilon();
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B), rocblas_test::device_free};
+    T *dB = (T *)dB_managed.get();
+
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * size_P), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    auto dInfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+
+    ASSERT_TRUE(dA && dB && dIpiv && dInfo);
+
+    for(int b=0; b < batch_count; ++b) {
+        rocblas_init<T>((hA.data() + b*strideA), N, N, lda);
+        rocblas_init<T>((hB.data() + b*strideB), N, nhrs, ldb);
+
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                if (i == j)
+                    (hA.data() + b*strideA)[i + j * lda] += 400;
+                else
+                    (hA.data() + b*strideA)[i + j * lda] -= 4;
+            }
+        }
+    }
+    for (int i = 0; i < N; i++)
+        (hA.data() + strideA)[i + zcol * lda] = 0;
+    hB0 = hB;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    EXPECT_EQ(rocblas_status_success,
+              rocsolver_gesv_strided_batched<T>(handle, N, nhrs, dA, lda, strideA, dIpiv, strideP,
+                                                dB, ldb, strideB, dInfo, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    EXPECT_EQ(0, hInfo[0]);
+    EXPECT_EQ(zcol + 1, hInfo[1]);
+    EXPECT_EQ(0, hInfo[2]);
+
+    // the right hand sides of the singular system are not modified
+    EXPECT_EQ(0, memcmp(hB0.data() + strideB, hBRes.data() + strideB, sizeof(T) * strideB));
+
+    // the other systems are solved
+    double max_err_1 = 0.0, max_val, diff, err;
+    for(int b=0; b < batch_count; b += 2) {
+        int retCBLAS = 0;
+        cblas_getrf<T>(N, N, (hA.data() + b*strideA), lda, (hIpiv.data() + b*strideP), &retCBLAS);
+        cblas_getrs<T>('N', N, nhrs, (hA.data() + b*strideA), lda, (hIpiv.data() + b*strideP), (hB.data() + b*strideB), ldb);
+
+        err = 0.0;
+        max_val = 0.0;
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < nhrs; j++) {
+                diff = abs((hB.data() + b*strideB)[i + j * ldb]);
+                max_val = max_val > diff ? max_val : diff;
+                diff = abs((hBRes.data() + b*strideB)[i + j * ldb] - (hB.data() + b*strideB)[i + j * ldb]);
+                err = err > diff ? err : diff;
+            }
+        }
+        err = err / max_val;
+        max_err_1 = max_err_1 > err ? max_err_1 : err;
+    }
+
+    getrs_err_res_check<U>(max_err_1, N, nhrs, GETRF_ERROR_EPS_MULTIPLIER, eps);
+}
+#endif
+
+#undef GETRF_ERROR_EPS_MULTIPLIER
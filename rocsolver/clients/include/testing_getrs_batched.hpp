@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -41,7 +44,6 @@ template <typename T, typename U> rocblas_status testing_getrs_batched(Arguments
     rocblas_int ldb = argus.ldb;
     rocblas_int strideP = argus.bsp;
     char trans = argus.transA_option;
-    int hot_calls = argus.iters;
     rocblas_int batch_count = argus.batch_count;
 
     rocblas_operation transRoc;
@@ -94,7 +96,8 @@ template <typename T, typename U> rocblas_status testing_getrs_batched(Arguments
         hBRes[b] = vector<T>(size_B);
     }        
 
-    double gpu_time_used, cpu_time_used;
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = GETRF_ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
 
@@ -102,12 +105,12 @@ template <typename T, typename U> rocblas_status testing_getrs_batched(Arguments
     T* A[batch_count];
     T* B[batch_count];
     for(int b=0; b < batch_count; ++b) {
-        hipMalloc(&A[b], sizeof(T) * size_A);
-        hipMalloc(&B[b], sizeof(T) * size_B);
+        rocblas_test::device_malloc(&A[b], sizeof(T) * size_A);
+        rocblas_test::device_malloc(&B[b], sizeof(T) * size_B);
     }
     T **dA, **dB;
-    hipMalloc(&dA,sizeof(T*) * batch_count);
-    hipMalloc(&dB,sizeof(T*) * batch_count);
+    rocblas_test::device_malloc(&dA,sizeof(T*) * batch_count);
+    rocblas_test::device_malloc(&dB,sizeof(T*) * batch_count);
     auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * size_P), rocblas_test::device_free};
     rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
   
@@ -152,6 +155,11 @@ template <typename T, typename U> rocblas_status testing_getrs_batched(Arguments
     CHECK_HIP_ERROR(hipMemcpy(dB, B, sizeof(T*)*batch_count, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * size_P, hipMemcpyHostToDevice));
 
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    for(int b=0;b<batch_count;++b)
+        inputs.add(B[b], sizeof(T) * size_B);
+
     double max_err_1 = 0.0, max_val = 0.0, diff, err;
 
 /* =====================================================================
@@ -191,37 +199,36 @@ template <typename T, typename U> rocblas_status testing_getrs_batched(Arguments
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_getrs_batched<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv, strideP, dB, ldb, batch_count);
-        gpu_time_used = get_time_us(); // in microseconds
-        for(int iter = 0; iter < hot_calls; iter++)
-            rocsolver_getrs_batched<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv, strideP, dB, ldb, batch_count);
-        gpu_time_used = get_time_us() - gpu_time_used;
+        }, &inputs);
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "trans , M , nhrs , lda , strideP , ldb , batch_count , us [gpu] , us [cpu]";
-
-        if (argus.norm_check)
-            cout << ", norm_error_host_ptr";
-
-        cout << endl;
-
-        cout << trans << " , " << M << " , " << nhrs << " , " << lda << " , " << strideP << " , " << ldb << " , " << batch_count << " , " << gpu_time_used << " , " << cpu_time_used;
+        bench_row row;
+        row.add("trans", trans);
+        row.add("M", M);
+        row.add("nhrs", nhrs);
+        row.add("lda", lda);
+        row.add("strideP", strideP);
+        row.add("ldb", ldb);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * getrs_flops<T>(M, nhrs), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << " , " << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
 
     for(int b=0;b<batch_count;++b) {
-        hipFree(A[b]);
-        hipFree(B[b]);
+        rocblas_test::device_free(A[b]);
+        rocblas_test::device_free(B[b]);
     }
-    hipFree(dA);
-    hipFree(dB);
+    rocblas_test::device_free(dA);
+    rocblas_test::device_free(dB);
     
     return rocblas_status_success;
 }
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -43,7 +46,6 @@ template <typename T, typename U> rocblas_status testing_getrs_strided_batched(A
     rocblas_int strideB = argus.bsb;
     rocblas_int strideP = argus.bsp;
     char trans = argus.transA_option;
-    int hot_calls = argus.iters;
     rocblas_int batch_count = argus.batch_count;
 
     rocblas_operation transRoc;
@@ -93,7 +95,8 @@ template <typename T, typename U> rocblas_status testing_getrs_strided_batched(A
     vector<int> hIpiv(size_P);
     vector<T> hBRes(size_B);
 
-    double gpu_time_used, cpu_time_used;
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = GETRF_ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
 
@@ -145,6 +148,10 @@ template <typename T, typename U> rocblas_status testing_getrs_strided_batched(A
     CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * size_P, hipMemcpyHostToDevice));
 
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dB, sizeof(T) * size_B);
+
     double max_err_1 = 0.0, max_val = 0.0, diff, err;
 
 /* =====================================================================
@@ -183,29 +190,30 @@ template <typename T, typename U> rocblas_status testing_getrs_strided_batched(A
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_getrs_strided_batched<T>(handle, transRoc, M, nhrs, dA, lda, strideA, dIpiv, strideP, dB, ldb, strideB, batch_count);
-        gpu_time_used = get_time_us(); // in microseconds
-        for(int iter = 0; iter < hot_calls; iter++)
-            rocsolver_getrs_strided_batched<T>(handle, transRoc, M, nhrs, dA, lda, strideA, dIpiv, strideP, dB, ldb, strideB, batch_count);
-        gpu_time_used = get_time_us() - gpu_time_used;
+        }, &inputs);
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "trans , M , nhrs , lda , strideA , strideP , ldb , strideB , batch_count , us [gpu] , us [cpu]";
-
-        if (argus.norm_check)
-            cout << ", norm_error_host_ptr";
-
-        cout << endl;
-
-        cout << trans << " , " << M << " , " << nhrs << " , " << lda << " , " << strideA << " , " << strideP << " , " << ldb << " , " << strideB << " , " << batch_count << " , " << gpu_time_used << " , " << cpu_time_used;
+        bench_row row;
+        row.add("trans", trans);
+        row.add("M", M);
+        row.add("nhrs", nhrs);
+        row.add("lda", lda);
+        row.add("strideA", strideA);
+        row.add("strideP", strideP);
+        row.add("ldb", ldb);
+        row.add("strideB", strideB);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * getrs_flops<T>(M, nhrs), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << " , " << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
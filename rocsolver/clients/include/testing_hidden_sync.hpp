@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "rocsolver.hpp"
+#include "rocblas_test_unique_ptr.hpp"
+#include "sync_detector.h"
+#include "utility.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+// Every rocSOLVER call must be asynchronous: once a first call has grown the memory
+// pools of the handle (and the workspace of rocBLAS), an identical call must not make
+// any HIP call that synchronizes the host with the device.
+
+// device data for batch_count matrices of size ld-by-ld (so that every routine can use
+// them as m-by-n, n-by-n or n-by-nrhs matrices), with their pivots, Householder scalars
+// and info, and the arrays of pointers for the batched routines. (C is only used by the
+// routines with three matrix arguments.)
+template <typename T> struct hidden_sync_data {
+  rocblas_int ld, batch_count;
+  rocblas_int stride;
+  vector<T> hA;
+  vector<rocblas_int> hIpiv;
+  vector<rocblas_unique_ptr> buffers;
+  T *A, *B, *C, *tau;
+  T **Aarray, **Barray;
+  rocblas_int *ipiv, *info;
+
+  hidden_sync_data(rocblas_int ld, rocblas_int batch_count)
+      : ld(ld), batch_count(batch_count), stride(ld * ld),
+        hA(size_t(ld) * ld * batch_count), hIpiv(size_t(ld) * batch_count) {
+    A = (T *)alloc(sizeof(T) * hA.size());
+    B = (T *)alloc(sizeof(T) * hA.size());
+    C = (T *)alloc(sizeof(T) * hA.size());
+    tau = (T *)alloc(sizeof(T) * ld * batch_count);
+    ipiv = (rocblas_int *)alloc(sizeof(rocblas_int) * ld * batch_count);
+    info = (rocblas_int *)alloc(sizeof(rocblas_int) * batch_count);
+    Aarray = (T **)alloc(sizeof(T *) * batch_count);
+    Barray = (T **)alloc(sizeof(T *) * batch_count);
+
+    // symmetric and diagonally dominant, thus suitable for all the factorizations
+    for (rocblas_int b = 0; b < batch_count; ++b) {
+      for (rocblas_int j = 0; j < ld; ++j) {
+        for (rocblas_int i = 0; i < ld; ++i)
+          hA[b * stride + i + j * ld] =
+              i == j ? T(ld + 1) : T(1.0 / (1 + abs(i - j)));
+      }
+    }
+
+    // (no row is interchanged by the pivots)
+    for (size_t i = 0; i < hIpiv.size(); ++i)
+      hIpiv[i] = i % ld + 1;
+
+    vector<T *> hAarray(batch_count), hBarray(batch_count);
+    for (rocblas_int b = 0; b < batch_count; ++b) {
+      hAarray[b] = A + b * stride;
+      hBarray[b] = B + b * stride;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(Aarray, hAarray.data(), sizeof(T *) * batch_count,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(Barray, hBarray.data(), sizeof(T *) * batch_count,
+                              hipMemcpyHostToDevice));
+    reset();
+  }
+
+  void *alloc(size_t size) {
+    buffers.emplace_back(rocblas_test::device_malloc(size), rocblas_test::device_free);
+    return buffers.back().get();
+  }
+
+  // restores the initial matrices (the factorizations overwrite them)
+  void reset() {
+    CHECK_HIP_ERROR(hipMemcpy(A, hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(B, hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(C, hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(tau, 0, sizeof(T) * ld * batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(ipiv, hIpiv.data(), sizeof(rocblas_int) * hIpiv.size(),
+                              hipMemcpyHostToDevice));
+  }
+};
+
+// (lacgv only exists for complex types)
+template <typename T>
+rocblas_status hidden_sync_lacgv(rocblas_handle handle, rocblas_int n, T *x) {
+  return rocblas_status_not_implemented;
+}
+
+inline rocblas_status hidden_sync_lacgv(rocblas_handle handle, rocblas_int n,
+                                        rocblas_float_complex *x) {
+  return rocsolver_lacgv(handle, n, x, 1);
+}
+
+inline rocblas_status hidden_sync_lacgv(rocblas_handle handle, rocblas_int n,
+                                        rocblas_double_complex *x) {
+  return rocsolver_lacgv(handle, n, x, 1);
+}
+
+// calls the routine on the data
+template <typename T>
+rocblas_status hidden_sync_call(rocblas_handle handle, const string &routine,
+                                rocblas_int m, rocblas_int n,
+                                hidden_sync_data<T> &d) {
+  const rocblas_int ld = d.ld, bc = d.batch_count, st = d.stride;
+  const rocblas_int nrhs = 4;
+  const rocblas_int mx = max(m, n), mn = min(m, n);
+  const rocblas_fill uplo = rocblas_fill_upper;
+  const rocblas_operation trans = rocblas_operation_none;
+  const rocblas_side side = rocblas_side_left;
+  const rocblas_direct direct = rocblas_forward_direction;
+  const rocblas_storev storev = rocblas_column_wise;
+
+  // auxiliaries (on the first matrix; the Householder vectors are the columns of A)
+  if (routine == "lacgv")
+    return hidden_sync_lacgv(handle, mx, d.A);
+  if (routine == "laswp")
+    return rocsolver_laswp<T>(handle, n, d.A, ld, 1, mn, d.ipiv, 1);
+  if (routine == "larfg")
+    return rocsolver_larfg<T>(handle, mx, d.A, d.A + 1, 1, d.tau);
+  if (routine == "larf")
+    return rocsolver_larf<T>(handle, side, mx, mn, d.A, 1, d.tau, d.B, ld);
+  if (routine == "larft")
+    return rocsolver_larft<T>(handle, direct, storev, mx, mn, d.A, ld, d.tau, d.B, ld);
+  if (routine == "larfb")
+    return rocsolver_larfb<T>(handle, side, trans, direct, storev, mx, mn, mn, d.A, ld,
+                              d.B, ld, d.C, ld);
+
+  if (routine == "getf2")
+    return rocsolver_getf2<T>(handle, m, n, d.A, ld, d.ipiv, d.info);
+  if (routine == "getf2_batched")
+    return rocsolver_getf2_batched<T>(handle, m, n, d.Aarray, ld, d.ipiv, ld, d.info, bc);
+  if (routine == "getf2_strided_batched")
+    return rocsolver_getf2_strided_batched<T>(handle, m, n, d.A, ld, st, d.ipiv, ld, d.info, bc);
+  if (routine == "getrf")
+    return rocsolver_getrf<T>(handle, m, n, d.A, ld, d.ipiv, d.info);
+  if (routine == "getrf_batched")
+    return rocsolver_getrf_batched<T>(handle, m, n, d.Aarray, ld, d.ipiv, ld, d.info, bc);
+  if (routine == "getrf_strided_batched")
+    return rocsolver_getrf_strided_batched<T>(handle, m, n, d.A, ld, st, d.ipiv, ld, d.info, bc);
+
+  if (routine == "potf2")
+    return rocsolver_potf2<T>(handle, uplo, n, d.A, ld, d.info);
+  if (routine == "potf2_batched")
+    return rocsolver_potf2_batched<T>(handle, uplo, n, d.Aarray, ld, d.info, bc);
+  if (routine == "potf2_strided_batched")
+    return rocsolver_potf2_strided_batched<T>(handle, uplo, n, d.A, ld, st, d.info, bc);
+  if (routine == "potrf")
+    return rocsolver_potrf<T>(handle, uplo, n, d.A, ld, d.info);
+  if (routine == "potrf_batched")
+    return rocsolver_potrf_batched<T>(handle, uplo, n, d.Aarray, ld, d.info, bc);
+  if (routine == "potrf_strided_batched")
+    return rocsolver_potrf_strided_batched<T>(handle, uplo, n, d.A, ld, st, d.info, bc);
+
+  if (routine == "getrs")
+    return rocsolver_getrs<T>(handle, trans, n, nrhs, d.A, ld, d.ipiv, d.B, ld);
+  if (routine == "getrs_batched")
+    return rocsolver_getrs_batched<T>(handle, trans, n, nrhs, d.Aarray, ld, d.ipiv, ld,
+                                      d.Barray, ld, bc);
+  if (routine == "getrs_strided_batched")
+    return rocsolver_getrs_strided_batched<T>(handle, trans, n, nrhs, d.A, ld, st, d.ipiv,
+                                              ld, d.B, ld, st, bc);
+
+  if (routine == "gesv")
+    return rocsolver_gesv<T>(handle, n, nrhs, d.A, ld, d.ipiv, d.B, ld, d.info);
+  if (routine == "gesv_batched")
+    return rocsolver_gesv_batched<T>(handle, n, nrhs, d.Aarray, ld, d.ipiv, ld,
+                                     d.Barray, ld, d.info, bc);
+  if (routine == "gesv_strided_batched")
+    return rocsolver_gesv_strided_batched<T>(handle, n, nrhs, d.A, ld, st, d.ipiv, ld,
+                                             d.B, ld, st, d.info, bc);
+
+  if (routine == "geqr2")
+    return rocsolver_geqr2<T>(handle, m, n, d.A, ld, d.tau);
+  if (routine == "geqr2_batched")
+    return rocsolver_geqr2_batched<T>(handle, m, n, d.Aarray, ld, d.tau, ld, bc);
+  if (routine == "geqr2_strided_batched")
+    return rocsolver_geqr2_strided_batched<T>(handle, m, n, d.A, ld, st, d.tau, ld, bc);
+  if (routine == "geqrf")
+    return rocsolver_geqrf<T>(handle, m, n, d.A, ld, d.tau);
+  if (routine == "geqrf_batched")
+    return rocsolver_geqrf_batched<T>(handle, m, n, d.Aarray, ld, d.tau, ld, bc);
+  if (routine == "geqrf_strided_batched")
+    return rocsolver_geqrf_strided_batched<T>(handle, m, n, d.A, ld, st, d.tau, ld, bc);
+
+  if (routine == "gelq2")
+    return rocsolver_gelq2<T>(handle, m, n, d.A, ld, d.tau);
+  if (routine == "gelq2_batched")
+    return rocsolver_gelq2_batched<T>(handle, m, n, d.Aarray, ld, d.tau, ld, bc);
+  if (routine == "gelq2_strided_batched")
+    return rocsolver_gelq2_strided_batched<T>(handle, m, n, d.A, ld, st, d.tau, ld, bc);
+  if (routine == "gelqf")
+    return rocsolver_gelqf<T>(handle, m, n, d.A, ld, d.tau);
+  if (routine == "gelqf_batched")
+    return rocsolver_gelqf_batched<T>(handle, m, n, d.Aarray, ld, d.tau, ld, bc);
+  if (routine == "gelqf_strided_batched")
+    return rocsolver_gelqf_strided_batched<T>(handle, m, n, d.A, ld, st, d.tau, ld, bc);
+
+  // (Q is mx-by-mn, or mn-by-mx for the LQ routines, with mn Householder reflectors)
+  if (routine == "org2r")
+    return rocsolver_org2r_ung2r<T>(handle, mx, mn, mn, d.A, ld, d.tau);
+  if (routine == "orgqr")
+    return rocsolver_orgqr_ungqr<T>(handle, mx, mn, mn, d.A, ld, d.tau);
+  if (routine == "orgl2")
+    return rocsolver_orgl2_ungl2<T>(handle, mn, mx, mn, d.A, ld, d.tau);
+  if (routine == "orglq")
+    return rocsolver_orglq_unglq<T>(handle, mn, mx, mn, d.A, ld, d.tau);
+  if (routine == "orgbr")
+    return rocsolver_orgbr_ungbr<T>(handle, storev, mx, mn, mn, d.A, ld, d.tau);
+  if (routine == "orm2r")
+    return rocsolver_orm2r_unm2r<T>(handle, side, trans, mx, mn, mn, d.A, ld, d.tau, d.B, ld);
+  if (routine == "ormqr")
+    return rocsolver_ormqr_unmqr<T>(handle, side, trans, mx, mn, mn, d.A, ld, d.tau, d.B, ld);
+  if (routine == "orml2")
+    return rocsolver_orml2_unml2<T>(handle, side, trans, mx, mn, mn, d.A, ld, d.tau, d.B, ld);
+  if (routine == "ormlq")
+    return rocsolver_ormlq_unmlq<T>(handle, side, trans, mx, mn, mn, d.A, ld, d.tau, d.B, ld);
+  if (routine == "ormbr")
+    return rocsolver_ormbr_unmbr<T>(handle, storev, side, trans, mx, mn, mn, d.A, ld, d.tau,
+                                    d.B, ld);
+
+  throw runtime_error("Unknown routine " + routine);
+}
+
+template <typename T>
+rocblas_status testing_hidden_sync(const string &routine, rocblas_int m,
+                                   rocblas_int n, rocblas_int batch_count) {
+  if (!sync_detector_available())
+    return rocblas_status_not_implemented;
+  if (routine == "lacgv" && !is_complex<T>)
+    return rocblas_status_not_implemented;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // (the calls are queued on a stream of their own, not on the null stream)
+  hipStream_t stream;
+  CHECK_HIP_ERROR(hipStreamCreate(&stream));
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+  hidden_sync_data<T> d(max(m, n), batch_count);
+
+  // warm-up call
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  CHECK_HIP_ERROR(hipDeviceSynchronize());
+  d.reset();
+
+  sync_counts others;
+  sync_detector_start();
+  rocblas_status status = hidden_sync_call<T>(handle, routine, m, n, d);
+  sync_counts counts = sync_detector_stop(&others);
+  CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+  EXPECT_EQ(rocblas_status_success, status);
+  EXPECT_EQ(0, counts.total()) << "hidden synchronizations in " << routine
+                               << ": " << sync_counts_string(counts);
+  // (the synchronizations of rocBLAS are reported, but do not fail the test)
+  if (others.total())
+    ::testing::Test::RecordProperty("rocblas_syncs", sync_counts_string(others));
+
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+  CHECK_HIP_ERROR(hipStreamDestroy(stream));
+  return status;
+}
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -33,7 +36,6 @@ rocblas_status testing_lacgv(Arguments argus) {
     rocblas_int N = argus.N;
     rocblas_int lda = abs(argus.incx);
     rocblas_int inc = argus.incx;
-    int hot_calls = argus.iters;
     
     std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
     rocblas_handle handle = unique_ptr_handle->handle;
@@ -72,7 +74,12 @@ rocblas_status testing_lacgv(Arguments argus) {
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * size_A);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double max_err_1 = 0.0, diff;
 
 /* =====================================================================
@@ -100,28 +107,23 @@ rocblas_status testing_lacgv(Arguments argus) {
     }
 
     if (argus.timing) {
-        int cold_calls = 2;
-
-            for(int iter = 0; iter < cold_calls; iter++)
-                rocsolver_lacgv<T>(handle,N,dA,inc);
-            gpu_time_used = get_time_us();
-            for(int iter = 0; iter < hot_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_lacgv<T>(handle,N,dA,inc);
-            gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+            }, &inputs);
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "N,inc,gpu_time(us),cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << ",norm_error_host_ptr";
-
-        cout << endl;
-        cout << N << "," << inc << "," << gpu_time_used << ","<< cpu_time_used;
+        bench_row row;
+        row.add("N", N);
+        row.add("inc", inc);
+        gpu_time.add_to(row);
+        bench_add_bandwidth(row, argus, lacgv_bytes<T>(N), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << "," << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
 
     return rocblas_status_success;
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -35,7 +38,6 @@ rocblas_status testing_larf(Arguments argus) {
     rocblas_int incx = argus.incx;
     rocblas_int lda = argus.lda;
     char sideC = argus.side_option;    
-    int hot_calls = argus.iters;
     rocblas_side side;
 
     std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
@@ -114,7 +116,12 @@ rocblas_status testing_larf(Arguments argus) {
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * sizeA, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * sizeA);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -154,28 +161,26 @@ rocblas_status testing_larf(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
-            rocsolver_larf<T>(handle, side, M, N, dx, incx, dalpha, dA, lda);
-        gpu_time_used = get_time_us();
-        for(int iter = 0; iter < hot_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_larf<T>(handle, side, M, N, dx, incx, dalpha, dA, lda);
-        gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+        }, &inputs);
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "M,N,incx,lda,gpu_time(us),cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << ",norm_error_host_ptr";
-
-        cout << endl;
-        cout << M << "," << N << "," << incx << "," << lda << "," << gpu_time_used << "," << cpu_time_used;
+        bench_row row;
+        row.add("M", M);
+        row.add("N", N);
+        row.add("incx", incx);
+        row.add("lda", lda);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, larf_flops<T>(sideC == 'L', M, N), gpu_time.mean);
+        bench_add_bandwidth(row, argus, larf_bytes<T>(sideC == 'L', M, N), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << "," << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -41,7 +44,6 @@ rocblas_status testing_larfb(Arguments argus)
     char directC = argus.direct_option;
     char transC = argus.transH_option;
     char storevC = argus.storev;  
-    int hot_calls = argus.iters;
     
     rocblas_side side;
     rocblas_direct direct;
@@ -205,7 +207,12 @@ rocblas_status testing_larfb(Arguments argus)
     CHECK_HIP_ERROR(hipMemcpy(dF, hF.data(), sizeof(T) * sizeF, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * sizeA, hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * sizeA);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -245,28 +252,31 @@ rocblas_status testing_larfb(Arguments argus)
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
-            rocsolver_larfb<T>(handle, side, trans, direct, storev, M, N, K, dV, ldv, dF, ldt, dA, lda);
-        gpu_time_used = get_time_us();
-        for(int iter = 0; iter < hot_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_larfb<T>(handle, side, trans, direct, storev, M, N, K, dV, ldv, dF, ldt, dA, lda);
-        gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;
+        }, &inputs);
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "side,trans,direct,storev,M,N,K,ldv,ldt,lda,gpu_time(us),cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << ",norm_error_host_ptr";
-
-        cout << endl;
-        cout << sideC << "," << transC << "," << directC << "," << storev << "," << M << "," << N << "," << K << "," << ldv << "," << ldt << "," << lda << "," << gpu_time_used << "," << cpu_time_used;
+        bench_row row;
+        row.add("side", sideC);
+        row.add("trans", transC);
+        row.add("direct", directC);
+        row.add("storev", storev);
+        row.add("M", M);
+        row.add("N", N);
+        row.add("K", K);
+        row.add("ldv", ldv);
+        row.add("ldt", ldt);
+        row.add("lda", lda);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, larfb_flops<T>(sideC == 'L', M, N, K), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << "," << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
    
     return rocblas_status_success;
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -33,7 +36,6 @@ template <typename T, typename U>
 rocblas_status testing_larfg(Arguments argus) {
     rocblas_int N = argus.N;
     rocblas_int incx = argus.incx;
-    int hot_calls = argus.iters;
     rocblas_int safe_size = 100; // arbitrarily set to 100
     rocblas_status status;
 
@@ -89,7 +91,13 @@ rocblas_status testing_larfg(Arguments argus) {
     CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizex, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dx, sizeof(T) * sizex);
+    inputs.add(dalpha, sizeof(T));
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -139,28 +147,24 @@ rocblas_status testing_larfg(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
-            rocsolver_larfg<T>(handle, N, dalpha, dx, incx, dtau);
-        gpu_time_used = get_time_us();
-        for(int iter = 0; iter < hot_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_larfg<T>(handle, N, dalpha, dx, incx, dtau);
-        gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+        }, &inputs);
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "N,incx,gpu_time(us),cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << ",norm_error_host_ptr";
-
-        cout << endl;
-        cout << N << "," << incx << "," << gpu_time_used << ","<< cpu_time_used;
+        bench_row row;
+        row.add("N", N);
+        row.add("incx", incx);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, larfg_flops<T>(N), gpu_time.mean);
+        bench_add_bandwidth(row, argus, larfg_bytes<T>(N), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << "," << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
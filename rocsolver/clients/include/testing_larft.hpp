@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -37,7 +40,6 @@ rocblas_status testing_larft(Arguments argus)
     rocblas_int ldt = argus.ldt;
     char directchar = argus.direct_option;  
     char storevchar = argus.storev;  
-    int hot_calls = argus.iters;
     rocblas_direct direct;
     rocblas_storev storev;
 
@@ -132,7 +134,8 @@ rocblas_status testing_larft(Arguments argus)
     CHECK_HIP_ERROR(hipMemcpy(dV, hV.data(), sizeof(T) * sizeV, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dtau, htau.data(), sizeof(T) * K, hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -174,28 +177,27 @@ rocblas_status testing_larft(Arguments argus)
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
-            rocsolver_larft<T>(handle, direct, storev, N, K, dV, ldv, dtau, dF, ldt);
-        gpu_time_used = get_time_us();
-        for(int iter = 0; iter < hot_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_larft<T>(handle, direct, storev, N, K, dV, ldv, dtau, dF, ldt);
-        gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+        });
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "direct,storev,N,K,ldv,ldt,gpu_time(us),cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << ",norm_error_host_ptr";
-
-        cout << endl;
-        cout << directchar << "," << storevchar << "," << N << "," << K << "," << ldv << "," << ldt << "," << gpu_time_used << "," << cpu_time_used;
+        bench_row row;
+        row.add("direct", directchar);
+        row.add("storev", storevchar);
+        row.add("N", N);
+        row.add("K", K);
+        row.add("ldv", ldv);
+        row.add("ldt", ldt);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, larft_flops<T>(N, K), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << "," << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -36,7 +39,6 @@ rocblas_status testing_orgbr_ungbr(Arguments argus) {
     rocblas_storev storev;
     char storevC = argus.storev;
     rocblas_int lda = argus.lda;
-    int hot_calls = argus.iters;
 
     std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
     rocblas_handle handle = unique_ptr_handle->handle;
@@ -132,7 +134,12 @@ rocblas_status testing_orgbr_ungbr(Arguments argus) {
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv.data(), sizeof(T) * size_P, hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * size_A);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -173,28 +180,29 @@ rocblas_status testing_orgbr_ungbr(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
-        for(int iter = 0; iter < cold_calls; iter++)
-            rocsolver_orgbr_ungbr<T>(handle, storev, M, N, K, dA, lda, dIpiv);
-        gpu_time_used = get_time_us();
-        for(int iter = 0; iter < hot_calls; iter++)
+        gpu_time = bench_time(handle, argus, [&] {
             rocsolver_orgbr_ungbr<T>(handle, storev, M, N, K, dA, lda, dIpiv);
-        gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+        }, &inputs);
         
         // only norm_check return an norm error, unit check won't return anything
-        cout << "storev, M , N , K , lda , gpu_time(us) , cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << " , norm_error_host_ptr";
-
-        cout << endl;
-        cout << storevC << " , " << M << " , " << N << " , " << K << " , " << lda << " , " << gpu_time_used << " , "<< cpu_time_used;
+        bench_row row;
+        row.add("storev", storevC);
+        row.add("M", M);
+        row.add("N", N);
+        row.add("K", K);
+        row.add("lda", lda);
+        gpu_time.add_to(row);
+        if (storevC == 'C')
+            bench_add_gflops(row, argus, orgqr_flops<T>(M, N, min(N, K)), gpu_time.mean);
+        else
+            bench_add_gflops(row, argus, orglq_flops<T>(M, N, min(M, K)), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << " , " << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
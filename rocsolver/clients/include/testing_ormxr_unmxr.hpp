@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -35,7 +38,6 @@ rocblas_status testing_ormxr_unmxr(Arguments argus) {
     rocblas_int K = argus.K;
     rocblas_int lda = argus.lda;
     rocblas_int ldc = argus.ldc;
-    int hot_calls = argus.iters;
     char sideC = argus.side_option;
     char transA = argus.transA_option;
 
@@ -143,7 +145,12 @@ rocblas_status testing_ormxr_unmxr(Arguments argus) {
     CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * size_C, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv.data(), sizeof(T) * size_P, hipMemcpyHostToDevice));
 
-    double gpu_time_used, cpu_time_used;
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dC, sizeof(T) * size_C);
+
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double max_err_1 = 0.0, max_val = 0.0;
@@ -193,38 +200,35 @@ rocblas_status testing_ormxr_unmxr(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-
         if(mqr) {
-            for(int iter = 0; iter < cold_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_ormqr_unmqr<T>(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc);
-            gpu_time_used = get_time_us();
-            for(int iter = 0; iter < hot_calls; iter++)
-                rocsolver_ormqr_unmqr<T>(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc);
-            gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+            }, &inputs);
         }
         else {
-            for(int iter = 0; iter < cold_calls; iter++)
-                rocsolver_orm2r_unm2r<T>(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc);
-            gpu_time_used = get_time_us();
-            for(int iter = 0; iter < hot_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_orm2r_unm2r<T>(handle, side, trans, M, N, K, dA, lda, dIpiv, dC, ldc);
-            gpu_time_used = (get_time_us() - gpu_time_used) / hot_calls;       
+            }, &inputs);
         }
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "side, trans, M , N , K , lda , ldc , gpu_time(us) , cpu_time(us)";
-
-        if (argus.norm_check)
-            cout << " , norm_error_host_ptr";
-
-        cout << endl;
-        cout << sideC << " , " << transA << " , " << M << " , " << N << " , " << K << " , " << lda << " , " << ldc << " , " << gpu_time_used << " , "<< cpu_time_used;
+        bench_row row;
+        row.add("side", sideC);
+        row.add("trans", transA);
+        row.add("M", M);
+        row.add("N", N);
+        row.add("K", K);
+        row.add("lda", lda);
+        row.add("ldc", ldc);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, ormqr_flops<T>(sideC == 'L', M, N, K), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << " , " << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl;
+        row.print();
     }
     
     return rocblas_status_success;
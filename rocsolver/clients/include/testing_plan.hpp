@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "testing_hidden_sync.hpp"
+
+using namespace std;
+
+// The execution of a plan must give the same results as a call to its routine with the
+// same arguments, on whichever stream it is queued.
+
+// creates a plan for the routine with the arguments of hidden_sync_call
+template <typename T>
+rocblas_status plan_create(rocblas_handle handle, const string &routine, rocblas_int m,
+                           rocblas_int n, hidden_sync_data<T> &d, rocsolver_plan *plan) {
+  const rocblas_int ld = d.ld, bc = d.batch_count, st = d.stride;
+  const rocblas_int nrhs = 4;
+  const rocblas_fill uplo = rocblas_fill_upper;
+  const rocblas_operation trans = rocblas_operation_none;
+
+  if (routine == "getrf")
+    return rocsolver_getrf_plan_create<T>(handle, m, n, ld, plan);
+  if (routine == "getrf_batched")
+    return rocsolver_getrf_batched_plan_create<T>(handle, m, n, ld, ld, bc, plan);
+  if (routine == "getrf_strided_batched")
+    return rocsolver_getrf_strided_batched_plan_create<T>(handle, m, n, ld, st, ld, bc, plan);
+  if (routine == "potrf")
+    return rocsolver_potrf_plan_create<T>(handle, uplo, n, ld, plan);
+  if (routine == "potrf_batched")
+    return rocsolver_potrf_batched_plan_create<T>(handle, uplo, n, ld, bc, plan);
+  if (routine == "potrf_strided_batched")
+    return rocsolver_potrf_strided_batched_plan_create<T>(handle, uplo, n, ld, st, bc, plan);
+  if (routine == "geqrf")
+    return rocsolver_geqrf_plan_create<T>(handle, m, n, ld, plan);
+  if (routine == "geqrf_batched")
+    return rocsolver_geqrf_batched_plan_create<T>(handle, m, n, ld, ld, bc, plan);
+  if (routine == "geqrf_strided_batched")
+    return rocsolver_geqrf_strided_batched_plan_create<T>(handle, m, n, ld, st, ld, bc, plan);
+  if (routine == "getrs")
+    return rocsolver_getrs_plan_create<T>(handle, trans, n, nrhs, ld, ld, plan);
+  if (routine == "getrs_batched")
+    return rocsolver_getrs_batched_plan_create<T>(handle, trans, n, nrhs, ld, ld, ld, bc, plan);
+  if (routine == "getrs_strided_batched")
+    return rocsolver_getrs_strided_batched_plan_create<T>(handle, trans, n, nrhs, ld, st, ld, ld, st,
+                                                          bc, plan);
+
+  throw runtime_error("Unknown routine " + routine);
+}
+
+// executes the plan on the data (the batched routines take the arrays of pointers of the
+// data, thus every data is a different set of pointers for the graphs of a plan)
+template <typename T>
+rocblas_status plan_execute(rocsolver_plan plan, const string &routine, hidden_sync_data<T> &d) {
+  if (routine == "getrf")
+    return rocsolver_getrf_plan_execute<T>(plan, d.A, d.ipiv, d.info);
+  if (routine == "getrf_batched")
+    return rocsolver_getrf_batched_plan_execute<T>(plan, d.Aarray, d.ipiv, d.info);
+  if (routine == "getrf_strided_batched")
+    return rocsolver_getrf_strided_batched_plan_execute<T>(plan, d.A, d.ipiv, d.info);
+  if (routine == "potrf")
+    return rocsolver_potrf_plan_execute<T>(plan, d.A, d.info);
+  if (routine == "potrf_batched")
+    return rocsolver_potrf_batched_plan_execute<T>(plan, d.Aarray, d.info);
+  if (routine == "potrf_strided_batched")
+    return rocsolver_potrf_strided_batched_plan_execute<T>(plan, d.A, d.info);
+  if (routine == "geqrf")
+    return rocsolver_geqrf_plan_execute<T>(plan, d.A, d.tau);
+  if (routine == "geqrf_batched")
+    return rocsolver_geqrf_batched_plan_execute<T>(plan, d.Aarray, d.tau);
+  if (routine == "geqrf_strided_batched")
+    return rocsolver_geqrf_strided_batched_plan_execute<T>(plan, d.A, d.tau);
+  if (routine == "getrs")
+    return rocsolver_getrs_plan_execute<T>(plan, d.A, d.ipiv, d.B);
+  if (routine == "getrs_batched")
+    return rocsolver_getrs_batched_plan_execute<T>(plan, d.Aarray, d.ipiv, d.Barray);
+  if (routine == "getrs_strided_batched")
+    return rocsolver_getrs_strided_batched_plan_execute<T>(plan, d.A, d.ipiv, d.B);
+
+  throw runtime_error("Unknown routine " + routine);
+}
+
+// copies all the outputs of the data to the host (as bytes)
+template <typename T>
+vector<char> plan_result(hidden_sync_data<T> &d) {
+  const size_t sA = sizeof(T) * d.hA.size();
+  const size_t st = sizeof(T) * d.ld * d.batch_count;
+  const size_t sp = sizeof(rocblas_int) * d.ld * d.batch_count;
+  const size_t si = sizeof(rocblas_int) * d.batch_count;
+  vector<char> h(2 * sA + st + sp + si);
+  CHECK_HIP_ERROR(hipDeviceSynchronize());
+  CHECK_HIP_ERROR(hipMemcpy(h.data(), d.A, sA, hipMemcpyDeviceToHost));
+  CHECK_HIP_ERROR(hipMemcpy(h.data() + sA, d.B, sA, hipMemcpyDeviceToHost));
+  CHECK_HIP_ERROR(hipMemcpy(h.data() + 2 * sA, d.tau, st, hipMemcpyDeviceToHost));
+  CHECK_HIP_ERROR(hipMemcpy(h.data() + 2 * sA + st, d.ipiv, sp, hipMemcpyDeviceToHost));
+  CHECK_HIP_ERROR(hipMemcpy(h.data() + 2 * sA + st + sp, d.info, si, hipMemcpyDeviceToHost));
+  return h;
+}
+
+template <typename T>
+rocblas_status testing_plan(const string &routine, rocblas_int m, rocblas_int n,
+                            rocblas_int batch_count) {
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  hipStream_t stream1, stream2;
+  CHECK_HIP_ERROR(hipStreamCreate(&stream1));
+  CHECK_HIP_ERROR(hipStreamCreate(&stream2));
+
+  hidden_sync_data<T> d1(max(m, n), batch_count), d2(max(m, n), batch_count);
+
+  // reference call to the routine
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d1));
+  vector<char> hRef = plan_result<T>(d1);
+  d1.reset();
+
+  rocsolver_plan plan = nullptr;
+  EXPECT_EQ(rocblas_status_success, plan_create<T>(handle, routine, m, n, d1, &plan));
+  if (!plan)
+    return rocblas_status_memory_error;
+
+  // (a plan only accepts the execute function of its routine and precision)
+  if (routine != "getrf")
+    EXPECT_EQ(rocblas_status_invalid_value, plan_execute<T>(plan, "getrf", d2));
+
+  // an execution on the stream of the plan creation
+  EXPECT_EQ(rocblas_status_success, plan_execute<T>(plan, routine, d1));
+  EXPECT_TRUE(plan_result<T>(d1) == hRef) << routine << " plan gives different results";
+  d1.reset();
+
+  // two executions on different streams, without any synchronization in between: the
+  // second one must wait for the first one to release the workspace of the plan
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream1));
+  EXPECT_EQ(rocblas_status_success, plan_execute<T>(plan, routine, d1));
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream2));
+  EXPECT_EQ(rocblas_status_success, plan_execute<T>(plan, routine, d2));
+  EXPECT_TRUE(plan_result<T>(d1) == hRef)
+      << routine << " plan gives different results on the first stream";
+  EXPECT_TRUE(plan_result<T>(d2) == hRef)
+      << routine << " plan gives different results on the second stream";
+
+  CHECK_ROCBLAS_ERROR(rocsolver_destroy_plan(plan));
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+  CHECK_HIP_ERROR(hipStreamDestroy(stream1));
+  CHECK_HIP_ERROR(hipStreamDestroy(stream2));
+  return rocblas_status_success;
+}
+
+// With graphs enabled, the execution of a plan is captured once for every set of pointers and
+// replayed afterwards; the graphs of the least recently used pointers are released beyond 16.
+// Every execution must give the same results as a call to the routine.
+template <typename T>
+rocblas_status testing_plan_graphs(const string &routine, rocblas_int m, rocblas_int n,
+                                   rocblas_int batch_count) {
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  hipStream_t stream;
+  CHECK_HIP_ERROR(hipStreamCreate(&stream));
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+  // one more set of pointers than the graphs kept by a plan
+  const int num_sets = 17;
+  vector<std::unique_ptr<hidden_sync_data<T>>> d;
+  for (int i = 0; i < num_sets; ++i)
+    d.emplace_back(new hidden_sync_data<T>(max(m, n), batch_count));
+
+  // reference call to the routine
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, *d[0]));
+  vector<char> hRef = plan_result<T>(*d[0]);
+  d[0]->reset();
+
+  rocsolver_plan plan = nullptr;
+  EXPECT_EQ(rocblas_status_success, plan_create<T>(handle, routine, m, n, *d[0], &plan));
+  if (!plan)
+    return rocblas_status_memory_error;
+
+  EXPECT_EQ(rocblas_status_invalid_pointer, rocsolver_set_plan_graphs(nullptr, 1));
+  rocblas_status status = rocsolver_set_plan_graphs(plan, 1);
+  if (status == rocblas_status_not_implemented) {
+    // (rocSOLVER was built without support for stream capture)
+    CHECK_ROCBLAS_ERROR(rocsolver_destroy_plan(plan));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return status;
+  }
+  EXPECT_EQ(rocblas_status_success, status);
+  // (enabling graphs again keeps the graphs of the plan)
+  EXPECT_EQ(rocblas_status_success, rocsolver_set_plan_graphs(plan, 1));
+
+  // executes the plan on the i-th set of pointers and checks the results
+  auto check = [&](int i, const char *what) {
+    d[i]->reset();
+    EXPECT_EQ(rocblas_status_success, plan_execute<T>(plan, routine, *d[i]));
+    EXPECT_TRUE(plan_result<T>(*d[i]) == hRef)
+        << routine << " plan gives different results (" << what << ", set " << i << ")";
+  };
+
+  // capture, and replay with the same pointers
+  check(0, "capture");
+  check(0, "replay");
+
+  // replay with other pointers, alternating between two sets
+  check(1, "capture");
+  check(0, "replay");
+  check(1, "replay");
+
+  // beyond 16 sets of pointers, the graph of the least recently used set (0) is released
+  for (int i = 2; i < num_sets; ++i)
+    check(i, "capture");
+  check(0, "capture after eviction");
+  for (int i = 2; i < num_sets; ++i)
+    check(i, "replay after eviction");
+
+  // without graphs, the plan is executed directly again
+  EXPECT_EQ(rocblas_status_success, rocsolver_set_plan_graphs(plan, 0));
+  check(1, "no graphs");
+
+  CHECK_ROCBLAS_ERROR(rocsolver_destroy_plan(plan));
+  CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+  CHECK_HIP_ERROR(hipStreamDestroy(stream));
+  return rocblas_status_success;
+}
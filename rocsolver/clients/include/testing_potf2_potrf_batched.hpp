@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -32,7 +35,6 @@ rocblas_status testing_potf2_potrf_batched(Arguments argus) {
     char char_uplo = argus.uplo_option;
     rocblas_fill uplo = char2rocblas_fill(char_uplo);
     rocblas_int size_A = lda * N;
-    int hot_calls = argus.iters;
     rocblas_int batch_count = argus.batch_count;
     
     std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
@@ -69,10 +71,10 @@ rocblas_status testing_potf2_potrf_batched(Arguments argus) {
 
     T* A[batch_count];
     for (int b = 0; b < batch_count; ++b) 
-        hipMalloc(&A[b], sizeof(T) * size_A);
+        rocblas_test::device_malloc(&A[b], sizeof(T) * size_A);
 
     T** dA;
-    hipMalloc(&dA, sizeof(T*) * batch_count);
+    rocblas_test::device_malloc(&dA, sizeof(T*) * batch_count);
     auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
     rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
 
@@ -118,8 +120,14 @@ rocblas_status testing_potf2_potrf_batched(Arguments argus) {
         CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b].data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dA, A, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
 
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    for(int b=0;b<batch_count;++b)
+        inputs.add(A[b], sizeof(T) * size_A);
+
     double max_err_1 = 0.0, max_val = 0.0;
-    double gpu_time_used, cpu_time_used;
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double diff, err;
@@ -191,43 +199,36 @@ rocblas_status testing_potf2_potrf_batched(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-        
         if (potrf) {
-            for(int iter = 0; iter < cold_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_potrf_batched<T>(handle, uplo, N, dA, lda, dinfo, batch_count);
-            gpu_time_used = get_time_us(); // in microseconds
-            for(int iter = 0; iter < hot_calls; iter++)
-                rocsolver_potrf_batched<T>(handle, uplo, N, dA, lda, dinfo, batch_count);
-            gpu_time_used = get_time_us() - gpu_time_used;
+            }, &inputs);
         } else {
-            for(int iter = 0; iter < cold_calls; iter++)
-                rocsolver_potf2_batched<T>(handle, uplo, N, dA, lda, dinfo, batch_count);
-            gpu_time_used = get_time_us(); // in microseconds
-            for(int iter = 0; iter < hot_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_potf2_batched<T>(handle, uplo, N, dA, lda, dinfo, batch_count);
-            gpu_time_used = get_time_us() - gpu_time_used;
+            }, &inputs);
         }
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "N , lda , uplo , batch , us [gpu] , us [cpu]";
-
-        if (argus.norm_check)
-            cout << " , norm_error_host_ptr";
-
-        cout << endl;
-        cout << N << " , " << lda << " , " << char_uplo << " , " << batch_count << " , " << gpu_time_used
-             << " , " << cpu_time_used;
+        bench_row row;
+        row.add("N", N);
+        row.add("lda", lda);
+        row.add("uplo", char_uplo);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * potrf_flops<T>(N), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << " , " << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl; 
+        row.print();
     }
 
     for(int b=0;b<batch_count;++b) 
-        hipFree(A[b]);
-    hipFree(dA);
+        rocblas_test::device_free(A[b]);
+    rocblas_test::device_free(dA);
    
     return rocblas_status_success;
 }
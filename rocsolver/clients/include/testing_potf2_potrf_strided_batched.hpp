@@ -11,7 +11,10 @@
 #include <vector>
 
 #include "arg_check.h"
+#include "bench_output.h"
+#include "bench_timing.h"
 #include "cblas_interface.h"
+#include "flops.h"
 #include "norm.h"
 #include "rocblas_test_unique_ptr.hpp"
 #include "rocsolver.hpp"
@@ -32,7 +35,6 @@ rocblas_status testing_potf2_potrf_strided_batched(Arguments argus) {
     char char_uplo = argus.uplo_option;
     rocblas_fill uplo = char2rocblas_fill(char_uplo);
     rocblas_int size_A = lda * N;
-    int hot_calls = argus.iters;
     rocblas_int strideA = argus.bsa;
     rocblas_int batch_count = argus.batch_count;
     
@@ -110,8 +112,13 @@ rocblas_status testing_potf2_potrf_strided_batched(Arguments argus) {
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
 
+    // copy of the inputs overwritten by the calls (for cold-cache timing)
+    bench_inputs inputs(argus);
+    inputs.add(dA, sizeof(T) * size_A);
+
     double max_err_1 = 0.0, max_val = 0.0;
-    double gpu_time_used, cpu_time_used;
+    double cpu_time_used = 0.0;
+    bench_timing gpu_time;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
     double diff, err;
@@ -182,38 +189,32 @@ rocblas_status testing_potf2_potrf_strided_batched(Arguments argus) {
 
     if (argus.timing) {
         // GPU rocBLAS
-        int cold_calls = 2;
-        
         if (potrf) {
-            for(int iter = 0; iter < cold_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_potrf_strided_batched<T>(handle, uplo, N, dA, lda, strideA, dinfo, batch_count);
-            gpu_time_used = get_time_us(); // in microseconds
-            for(int iter = 0; iter < hot_calls; iter++)
-                rocsolver_potrf_strided_batched<T>(handle, uplo, N, dA, lda, strideA, dinfo, batch_count);
-            gpu_time_used = get_time_us() - gpu_time_used;
+            }, &inputs);
         } else {
-            for(int iter = 0; iter < cold_calls; iter++)
-                rocsolver_potf2_strided_batched<T>(handle, uplo, N, dA, lda, strideA, dinfo, batch_count);
-            gpu_time_used = get_time_us(); // in microseconds
-            for(int iter = 0; iter < hot_calls; iter++)
+            gpu_time = bench_time(handle, argus, [&] {
                 rocsolver_potf2_strided_batched<T>(handle, uplo, N, dA, lda, strideA, dinfo, batch_count);
-            gpu_time_used = get_time_us() - gpu_time_used;
+            }, &inputs);
         }
 
         // only norm_check return an norm error, unit check won't return anything
-        cout << "N , lda , strideA, uplo , batch , us [gpu] , us [cpu]";
-
-        if (argus.norm_check)
-            cout << " , norm_error_host_ptr";
-
-        cout << endl;
-        cout << N << " , " << lda << " , " << strideA << " , " << char_uplo << " , " << batch_count << " , " << gpu_time_used
-             << " , " << cpu_time_used;
+        bench_row row;
+        row.add("N", N);
+        row.add("lda", lda);
+        row.add("strideA", strideA);
+        row.add("uplo", char_uplo);
+        row.add("batch_count", batch_count);
+        gpu_time.add_to(row);
+        bench_add_gflops(row, argus, batch_count * potrf_flops<T>(N), gpu_time.mean);
+        if (argus.unit_check || argus.norm_check)
+            row.add("cpu_time(us)", cpu_time_used);
 
         if (argus.norm_check)
-            cout << " , " << max_err_1;
+            row.add("norm_error_host_ptr", max_err_1);
 
-        cout << endl; 
+        row.print();
     }
    
     return rocblas_status_success;
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "testing_hidden_sync.hpp"
+
+using namespace std;
+
+// A workspace attached to the handle with rocsolver_set_workspace must be enough for a
+// call as soon as it has the size reported by the device memory size query, and the call
+// must fail with rocblas_status_memory_error when it is smaller. The results must be the
+// same as with the memory pools of the handle.
+
+// copies the matrices of the data to the host
+template <typename T>
+vector<T> workspace_result(hidden_sync_data<T> &d) {
+  vector<T> h(d.hA.size());
+  CHECK_HIP_ERROR(hipDeviceSynchronize());
+  CHECK_HIP_ERROR(hipMemcpy(h.data(), d.A, sizeof(T) * h.size(), hipMemcpyDeviceToHost));
+  return h;
+}
+
+template <typename T>
+rocblas_status testing_workspace(const string &routine, rocblas_int m, rocblas_int n,
+                                 rocblas_int batch_count) {
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  hidden_sync_data<T> d(max(m, n), batch_count);
+  size_t size, current, peak;
+
+  // no workspace is attached to a new handle
+  CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_size(handle, &size));
+  EXPECT_EQ(0, size);
+
+  // size of the workspace required by the call
+  // (the query does not execute the routine)
+  CHECK_ROCBLAS_ERROR(rocsolver_start_device_memory_size_query(handle));
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_stop_device_memory_size_query(handle, &size));
+  EXPECT_GT(size, 0) << routine << " needs no workspace";
+  if (!size)
+    return rocblas_status_internal_error;
+
+  // reference call with the memory pools of the handle
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  vector<T> hRef = workspace_result<T>(d);
+
+  // the statistics of the routine report the memory of the call, which is released
+  // once the call returns; the pools hold at least that memory
+  CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(handle, routine.c_str(), &current, &peak));
+  EXPECT_EQ(0, current);
+  EXPECT_EQ(size, peak);
+  CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(handle, nullptr, &current, &peak));
+  EXPECT_GE(current, size);
+  EXPECT_GE(peak, current);
+
+  // (a routine that was never called has no statistics)
+  CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(handle, "unknown_routine", &current, &peak));
+  EXPECT_EQ(0, current);
+  EXPECT_EQ(0, peak);
+
+  rocblas_unique_ptr workspace(rocblas_test::device_malloc(size), rocblas_test::device_free);
+  if (!workspace.get())
+    return rocblas_status_memory_error;
+
+  // a workspace of exactly the queried size
+  d.reset();
+  CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, workspace.get(), size));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_size(handle, &current));
+  EXPECT_EQ(size, current);
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  vector<T> hRes = workspace_result<T>(d);
+  EXPECT_EQ(0, memcmp(hRef.data(), hRes.data(), sizeof(T) * hRef.size()))
+      << routine << " gives different results with the workspace of the user";
+
+  // a workspace that is one byte too small
+  d.reset();
+  CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, workspace.get(), size - 1));
+  EXPECT_EQ(rocblas_status_memory_error, hidden_sync_call<T>(handle, routine, m, n, d));
+
+  // once the workspace is detached, the pools are used again
+  CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, nullptr, 0));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_size(handle, &current));
+  EXPECT_EQ(0, current);
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+  // a workspace cannot be attached without memory
+  EXPECT_EQ(rocblas_status_invalid_pointer, rocsolver_set_workspace(handle, nullptr, size));
+  return rocblas_status_success;
+}
+
+// When a memory pool grows, the memory it replaces is reported as retired rather than as
+// memory of the pools, and it is released by a later call once the work queued before the
+// growth has completed.
+template <typename T>
+rocblas_status testing_workspace_retired(const string &routine, rocblas_int m, rocblas_int n,
+                                         rocblas_int batch_count) {
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  hidden_sync_data<T> d(2 * max(m, n), batch_count);
+  size_t size, size_large, current, peak, retired, pools;
+
+  // the call on the larger matrices needs more memory
+  CHECK_ROCBLAS_ERROR(rocsolver_start_device_memory_size_query(handle));
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_stop_device_memory_size_query(handle, &size));
+  CHECK_ROCBLAS_ERROR(rocsolver_start_device_memory_size_query(handle));
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, 2 * m, 2 * n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_stop_device_memory_size_query(handle, &size_large));
+  EXPECT_GT(size_large, size);
+
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(handle, nullptr, &pools, &peak));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_retired_device_memory(handle, &retired));
+  EXPECT_EQ(0, retired);
+
+  // the pool grows (its previous memory may still be used by the first call)
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, 2 * m, 2 * n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(handle, nullptr, &current, &peak));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_retired_device_memory(handle, &retired));
+  EXPECT_GT(retired, 0);
+  EXPECT_LE(retired, pools);
+  EXPECT_GE(current, size_large);
+  EXPECT_GE(peak, current + retired);
+
+  // once the device is idle, the next call releases the retired memory
+  CHECK_HIP_ERROR(hipDeviceSynchronize());
+  pools = current;
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, 2 * m, 2 * n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(handle, nullptr, &current, &peak));
+  CHECK_ROCBLAS_ERROR(rocsolver_get_retired_device_memory(handle, &retired));
+  EXPECT_EQ(0, retired);
+  EXPECT_EQ(pools, current);
+  return rocblas_status_success;
+}
+
+// A handle created with rocblas_create_handle has no state in rocSOLVER: no workspace can be
+// attached to it, and its calls allocate their own memory. Handles created and destroyed in a
+// loop often get the address of the previous one; a handle must not inherit the workspace
+// attached to a destroyed handle, which is freed by then.
+template <typename T>
+rocblas_status testing_workspace_rocblas_handles(const string &routine, rocblas_int m, rocblas_int n,
+                                                 rocblas_int batch_count) {
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  hidden_sync_data<T> d(max(m, n), batch_count);
+  size_t size, current, peak;
+
+  CHECK_ROCBLAS_ERROR(rocsolver_start_device_memory_size_query(handle));
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  CHECK_ROCBLAS_ERROR(rocsolver_stop_device_memory_size_query(handle, &size));
+
+  // reference call with the memory pools of a rocSOLVER handle
+  EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(handle, routine, m, n, d));
+  vector<T> hRef = workspace_result<T>(d);
+
+  for (int i = 0; i < 10; ++i) {
+    rocblas_handle h;
+
+    // a rocSOLVER handle with a workspace, that is freed after the handle is destroyed
+    {
+      rocblas_unique_ptr workspace(rocblas_test::device_malloc(size), rocblas_test::device_free);
+      if (!workspace.get())
+        return rocblas_status_memory_error;
+      CHECK_ROCBLAS_ERROR(rocsolver_create_handle(&h));
+      CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(h, workspace.get(), size));
+      d.reset();
+      EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(h, routine, m, n, d));
+      vector<T> hRes = workspace_result<T>(d);
+      EXPECT_EQ(0, memcmp(hRef.data(), hRes.data(), sizeof(T) * hRef.size()))
+          << routine << " gives different results with the workspace of the user";
+      CHECK_ROCBLAS_ERROR(rocsolver_destroy_handle(h));
+    }
+
+    // a rocBLAS handle
+    rocblas_unique_ptr workspace(rocblas_test::device_malloc(size), rocblas_test::device_free);
+    if (!workspace.get())
+      return rocblas_status_memory_error;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&h));
+    EXPECT_EQ(rocblas_status_invalid_handle, rocsolver_set_workspace(h, workspace.get(), size));
+    EXPECT_EQ(rocblas_status_invalid_handle, rocsolver_start_device_memory_size_query(h));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_size(h, &current));
+    EXPECT_EQ(0, current);
+
+    d.reset();
+    EXPECT_EQ(rocblas_status_success, hidden_sync_call<T>(h, routine, m, n, d));
+    vector<T> hRes = workspace_result<T>(d);
+    EXPECT_EQ(0, memcmp(hRef.data(), hRes.data(), sizeof(T) * hRef.size()))
+        << routine << " gives different results on a rocBLAS handle";
+
+    // (nothing is kept for the handle)
+    CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(h, nullptr, &current, &peak));
+    EXPECT_EQ(0, peak);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_device_memory_stats(h, routine.c_str(), &current, &peak));
+    EXPECT_EQ(0, peak);
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(h));
+  }
+  return rocblas_status_success;
+}
@@ -6,6 +6,7 @@
 #ifndef _TESTING_UTILITY_H_
 #define _TESTING_UTILITY_H_
 
+#include <cmath>
 #include <immintrin.h>
 #include <iostream>
 #include <stdio.h>
@@ -207,6 +208,67 @@ void rocblas_init_hermitian(vector<T> &A, rocblas_int N, rocblas_int lda) {
   }
 };
 
+/*! \brief  initialization of a system that gesv_mixed cannot solve in single precision: */
+// modifies the (diagonally dominant) matrix A so that the refinement falls back with
+// the given iter: -2 (an entry is larger than the largest float), -3 (column N/2
+// underflows to zero in single precision, so its factorization fails; the scaling by a
+// power of two does not change the double precision solution) or -31 (the leading 2x2
+// block rounds to [1, 1; 1, 1+2^-23], whose factorization is exact but too far from the
+// block for the refinement to converge: its iteration matrix has spectral radius 1.35).
+// For -31, N must be at least 2
+template <typename T>
+void rocblas_init_gesv_mixed_fallback(T *A, rocblas_int N, rocblas_int lda,
+                                      rocblas_int iter) {
+  if (iter == -2) {
+    A[0] = T(1.0e40);
+  } else if (iter == -3) {
+    for (rocblas_int i = 0; i < N; ++i)
+      A[i + (N / 2) * lda] = A[i + (N / 2) * lda] * T(ldexp(1.0, -170));
+  } else if (iter == -31) {
+    double e = ldexp(0.9, -24);
+    for (rocblas_int i = 0; i < N; ++i) {
+      for (rocblas_int j = 0; j < 2; ++j) {
+        A[i + j * lda] = T(0);
+        A[j + i * lda] = T(0);
+      }
+    }
+    A[0] = T(1);
+    A[1] = T(1 + e);
+    A[lda] = T(1 + e);
+    A[1 + lda] = T(1 + ldexp(1.0, -23) - e);
+  }
+};
+
+/*! \brief  normwise backward error of the solution X of A*X = B: */
+// the maximum over the columns of norm(B - A*X) / (norm(A) * norm(X)), in the
+// infinity-norm. (Used instead of comparing X with the CPU solution when A is
+// ill-conditioned)
+template <typename T>
+double gesv_backward_error(rocblas_int N, rocblas_int nhrs, const T *A,
+                           rocblas_int lda, const T *B, rocblas_int ldb,
+                           const T *X, rocblas_int ldx) {
+  double anrm = 0.0, err = 0.0;
+  for (rocblas_int i = 0; i < N; ++i) {
+    double s = 0.0;
+    for (rocblas_int j = 0; j < N; ++j)
+      s += abs(A[i + j * lda]);
+    anrm = anrm > s ? anrm : s;
+  }
+  for (rocblas_int j = 0; j < nhrs; ++j) {
+    double rnrm = 0.0, xnrm = 0.0;
+    for (rocblas_int i = 0; i < N; ++i) {
+      T r = B[i + j * ldb];
+      for (rocblas_int k = 0; k < N; ++k)
+        r = r - A[i + k * lda] * X[k + j * ldx];
+      rnrm = rnrm > abs(r) ? rnrm : abs(r);
+      xnrm = xnrm > abs(X[i + j * ldx]) ? xnrm : abs(X[i + j * ldx]);
+    }
+    if (xnrm > 0 && rnrm / (anrm * xnrm) > err)
+      err = rnrm / (anrm * xnrm);
+  }
+  return err;
+};
+
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX, lda=incx);
 // initializing vector with a constant value passed as a parameter
@@ -381,6 +443,11 @@ public:
   rocblas_int timing = 0;
 
   rocblas_int iters = 10;
+  rocblas_int warmup = 2;
+  rocblas_int cold = 0;
+
+  double peak_gflops = 0;
+  double peak_bandwidth = 0;
 
   Arguments &operator=(const Arguments &rhs) {
     M = rhs.M;
@@ -429,6 +496,11 @@ public:
     timing = rhs.timing;
 
     iters = rhs.iters;
+    warmup = rhs.warmup;
+    cold = rhs.cold;
+
+    peak_gflops = rhs.peak_gflops;
+    peak_bandwidth = rhs.peak_bandwidth;
 
     return *this;
   }
@@ -36,21 +36,13 @@ typedef rocblas_storev rocsolver_storev;
 extern "C" {
 #endif
 
-ROCSOLVER_EXPORT __inline rocsolver_status
-rocsolver_create_handle(rocsolver_handle *handle) {
-
-  const rocblas_status stat = rocblas_create_handle(handle);
-  if (stat != rocblas_status_success) {
-    return stat;
-  }
-
-  return rocblas_set_pointer_mode(*handle, rocblas_pointer_mode_device);
-}
+// create_handle and destroy_handle are implemented in the library as they
+// also manage the rocsolver state associated with the handle
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_create_handle(rocsolver_handle *handle);
 
-ROCSOLVER_EXPORT __inline rocsolver_status
-rocsolver_destroy_handle(rocsolver_handle handle) {
-  return rocblas_destroy_handle(handle);
-}
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_destroy_handle(rocsolver_handle handle);
 
 ROCSOLVER_EXPORT __inline rocsolver_status
 rocsolver_add_stream(rocsolver_handle handle, hipStream_t stream) {
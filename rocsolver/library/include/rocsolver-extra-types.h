@@ -21,4 +21,9 @@ typedef enum rocblas_storev_
     rocblas_row_wise = 182, /**< Householder vectors are stored in the rows of a matrix. */
 } rocblas_storev;
 
+/*! \brief Opaque plan for the repeated execution of a routine with the same arguments 
+    (see rocsolver_destroy_plan)
+ ********************************************************************************/ 
+typedef struct _rocsolver_plan *rocsolver_plan;
+
 #endif
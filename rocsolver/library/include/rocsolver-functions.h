@@ -30,6 +30,391 @@ extern "C" {
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_get_version_string(char* buf, size_t len);
 
+/*! \brief   loads char* buf with the (short) git commit hash of the sources the library 
+     was built from, or "unknown". size_t len is the maximum length of char* buf.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_commit_string(char* buf, size_t len);
+
+
+/*
+ * ===========================================================================
+ *      Workspace management
+ * ===========================================================================
+ */
+
+/*! \brief START_DEVICE_MEMORY_SIZE_QUERY puts the handle in device memory size query mode.
+
+    \details
+    While the handle is in this mode, the rocsolver functions called with it only check 
+    their arguments and record the size of the device workspace they require; no 
+    computation is performed. The size needed by all the queried calls is returned by 
+    rocsolver_stop_device_memory_size_query. Only handles created with rocsolver_create_handle
+    can be put in this mode (rocblas_status_invalid_handle is returned otherwise).
+
+    @param[in]
+    handle          rocblas_handle
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_device_memory_size_query(rocblas_handle handle);
+
+/*! \brief STOP_DEVICE_MEMORY_SIZE_QUERY ends the device memory size query mode.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    size            pointer to size_t.\n
+                    The size in bytes of a device workspace large enough for any of the calls
+                    made since rocsolver_start_device_memory_size_query.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_device_memory_size_query(rocblas_handle handle,
+                                                                          size_t *size);
+
+/*! \brief SET_WORKSPACE attaches a user-owned device workspace to the handle.
+
+    \details
+    All the device memory required by subsequent rocsolver calls on the handle 
+    is taken from this workspace; no device memory is allocated by the library. 
+    If the workspace is too small for a call, the call returns rocblas_status_memory_error.
+    The workspace must remain valid until it is detached or the handle is destroyed. 
+    Passing a null pointer and size zero detaches the workspace 
+    and the library manages the memory again. The handle must have been created with 
+    rocsolver_create_handle; otherwise rocblas_status_invalid_handle is returned.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    workspace       pointer to device memory.
+    @param[in]
+    size            size_t.\n
+                    The size in bytes of the workspace. Use rocsolver_start_device_memory_size_query 
+                    and rocsolver_stop_device_memory_size_query to get the required size.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_workspace(rocblas_handle handle,
+                                                          void *workspace,
+                                                          size_t size);
+
+/*! \brief GET_WORKSPACE_SIZE returns the size of the workspace attached to the handle.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    size            pointer to size_t.\n
+                    The size in bytes of the user-owned workspace (0 if there is none).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_workspace_size(rocblas_handle handle,
+                                                               size_t *size);
+
+/*! \brief GET_DEVICE_MEMORY_STATS returns the device memory used by the handle.
+
+    \details
+    When no workspace is attached to the handle, the device memory needed by rocsolver 
+    functions is taken from a memory pool per handle and stream. The pools grow geometrically 
+    on demand, are reused by subsequent calls, and are released when the handle is destroyed.
+    The memory replaced by the growth of a pool may still be used by the work queued before 
+    the growth: it is released by a later call on the handle once that work has completed 
+    on the device, and it is reported by rocsolver_get_retired_device_memory rather than by 
+    the statistics of the pools. (A graph captured by the user from calls that take their 
+    memory from the pools must not be launched after the pools grow.)
+
+    Handles created with rocblas_create_handle rather than rocsolver_create_handle have no 
+    state in rocsolver, as rocblas_destroy_handle could not release it: every call allocates 
+    its device memory and releases it when it returns (which waits for the device), and 
+    the statistics are always zero.
+
+    All the rocsolver functions are asynchronous with respect to the host: their work is queued 
+    on the stream of the handle, and once the pools have grown to the size of the calls (and the 
+    retired memory has been released), a call neither allocates device memory nor waits for the device. (Only calls that are autotuned, 
+    see rocsolver_set_autotuning, and the mixed-precision solvers such as rocsolver_dsgesv, 
+    synchronize.)
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    routine         pointer to char.\n
+                    Name of a rocsolver function without the type prefix (e.g. "getrf_batched"). 
+                    The mixed-precision solvers keep both precisions (e.g. "dsgesv_batched"). 
+                    If it is a null pointer, the statistics of the memory pools of the handle are returned.
+    @param[out]
+    current         pointer to size_t.\n
+                    The size in bytes of the device memory currently used by the routine 
+                    (or currently held by the memory pools).
+    @param[out]
+    peak            pointer to size_t.\n
+                    The maximum size in bytes of device memory used by a single call to the routine
+                    (or held by the memory pools and the retired memory at the same time).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_device_memory_stats(rocblas_handle handle,
+                                                                    const char *routine,
+                                                                    size_t *current,
+                                                                    size_t *peak);
+
+/*! \brief GET_RETIRED_DEVICE_MEMORY returns the device memory replaced by the growth of the 
+    memory pools of the handle that is not released yet.
+
+    \details
+    The retired memory is released by the first call that takes memory from the pools 
+    once the work queued before the growth has completed (without waiting for the device), 
+    or when the device runs out of memory, or when the handle is destroyed. 
+    It is always zero for a handle created with rocblas_create_handle.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[out]
+    size            pointer to size_t.\n
+                    The size in bytes of the retired memory.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_retired_device_memory(rocblas_handle handle,
+                                                                      size_t *size);
+
+
+
+/*
+ * ===========================================================================
+ *      Tuning of algorithm parameters
+ * ===========================================================================
+ */
+
+/*! \brief LOAD_TUNING_FILE adds the entries of a tuning file to the tuning table of the handle.
+
+    \details
+    The tuning table gives the values of the algorithm parameters (such as block sizes and
+    switch points between the blocked and unblocked variants of a routine) as a function of 
+    the precision, the size of the problem and the batch count of a call. 
+
+    A tuning file has one entry per line:
+
+        param precision size_min size_max batch_min batch_max value
+
+    where param is one of getrf_blocksize, getrf_rgetf2_cutoff, potrf_blocksize,
+    geqrf_switchsize, geqrf_blocksize, ormqr_blocksize or ormlq_blocksize; precision is one 
+    of s, d, c, z; and the size is the order of the matrix for potrf, min(m,n) for
+    getrf and geqrf, and k for orgqr and ormqr. Any field but param and value can be 
+    replaced by '*' to match anything, and '#' starts a comment. When several entries 
+    match a call, the last one is used. Parameters with no matching entry take their default values.
+
+    When rocsolver_create_handle creates the state of a handle, it loads the file given by the 
+    environment variable ROCSOLVER_TUNING_FILE and the entries in ROCSOLVER_TUNING (separated by ';'), 
+    if set. Handles created with rocblas_create_handle use those entries only, and cannot be 
+    given another table or be autotuned: the functions changing the tuning of a handle return 
+    rocblas_status_invalid_handle for them.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    filename        pointer to char.\n
+                    Path of the tuning file. If the file cannot be read or any of its entries 
+                    is not valid, rocblas_status_invalid_value is returned and the table is not modified.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_load_tuning_file(rocblas_handle handle,
+                                                             const char *filename);
+
+/*! \brief SET_TUNING_PARAMETER overrides the tuning table of the handle for a parameter.
+
+    \details
+    The value is used by all subsequent calls on the handle, regardless of their 
+    precision and sizes, until it is changed again. 
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    param           pointer to char.\n
+                    Name of the parameter (see rocsolver_load_tuning_file).
+    @param[in]
+    value           rocblas_int. value >= 0.\n
+                    The new value of the parameter. If value = 0, the override is removed 
+                    and the tuning table is used again.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_tuning_parameter(rocblas_handle handle,
+                                                                 const char *param,
+                                                                 const rocblas_int value);
+
+/*! \brief GET_TUNING_PARAMETER returns the value of a parameter used by the handle for a call.
+
+    \details
+    The value is resolved as in the routines: the override set with 
+    rocsolver_set_tuning_parameter if any, otherwise the last matching entry of the tuning 
+    table, otherwise the default value. Besides the parameters of the tuning table, the 
+    fixed limits getrf_small_maxsize (order up to which getrf factorizes the matrix with a 
+    single kernel) and getf2_panel_ldssize (bytes of the panels that getf2 factorizes in LDS) 
+    can be queried.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    param           pointer to char.\n
+                    Name of the parameter (see rocsolver_load_tuning_file).
+    @param[in]
+    precision       char.\n
+                    Precision of the call: s, d, c or z.
+    @param[in]
+    size            rocblas_int. size >= 0.\n
+                    Size of the problem, as in the tuning table.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Batch count of the call (1 for the non-batched routines).
+    @param[out]
+    value           pointer to rocblas_int.\n
+                    The value of the parameter.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_tuning_parameter(rocblas_handle handle,
+                                                                 const char *param,
+                                                                 const char precision,
+                                                                 const rocblas_int size,
+                                                                 const rocblas_int batch_count,
+                                                                 rocblas_int *value);
+
+/*! \brief SET_AUTOTUNING enables or disables the autotuning of the block sizes on the handle.
+
+    \details
+    When autotuning is enabled, the first call to getrf, potrf or geqrf (or their batched 
+    versions) for a problem with no matching entry in the tuning table times a few candidate 
+    block sizes on scratch matrices of the same size, and adds the fastest one to the table. 
+    The entry covers the sizes and batch counts in the same power-of-two ranges as the call.
+    Calls made while a user workspace is attached to the handle, as well as device memory
+    size queries, are never autotuned. An autotuned call allocates scratch matrices and waits 
+    for the device to time the candidates.
+
+    The values found are also appended to a cache file, together with the name of the device,
+    so that later processes running on the same device load them when autotuning is enabled 
+    instead of timing the candidates again. The cache file is given by the environment variable 
+    ROCSOLVER_TUNING_CACHE, or is .rocsolver_tuning_cache in the home directory otherwise.
+
+    Autotuning is disabled by default. It is enabled for every new handle if the environment 
+    variable ROCSOLVER_AUTOTUNE is set (and is not 0).
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    enable          rocblas_int.\n
+                    If enable != 0, autotuning is enabled; otherwise it is disabled 
+                    (the values already found are kept in the tuning table).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_autotuning(rocblas_handle handle,
+                                                           const rocblas_int enable);
+
+/*! \brief SET_LAYER_MODE enables the logging layers on the handle.
+
+    \details
+    The calls made on the handle are logged by the enabled layers:
+
+    - rocblas_layer_mode_log_trace prints every call with all its arguments.
+    - rocblas_layer_mode_log_bench prints, for every call, the command line of 
+      rocsolver-bench that reproduces it.
+    - rocblas_layer_mode_log_profile counts the calls of every routine with the same 
+      arguments (sizes, leading dimensions, strides, batch count and options), and adds 
+      up their device time. The profile is written when the handle is destroyed (or with 
+      rocsolver_log_write_profile) as a rocsolver-bench suite, so that the same calls 
+      can be replayed with rocsolver-bench --file.
+
+    The logs are written to the files given by the environment variables 
+    ROCSOLVER_LOG_TRACE_PATH, ROCSOLVER_LOG_BENCH_PATH and ROCSOLVER_LOG_PROFILE_PATH, 
+    or to stderr when they are not set. The layers of every new handle are given by the 
+    environment variable ROCSOLVER_LAYER (a combination of the values of rocblas_layer_mode, 
+    e.g. ROCSOLVER_LAYER=6 for bench and profile). Device memory size queries are not logged.
+    Handles created with rocblas_create_handle only have the trace and bench layers given 
+    by ROCSOLVER_LAYER, and rocblas_status_invalid_handle is returned for them.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    layer_mode      rocblas_int.\n
+                    Bitwise OR of the layers (rocblas_layer_mode) to enable; 
+                    rocblas_layer_mode_none disables logging.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_layer_mode(rocblas_handle handle,
+                                                          const rocblas_int layer_mode);
+
+/*! \brief LOG_WRITE_PROFILE writes the profile of the handle, and clears it.
+
+    \details
+    It waits for the calls still in progress on the handle to complete. Nothing is
+    written if the profile layer is not enabled (or no call was made since the last time).
+
+    @param[in]
+    handle          rocblas_handle
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_log_write_profile(rocblas_handle handle);
+
+/*! \brief START_PHASE_TRACE starts recording the internal phases of the routines.
+
+    \details
+    The phases of the algorithms (such as the panel factorizations, the updates of the 
+    trailing matrix, the row interchanges or the application of the block reflectors) 
+    are timed on the device, together with the number of kernels launched and rocBLAS 
+    functions called within them. The phases are recorded for all the handles and threads 
+    until rocsolver_stop_phase_trace is called.
+
+    The trace of a whole execution can also be requested with the environment variable 
+    ROCSOLVER_PHASE_TRACE=<file>. The recorded phases are appended to the file whenever a 
+    handle is destroyed with rocsolver_destroy_handle (not at exit), thus the phases recorded 
+    after the last handle is destroyed are not written. If rocSOLVER was built with 
+    roctx, ROCSOLVER_PHASE_ROCTX=1 pushes the phases as roctx ranges, for rocprof.
+
+    At most 65536 phases are kept until they are written. When the trace is full, the 
+    phases that have completed are appended to the file given by ROCSOLVER_PHASE_TRACE 
+    (if any); the phases that do not fit are dropped, and their number is written with the 
+    trace of rocsolver_stop_phase_trace (as dropped_phases).
+
+    It returns rocblas_status_not_implemented if rocSOLVER was built without the profiler 
+    (BUILD_WITH_PHASE_PROFILER=OFF).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_phase_trace(void);
+
+/*! \brief STOP_PHASE_TRACE stops recording the phases and writes them as a Chrome trace.
+
+    \details
+    It waits for the recorded phases to complete, and writes them as Chrome trace events 
+    (to be opened with chrome://tracing or Perfetto). Every device is a process and every 
+    stream a thread of the trace. The recorded phases are discarded afterwards.
+
+    @param[in]
+    filename        const char*.\n
+                    Name of the file to write; if it is a null pointer, the recorded 
+                    phases are discarded.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_phase_trace(const char *filename);
+
+/*! \brief START_PHASE_COUNTERS starts counting the kernels launched and the rocBLAS functions 
+    called by the routines.
+
+    \details
+    The counts of the outermost phases (see rocsolver_start_phase_trace) are added up for all 
+    the handles and threads until rocsolver_stop_phase_counters is called; the counters are 
+    reset first. Nothing is recorded on the device. 
+
+    It returns rocblas_status_not_implemented if rocSOLVER was built without the profiler 
+    (BUILD_WITH_PHASE_PROFILER=OFF).
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_phase_counters(void);
+
+/*! \brief STOP_PHASE_COUNTERS stops counting, and returns the counts since rocsolver_start_phase_counters.
+
+    @param[out]
+    launches        pointer to rocblas_int.\n
+                    Number of kernels launched. It is not written if it is a null pointer.
+    @param[out]
+    blas_calls      pointer to rocblas_int.\n
+                    Number of rocBLAS functions called. It is not written if it is a null pointer.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_phase_counters(rocblas_int *launches,
+                                                                rocblas_int *blas_calls);
 
 /*
  * ===========================================================================
@@ -3741,327 +4126,564 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched(
                  const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *B, const rocblas_int ldb, 
                  const rocblas_stride strideB, const rocblas_int batch_count);
 
-
-/*! \brief POTF2 computes the Cholesky factorization of a real symmetric/complex
-    Hermitian positive definite matrix A.
+/*! \brief GESV solves a system of n linear equations on n variables.
 
     \details
-    (This is the unblocked version of the algorithm). 
+    It computes the LU factorization of A (as GETRF) 
 
-    The factorization has the form:
-
-        A = U' * U, or
-        A = L  * L'
+        A = P * L * U
 
-    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+    and uses it to solve the system A * X = B (as GETRS). Small systems (n <= 32) are 
+    factorized and solved in a single kernel, without going back to global memory 
+    between the factorization and the solution.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The matrix dimensions.
-    @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in,out]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A.
+                On exit, the factors L and U of the factorization. 
+                The unit diagonal elements of L are not stored.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
     @param[out]
-    info      pointer to a rocblas_int on the GPU.\n
-              If info = 0, succesful factorization of matrix A. 
-              If info = i > 0, the leading minor of order i of A is not positive definite. 
-              The factorization stopped at this point.
-
-    ********************************************************************/
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The vector of pivot indices. Elements of ipiv are 1-based indices.
+                For 1 <= i <= n, the row i of the matrix was interchanged with row ipiv[i].
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit. 
+                If info = i > 0, U is singular. U(i,i) is the first zero pivot, 
+                and the solution could not be computed (B is not modified).
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   float *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   double *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, rocblas_int *ipiv, float *B, const rocblas_int ldb,
+    rocblas_int *info);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cpotf2(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   rocblas_float_complex *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb,
+    rocblas_int *info);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zpotf2(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   rocblas_double_complex *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_float_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_float_complex *B, const rocblas_int ldb,
+    rocblas_int *info);
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb,
+    rocblas_int *info);
 
-/*! \brief POTF2_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric/complex Hermitian positive definite matrices.
+/*! \brief GESV_BATCHED solves a batch of systems of n linear equations on n variables.
 
     \details
-    (This is the unblocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    For each instance j in the batch, it computes the LU factorization of A_j (as GETRF_BATCHED) 
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
+        A_j = P_j * L_j * U_j
 
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    and uses it to solve the system A_j * X_j = B_j (as GETRS_BATCHED). Small systems 
+    (n <= 32) are factorized and solved in a single kernel, with one work-group per system 
+    that keeps A_j and B_j on-chip.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
-    @param[inout]
-    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in,out]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_j.
+                On exit, the factors L_j and U_j of the factorizations. 
+                The unit diagonal elements of L_j are not stored.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors of pivot indices ipiv_j (corresponding to A_j). 
+                Dimension of ipiv_j is n. Elements of ipiv_j are 1-based indices.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n 
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for system j. 
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot, 
+                and the solution X_j could not be computed (B_j is not modified).
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of instances (systems) in the batch. 
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           float *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    float *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    float *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           double *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    double *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cpotf2_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           rocblas_float_complex *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_float_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_float_complex *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zpotf2_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           rocblas_double_complex *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_double_complex *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
 
-/*! \brief POTF2_STRIDED_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric/complex Hermitian positive definite matrices.
+/*! \brief GESV_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables.
 
     \details
-    (This is the unblocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    For each instance j in the batch, it computes the LU factorization of A_j (as GETRF_STRIDED_BATCHED) 
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
+        A_j = P_j * L_j * U_j
 
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    and uses it to solve the system A_j * X_j = B_j (as GETRS_STRIDED_BATCHED). Small systems 
+    (n <= 32) are factorized and solved in a single kernel, with one work-group per system 
+    that keeps A_j and B_j on-chip.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
-    @param[inout]
-    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in,out]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j.
+                On exit, the factors L_j and U_j of the factorizations. 
+                The unit diagonal elements of L_j are not stored.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
     @param[in]
-    strideA   rocblas_stride.\n
-              Stride from the start of one matrix A_i and the next one A_(i+1). 
-              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors of pivot indices ipiv_j (corresponding to A_j). 
+                Dimension of ipiv_j is n. Elements of ipiv_j are 1-based indices.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for system j. 
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot, 
+                and the solution X_j could not be computed (B_j is not modified).
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of instances (systems) in the batch. 
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   float *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    float *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   double *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    double *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cpotf2_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   rocblas_float_complex *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_float_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zpotf2_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   rocblas_double_complex *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
 
-/*! \brief POTRF computes the Cholesky factorization of a real symmetric/complex
-    Hermitian positive definite matrix A.
+/*! \brief DSGESV and ZCGESV solve a system of n linear equations on n variables using 
+    an LU factorization in lower precision and iterative refinement.
 
     \details
-    (This is the blocked version of the algorithm). 
+    The system A * X = B is solved by factorizing A in single precision (A = P*L*U), 
+    and refining the solution with residuals computed in double precision, until 
+    the residual of every column of X is small enough:
 
-    The factorization has the form:
+        || B - A*X ||_max <= || X ||_max * || A ||_inf * eps * sqrt(n)
 
-        A = U' * U, or
-        A = L  * L'
+    (eps is the relative machine precision in double precision). If the refinement 
+    does not converge in 30 steps, if A (or B, or a residual) cannot be represented in 
+    single precision, or if the factorization in single precision fails, the system is 
+    solved with a factorization of A in double precision as in GETRF and GETRS. 
 
-    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+    The refinement reads on the host whether the system has converged after every step, 
+    thus these functions synchronize the stream of the handle (and cannot be captured 
+    into a hipGraph).
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The matrix dimensions.
-    @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrices B and X.
+    @param[in,out]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A.
+                On exit, if the system was solved in double precision (iter < 0), the factors 
+                L and U of the factorization A = P*L*U; otherwise A is unchanged.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
     @param[out]
-    info      pointer to a rocblas_int on the GPU.\n
-              If info = 0, succesful factorization of matrix A. 
-              If info = i > 0, the leading minor of order i of A is not positive definite. 
-              The factorization stopped at this point.
-
-    ********************************************************************/
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   float *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   double *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices of the factorization (in single or in double precision). 
+    @param[in]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrix B.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                The solution matrix X.
+    @param[in]
+    ldx         rocblas_int. ldx >= n.\n
+                The leading dimension of X.
+    @param[out]
+    iter        pointer to a rocblas_int on the GPU.\n
+                If iter >= 0, the number of refinement steps done. If iter < 0, the system 
+                was solved in double precision, because the refinement did not converge 
+                (iter = -31), A could not be converted to single precision (iter = -2), or 
+                the factorization in single precision failed (iter = -3).
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit. 
+                If info = i > 0, U is singular (in double precision). U(i,i) is the first zero pivot, 
+                and the solution could not be computed.
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   rocblas_float_complex *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n,
-                                                   rocblas_double_complex *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb,
+    double *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info);
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_zcgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb,
+    rocblas_double_complex *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info);
 
-/*! \brief POTRF_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric/complex Hermitian positive definite matrices.
+/*! \brief DSGESV_BATCHED and ZCGESV_BATCHED solve a batch of systems of n linear equations 
+    on n variables using LU factorizations in lower precision and iterative refinement.
 
     \details
-    (This is the blocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    Each system A_j * X_j = B_j in the batch is solved as in DSGESV and ZCGESV. The systems 
+    that are not solved by the refinement are then solved together with factorizations in 
+    double precision.
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
-
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    These functions synchronize the stream of the handle after every refinement step (see DSGESV).
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
-    @param[inout]
-    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j and X_j.
+    @param[in,out]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_j.
+                On exit, the factors L_j and U_j of the systems solved in double precision (iter_j < 0).
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices of the factorizations.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n 
+                The right hand side matrices B_j.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[out]
+    X           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldx*nrhs.\n 
+                The solution matrices X_j.
+    @param[in]
+    ldx         rocblas_int. ldx >= n.\n
+                The leading dimension of matrices X_j.
+    @param[out]
+    iter        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                The number of refinement steps of each system, or why it was solved 
+                in double precision (see DSGESV).
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for system j. 
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot.
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of instances (systems) in the batch. 
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    double *const B[], const rocblas_int ldb, double *const X[], const rocblas_int ldx,
+    rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zcgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_double_complex *const B[], const rocblas_int ldb, rocblas_double_complex *const X[], const rocblas_int ldx,
+    rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count);
+
+/*! \brief DSGESV_STRIDED_BATCHED and ZCGESV_STRIDED_BATCHED solve a batch of systems of n linear 
+    equations on n variables using LU factorizations in lower precision and iterative refinement.
+
+    \details
+    Each system A_j * X_j = B_j in the batch is solved as in DSGESV and ZCGESV. The systems 
+    that are not solved by the refinement are then solved together with factorizations in 
+    double precision.
+
+    These functions synchronize the stream of the handle after every refinement step (see DSGESV).
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j and X_j.
+    @param[in,out]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j.
+                On exit, the factors L_j and U_j of the systems solved in double precision (iter_j < 0).
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices of the factorizations.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                The right hand side matrices B_j.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    X           pointer to type. Array on the GPU (the size depends on the value of strideX).\n
+                The solution matrices X_j.
+    @param[in]
+    ldx         rocblas_int. ldx >= n.\n
+                The leading dimension of matrices X_j.
+    @param[in]
+    strideX     rocblas_stride.\n
+                Stride from the start of one matrix X_j and the next one X_(j+1). 
+                There is no restriction for the value of strideX. Normal use case is strideX >= ldx*nrhs.
+    @param[out]
+    iter        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                The number of refinement steps of each system, or why it was solved 
+                in double precision (see DSGESV).
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for system j. 
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    double *B, const rocblas_int ldb, const rocblas_stride strideB, double *X, const rocblas_int ldx, const rocblas_stride strideX,
+    rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zcgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_double_complex *X, const rocblas_int ldx, const rocblas_stride strideX,
+    rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count);
+
+
+/*! \brief POTF2 computes the Cholesky factorization of a real symmetric/complex
+    Hermitian positive definite matrix A.
+
+    \details
+    (This is the unblocked version of the algorithm). 
+
+    The factorization has the form:
+
+        A = U' * U, or
+        A = L  * L'
+
+    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful factorization of matrix A. 
+              If info = i > 0, the leading minor of order i of A is not positive definite. 
+              The factorization stopped at this point.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   float *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   double *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotf2(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   rocblas_float_complex *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotf2(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   rocblas_double_complex *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+
+/*! \brief POTF2_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric/complex Hermitian positive definite matrices.
+
+    \details
+    (This is the unblocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_batched(rocblas_handle handle,
                                                            const rocblas_fill uplo,
                                                            const rocblas_int n, 
                                                            float *const A[],
@@ -4069,7 +4691,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched(rocblas_handle handle,
                                                            rocblas_int* info,
                                                            const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_batched(rocblas_handle handle,
                                                            const rocblas_fill uplo,
                                                            const rocblas_int n, 
                                                            double *const A[],
@@ -4077,7 +4699,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched(rocblas_handle handle,
                                                            rocblas_int* info,
                                                            const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotf2_batched(rocblas_handle handle,
                                                            const rocblas_fill uplo,
                                                            const rocblas_int n, 
                                                            rocblas_float_complex *const A[],
@@ -4085,7 +4707,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched(rocblas_handle handle,
                                                            rocblas_int* info,
                                                            const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotf2_batched(rocblas_handle handle,
                                                            const rocblas_fill uplo,
                                                            const rocblas_int n, 
                                                            rocblas_double_complex *const A[],
@@ -4093,11 +4715,11 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
                                                            rocblas_int* info,
                                                            const rocblas_int batch_count);
 
-/*! \brief POTRF_STRIDED_BATCHED computes the Cholesky factorization of a 
+/*! \brief POTF2_STRIDED_BATCHED computes the Cholesky factorization of a 
     batch of real symmetric/complex Hermitian positive definite matrices.
 
     \details
-    (This is the blocked version of the algorithm). 
+    (This is the unblocked version of the algorithm). 
 
     The factorization of matrix A_i in the batch has the form:
 
@@ -4136,7 +4758,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_strided_batched(rocblas_handle handle,
                                                                    const rocblas_fill uplo,
                                                                    const rocblas_int n, 
                                                                    float *A,
@@ -4145,7 +4767,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched(rocblas_handle
                                                                    rocblas_int* info,
                                                                    const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_strided_batched(rocblas_handle handle,
                                                                    const rocblas_fill uplo,
                                                                    const rocblas_int n, 
                                                                    double *A,
@@ -4154,7 +4776,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched(rocblas_handle
                                                                    rocblas_int* info,
                                                                    const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotf2_strided_batched(rocblas_handle handle,
                                                                    const rocblas_fill uplo,
                                                                    const rocblas_int n, 
                                                                    rocblas_float_complex *A,
@@ -4163,7 +4785,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched(rocblas_handle
                                                                    rocblas_int* info,
                                                                    const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched(rocblas_handle handle,
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotf2_strided_batched(rocblas_handle handle,
                                                                    const rocblas_fill uplo,
                                                                    const rocblas_int n, 
                                                                    rocblas_double_complex *A,
@@ -4172,6 +4794,1449 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched(rocblas_handle
                                                                    rocblas_int* info,
                                                                    const rocblas_int batch_count);
 
+/*! \brief POTRF computes the Cholesky factorization of a real symmetric/complex
+    Hermitian positive definite matrix A.
+
+    \details
+    (This is the blocked version of the algorithm). 
+
+    The factorization has the form:
+
+        A = U' * U, or
+        A = L  * L'
+
+    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful factorization of matrix A. 
+              If info = i > 0, the leading minor of order i of A is not positive definite. 
+              The factorization stopped at this point.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   float *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   double *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   rocblas_float_complex *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   rocblas_double_complex *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+
+/*! \brief POTRF_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric/complex Hermitian positive definite matrices.
+
+    \details
+    (This is the blocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           float *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           double *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           rocblas_float_complex *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           rocblas_double_complex *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+/*! \brief POTRF_STRIDED_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric/complex Hermitian positive definite matrices.
+
+    \details
+    (This is the blocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one matrix A_i and the next one A_(i+1). 
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   float *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   double *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   rocblas_float_complex *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   rocblas_double_complex *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+
+/*
+ * ===========================================================================
+ *      Plans
+ * ===========================================================================
+ */
+
+/*! \brief DESTROY_PLAN releases a plan and its device memory.
+
+    \details
+    A plan is created by one of the rocsolver_<type><routine>_plan_create functions for a 
+    fixed set of arguments (sizes, leading dimensions, strides and batch count), and executed 
+    with the matching rocsolver_<type><routine>_plan_execute function as many times as needed. 
+    Everything that does not depend on the matrices is done when the plan is created: the 
+    autotuning of the block sizes (if it is enabled), the selection of the tuning parameters, 
+    the allocation of the device workspace (which is owned by the plan) and the upload of the 
+    constants. The execution only launches the kernels of the routine, on the stream of the 
+    handle at that time, and gives the same results as a call to the routine.
+
+    A plan must be destroyed before its handle, and must not be executed by several threads 
+    at the same time (its workspace is not shared). It can be executed on different streams: 
+    an execution on a stream other than the one of the previous execution waits for the 
+    previous one to complete on the device. (The executions captured by the user into a 
+    graph are not ordered in this way; the graph must order them.)
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    The plan to destroy. Nothing is done if it is a null pointer.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_destroy_plan(rocsolver_plan plan);
+
+/*! \brief SET_PLAN_GRAPHS enables or disables the execution of a plan as hipGraphs.
+
+    \details
+    With graphs enabled, the first execution of the plan for a given set of matrix and 
+    vector pointers is captured into a hipGraph (on a stream owned by the plan) and 
+    launched; the following executions with the same pointers only launch the graph on the 
+    stream of the handle. Up to 16 graphs are kept by a plan; the least recently used one 
+    is released first. The executions that replay a graph are not recorded by the phase 
+    profiler. Disabling graphs releases them.
+
+    The execution of a plan (with or without graphs) does not allocate memory, synchronize 
+    or read device data, thus it can also be captured by the user into a graph of their own. 
+    The same holds for the other functions while the stream of the handle is captured, as long 
+    as their device memory and constants are already available: they return 
+    rocblas_status_memory_error instead of allocating memory during a capture.
+    Note that the rocBLAS functions called internally may need workspace from the rocBLAS 
+    handle; it must be large enough before the capture.
+
+    It returns rocblas_status_not_implemented if rocSOLVER was built with a HIP that does 
+    not support stream capture.
+
+    @param[in]
+    plan            rocsolver_plan.
+    @param[in]
+    enable          rocblas_int.\n
+                    1 to enable graphs, 0 to disable them.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_plan_graphs(rocsolver_plan plan, const rocblas_int enable);
+
+/*! \brief GETRF_PLAN_CREATE creates a plan for the LU factorization of a general m-by-n matrix.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in getrf; the plan 
+    can only be executed with rocsolver_<type>getrf_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+/*! \brief GETRF_PLAN_EXECUTE computes the LU factorization of a general m-by-n matrix A with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>getrf with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>getrf_plan_create.
+    @param[inout]
+    A               pointer to type. Array on the GPU.\n
+                    The matrix (or matrices) to be factored, as in the routine.
+    @param[out]
+    ipiv            pointer to rocblas_int. Array on the GPU.\n
+                    The vector(s) of pivot indices, as in the routine.
+    @param[out]
+    info            pointer to rocblas_int. Array on the GPU.\n
+                    The status of the factorization(s), as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_plan_execute(rocsolver_plan plan,
+                                                              float *A,
+                                                              rocblas_int *ipiv,
+                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_plan_execute(rocsolver_plan plan,
+                                                              double *A,
+                                                              rocblas_int *ipiv,
+                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_plan_execute(rocsolver_plan plan,
+                                                              rocblas_float_complex *A,
+                                                              rocblas_int *ipiv,
+                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_plan_execute(rocsolver_plan plan,
+                                                              rocblas_double_complex *A,
+                                                              rocblas_int *ipiv,
+                                                              rocblas_int *info);
+
+/*! \brief GETRF_BATCHED_PLAN_CREATE creates a plan for the LU factorization of a batch of general m-by-n matrices.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in getrf_batched; the plan 
+    can only be executed with rocsolver_<type>getrf_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    strideP         rocblas_stride.\n
+                    Stride from the start of one vector ipiv to the next one.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+/*! \brief GETRF_BATCHED_PLAN_EXECUTE computes the LU factorization of a batch of general m-by-n matrices with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>getrf_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>getrf_batched_plan_create.
+    @param[inout]
+    A               array of pointers to type. Each pointer points to an array on the GPU.\n
+                    The matrices to be factored, as in the routine.
+    @param[out]
+    ipiv            pointer to rocblas_int. Array on the GPU.\n
+                    The vector(s) of pivot indices, as in the routine.
+    @param[out]
+    info            pointer to rocblas_int. Array on the GPU.\n
+                    The status of the factorization(s), as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      float *const A[],
+                                                                      rocblas_int *ipiv,
+                                                                      rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      double *const A[],
+                                                                      rocblas_int *ipiv,
+                                                                      rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_float_complex *const A[],
+                                                                      rocblas_int *ipiv,
+                                                                      rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_double_complex *const A[],
+                                                                      rocblas_int *ipiv,
+                                                                      rocblas_int *info);
+
+/*! \brief GETRF_STRIDED_BATCHED_PLAN_CREATE creates a plan for the LU factorization of a batch of general m-by-n matrices.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in getrf_strided_batched; the plan 
+    can only be executed with rocsolver_<type>getrf_strided_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    strideA         rocblas_stride.\n
+                    Stride from the start of one matrix to the next one.
+    @param[in]
+    strideP         rocblas_stride.\n
+                    Stride from the start of one vector ipiv to the next one.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+/*! \brief GETRF_STRIDED_BATCHED_PLAN_EXECUTE computes the LU factorization of a batch of general m-by-n matrices with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>getrf_strided_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>getrf_strided_batched_plan_create.
+    @param[inout]
+    A               pointer to type. Array on the GPU.\n
+                    The matrix (or matrices) to be factored, as in the routine.
+    @param[out]
+    ipiv            pointer to rocblas_int. Array on the GPU.\n
+                    The vector(s) of pivot indices, as in the routine.
+    @param[out]
+    info            pointer to rocblas_int. Array on the GPU.\n
+                    The status of the factorization(s), as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              float *A,
+                                                                              rocblas_int *ipiv,
+                                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              double *A,
+                                                                              rocblas_int *ipiv,
+                                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_float_complex *A,
+                                                                              rocblas_int *ipiv,
+                                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_double_complex *A,
+                                                                              rocblas_int *ipiv,
+                                                                              rocblas_int *info);
+
+/*! \brief POTRF_PLAN_CREATE creates a plan for the Cholesky factorization of a n-by-n matrix.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in potrf; the plan 
+    can only be executed with rocsolver_<type>potrf_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    uplo            rocblas_fill.\n
+                    Specifies whether the factorization is upper or lower triangular.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= n.\n
+                    Specifies the leading dimension of the matrices.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_fill uplo,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_fill uplo,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_fill uplo,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_fill uplo,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+/*! \brief POTRF_PLAN_EXECUTE computes the Cholesky factorization of a n-by-n matrix A with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>potrf with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>potrf_plan_create.
+    @param[inout]
+    A               pointer to type. Array on the GPU.\n
+                    The matrix (or matrices) to be factored, as in the routine.
+    @param[out]
+    info            pointer to rocblas_int. Array on the GPU.\n
+                    The status of the factorization(s), as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_plan_execute(rocsolver_plan plan,
+                                                              float *A,
+                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_plan_execute(rocsolver_plan plan,
+                                                              double *A,
+                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_plan_execute(rocsolver_plan plan,
+                                                              rocblas_float_complex *A,
+                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_plan_execute(rocsolver_plan plan,
+                                                              rocblas_double_complex *A,
+                                                              rocblas_int *info);
+
+/*! \brief POTRF_BATCHED_PLAN_CREATE creates a plan for the Cholesky factorization of a batch of n-by-n matrices.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in potrf_batched; the plan 
+    can only be executed with rocsolver_<type>potrf_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    uplo            rocblas_fill.\n
+                    Specifies whether the factorization is upper or lower triangular.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= n.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_fill uplo,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+/*! \brief POTRF_BATCHED_PLAN_EXECUTE computes the Cholesky factorization of a batch of n-by-n matrices with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>potrf_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>potrf_batched_plan_create.
+    @param[inout]
+    A               array of pointers to type. Each pointer points to an array on the GPU.\n
+                    The matrices to be factored, as in the routine.
+    @param[out]
+    info            pointer to rocblas_int. Array on the GPU.\n
+                    The status of the factorization(s), as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      float *const A[],
+                                                                      rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      double *const A[],
+                                                                      rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_float_complex *const A[],
+                                                                      rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_double_complex *const A[],
+                                                                      rocblas_int *info);
+
+/*! \brief POTRF_STRIDED_BATCHED_PLAN_CREATE creates a plan for the Cholesky factorization of a batch of n-by-n matrices.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in potrf_strided_batched; the plan 
+    can only be executed with rocsolver_<type>potrf_strided_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    uplo            rocblas_fill.\n
+                    Specifies whether the factorization is upper or lower triangular.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= n.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    strideA         rocblas_stride.\n
+                    Stride from the start of one matrix to the next one.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_fill uplo,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_fill uplo,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_fill uplo,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_fill uplo,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+/*! \brief POTRF_STRIDED_BATCHED_PLAN_EXECUTE computes the Cholesky factorization of a batch of n-by-n matrices with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>potrf_strided_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>potrf_strided_batched_plan_create.
+    @param[inout]
+    A               pointer to type. Array on the GPU.\n
+                    The matrix (or matrices) to be factored, as in the routine.
+    @param[out]
+    info            pointer to rocblas_int. Array on the GPU.\n
+                    The status of the factorization(s), as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              float *A,
+                                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              double *A,
+                                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_float_complex *A,
+                                                                              rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_double_complex *A,
+                                                                              rocblas_int *info);
+
+/*! \brief GEQRF_PLAN_CREATE creates a plan for the QR factorization of a general m-by-n matrix.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in geqrf; the plan 
+    can only be executed with rocsolver_<type>geqrf_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_plan_create(rocblas_handle handle,
+                                                             const rocblas_int m,
+                                                             const rocblas_int n,
+                                                             const rocblas_int lda,
+                                                             rocsolver_plan *plan);
+
+/*! \brief GEQRF_PLAN_EXECUTE computes the QR factorization of a general m-by-n matrix A with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>geqrf with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>geqrf_plan_create.
+    @param[inout]
+    A               pointer to type. Array on the GPU.\n
+                    The matrix (or matrices) to be factored, as in the routine.
+    @param[out]
+    ipiv            pointer to type. Array on the GPU.\n
+                    The Householder scalars, as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_plan_execute(rocsolver_plan plan,
+                                                              float *A,
+                                                              float *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_plan_execute(rocsolver_plan plan,
+                                                              double *A,
+                                                              double *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_plan_execute(rocsolver_plan plan,
+                                                              rocblas_float_complex *A,
+                                                              rocblas_float_complex *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_plan_execute(rocsolver_plan plan,
+                                                              rocblas_double_complex *A,
+                                                              rocblas_double_complex *ipiv);
+
+/*! \brief GEQRF_BATCHED_PLAN_CREATE creates a plan for the QR factorization of a batch of general m-by-n matrices.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in geqrf_batched; the plan 
+    can only be executed with rocsolver_<type>geqrf_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    stridep         rocblas_stride.\n
+                    Stride from the start of one vector ipiv to the next one.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride stridep,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride stridep,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride stridep,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_int m,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride stridep,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+/*! \brief GEQRF_BATCHED_PLAN_EXECUTE computes the QR factorization of a batch of general m-by-n matrices with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>geqrf_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>geqrf_batched_plan_create.
+    @param[inout]
+    A               array of pointers to type. Each pointer points to an array on the GPU.\n
+                    The matrices to be factored, as in the routine.
+    @param[out]
+    ipiv            pointer to type. Array on the GPU.\n
+                    The Householder scalars, as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      float *const A[],
+                                                                      float *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      double *const A[],
+                                                                      double *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_float_complex *const A[],
+                                                                      rocblas_float_complex *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_double_complex *const A[],
+                                                                      rocblas_double_complex *ipiv);
+
+/*! \brief GEQRF_STRIDED_BATCHED_PLAN_CREATE creates a plan for the QR factorization of a batch of general m-by-n matrices.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in geqrf_strided_batched; the plan 
+    can only be executed with rocsolver_<type>geqrf_strided_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrices.
+    @param[in]
+    lda             rocblas_int. lda >= m.\n
+                    Specifies the leading dimension of the matrices.
+    @param[in]
+    strideA         rocblas_stride.\n
+                    Stride from the start of one matrix to the next one.
+    @param[in]
+    stridep         rocblas_stride.\n
+                    Stride from the start of one vector ipiv to the next one.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride stridep,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride stridep,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride stridep,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_int m,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride stridep,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+/*! \brief GEQRF_STRIDED_BATCHED_PLAN_EXECUTE computes the QR factorization of a batch of general m-by-n matrices with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>geqrf_strided_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>geqrf_strided_batched_plan_create.
+    @param[inout]
+    A               pointer to type. Array on the GPU.\n
+                    The matrix (or matrices) to be factored, as in the routine.
+    @param[out]
+    ipiv            pointer to type. Array on the GPU.\n
+                    The Householder scalars, as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              float *A,
+                                                                              float *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              double *A,
+                                                                              double *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_float_complex *A,
+                                                                              rocblas_float_complex *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_double_complex *A,
+                                                                              rocblas_double_complex *ipiv);
+
+
+/*! \brief GETRS_PLAN_CREATE creates a plan for the solution of a system of linear equations, using the LU factorization computed by GETRF.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in getrs; the plan 
+    can only be executed with rocsolver_<type>getrs_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    trans           rocblas_operation.\n
+                    Specifies the form of the system of equations.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The order of the matrices A.
+    @param[in]
+    nrhs            rocblas_int. nrhs >= 0.\n
+                    The number of right hand sides (columns of the matrices B).
+    @param[in]
+    lda             rocblas_int. lda >= n.\n
+                    Specifies the leading dimension of the matrices A.
+    @param[in]
+    ldb             rocblas_int. ldb >= n.\n
+                    Specifies the leading dimension of the matrices B.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_plan_create(rocblas_handle handle,
+                                                             const rocblas_operation trans,
+                                                             const rocblas_int n,
+                                                             const rocblas_int nrhs,
+                                                             const rocblas_int lda,
+                                                             const rocblas_int ldb,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_plan_create(rocblas_handle handle,
+                                                             const rocblas_operation trans,
+                                                             const rocblas_int n,
+                                                             const rocblas_int nrhs,
+                                                             const rocblas_int lda,
+                                                             const rocblas_int ldb,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_plan_create(rocblas_handle handle,
+                                                             const rocblas_operation trans,
+                                                             const rocblas_int n,
+                                                             const rocblas_int nrhs,
+                                                             const rocblas_int lda,
+                                                             const rocblas_int ldb,
+                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_plan_create(rocblas_handle handle,
+                                                             const rocblas_operation trans,
+                                                             const rocblas_int n,
+                                                             const rocblas_int nrhs,
+                                                             const rocblas_int lda,
+                                                             const rocblas_int ldb,
+                                                             rocsolver_plan *plan);
+
+/*! \brief GETRS_PLAN_EXECUTE computes the solution of a system of linear equations with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>getrs with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>getrs_plan_create.
+    @param[in]
+    A               pointer to type. Array on the GPU.\n
+                    The factors L and U of the factorization(s), as in the routine.
+    @param[in]
+    ipiv            pointer to rocblas_int. Array on the GPU.\n
+                    The pivot indices returned by GETRF, as in the routine.
+    @param[inout]
+    B               pointer to type. Array on the GPU.\n
+                    The right hand sides on entry and the solutions on exit, as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_plan_execute(rocsolver_plan plan,
+                                                              float *A,
+                                                              const rocblas_int *ipiv,
+                                                              float *B);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_plan_execute(rocsolver_plan plan,
+                                                              double *A,
+                                                              const rocblas_int *ipiv,
+                                                              double *B);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_plan_execute(rocsolver_plan plan,
+                                                              rocblas_float_complex *A,
+                                                              const rocblas_int *ipiv,
+                                                              rocblas_float_complex *B);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_plan_execute(rocsolver_plan plan,
+                                                              rocblas_double_complex *A,
+                                                              const rocblas_int *ipiv,
+                                                              rocblas_double_complex *B);
+
+/*! \brief GETRS_BATCHED_PLAN_CREATE creates a plan for the solution of a batch of systems of linear equations, using the LU factorization computed by GETRF.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in getrs_batched; the plan 
+    can only be executed with rocsolver_<type>getrs_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    trans           rocblas_operation.\n
+                    Specifies the form of the system of equations.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The order of the matrices A.
+    @param[in]
+    nrhs            rocblas_int. nrhs >= 0.\n
+                    The number of right hand sides (columns of the matrices B).
+    @param[in]
+    lda             rocblas_int. lda >= n.\n
+                    Specifies the leading dimension of the matrices A.
+    @param[in]
+    strideP         rocblas_stride.\n
+                    Stride from the start of one vector ipiv to the next one.
+    @param[in]
+    ldb             rocblas_int. ldb >= n.\n
+                    Specifies the leading dimension of the matrices B.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of systems in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched_plan_create(rocblas_handle handle,
+                                                                     const rocblas_operation trans,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int nrhs,
+                                                                     const rocblas_int lda,
+                                                                     const rocblas_stride strideP,
+                                                                     const rocblas_int ldb,
+                                                                     const rocblas_int batch_count,
+                                                                     rocsolver_plan *plan);
+
+/*! \brief GETRS_BATCHED_PLAN_EXECUTE computes the solution of a batch of systems of linear equations with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>getrs_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>getrs_batched_plan_create.
+    @param[in]
+    A               array of pointers to type. Each pointer points to an array on the GPU.\n
+                    The factors L and U of the factorizations, as in the routine.
+    @param[in]
+    ipiv            pointer to rocblas_int. Array on the GPU.\n
+                    The pivot indices returned by GETRF, as in the routine.
+    @param[inout]
+    B               array of pointers to type. Each pointer points to an array on the GPU.\n
+                    The right hand sides on entry and the solutions on exit, as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_batched_plan_execute(rocsolver_plan plan,
+                                                                      float *const A[],
+                                                                      const rocblas_int *ipiv,
+                                                                      float *const B[]);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_batched_plan_execute(rocsolver_plan plan,
+                                                                      double *const A[],
+                                                                      const rocblas_int *ipiv,
+                                                                      double *const B[]);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_float_complex *const A[],
+                                                                      const rocblas_int *ipiv,
+                                                                      rocblas_float_complex *const B[]);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched_plan_execute(rocsolver_plan plan,
+                                                                      rocblas_double_complex *const A[],
+                                                                      const rocblas_int *ipiv,
+                                                                      rocblas_double_complex *const B[]);
+
+/*! \brief GETRS_STRIDED_BATCHED_PLAN_CREATE creates a plan for the solution of a batch of systems of linear equations, using the LU factorization computed by GETRF.
+
+    \details
+    See rocsolver_destroy_plan. The arguments have the same meaning as in getrs_strided_batched; the plan 
+    can only be executed with rocsolver_<type>getrs_strided_batched_plan_execute.
+
+    @param[in]
+    handle          rocblas_handle.
+    @param[in]
+    trans           rocblas_operation.\n
+                    Specifies the form of the system of equations.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The order of the matrices A.
+    @param[in]
+    nrhs            rocblas_int. nrhs >= 0.\n
+                    The number of right hand sides (columns of the matrices B).
+    @param[in]
+    lda             rocblas_int. lda >= n.\n
+                    Specifies the leading dimension of the matrices A.
+    @param[in]
+    strideA         rocblas_stride.\n
+                    Stride from the start of one matrix A to the next one.
+    @param[in]
+    strideP         rocblas_stride.\n
+                    Stride from the start of one vector ipiv to the next one.
+    @param[in]
+    ldb             rocblas_int. ldb >= n.\n
+                    Specifies the leading dimension of the matrices B.
+    @param[in]
+    strideB         rocblas_stride.\n
+                    Stride from the start of one matrix B to the next one.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of systems in the batch.
+    @param[out]
+    plan            pointer to rocsolver_plan.\n
+                    The plan created.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_operation trans,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int nrhs,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int ldb,
+                                                                             const rocblas_stride strideB,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_operation trans,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int nrhs,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int ldb,
+                                                                             const rocblas_stride strideB,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_operation trans,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int nrhs,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int ldb,
+                                                                             const rocblas_stride strideB,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched_plan_create(rocblas_handle handle,
+                                                                             const rocblas_operation trans,
+                                                                             const rocblas_int n,
+                                                                             const rocblas_int nrhs,
+                                                                             const rocblas_int lda,
+                                                                             const rocblas_stride strideA,
+                                                                             const rocblas_stride strideP,
+                                                                             const rocblas_int ldb,
+                                                                             const rocblas_stride strideB,
+                                                                             const rocblas_int batch_count,
+                                                                             rocsolver_plan *plan);
+
+/*! \brief GETRS_STRIDED_BATCHED_PLAN_EXECUTE computes the solution of a batch of systems of linear equations with a plan.
+
+    \details
+    It is equivalent to rocsolver_<type>getrs_strided_batched with the arguments of the plan. It returns 
+    rocblas_status_invalid_value if the plan was not created for this function.
+
+    @param[in]
+    plan            rocsolver_plan.\n
+                    A plan created by rocsolver_<type>getrs_strided_batched_plan_create.
+    @param[in]
+    A               pointer to type. Array on the GPU.\n
+                    The factors L and U of the factorization(s), as in the routine.
+    @param[in]
+    ipiv            pointer to rocblas_int. Array on the GPU.\n
+                    The pivot indices returned by GETRF, as in the routine.
+    @param[inout]
+    B               pointer to type. Array on the GPU.\n
+                    The right hand sides on entry and the solutions on exit, as in the routine.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              float *A,
+                                                                              const rocblas_int *ipiv,
+                                                                              float *B);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              double *A,
+                                                                              const rocblas_int *ipiv,
+                                                                              double *B);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_float_complex *A,
+                                                                              const rocblas_int *ipiv,
+                                                                              rocblas_float_complex *B);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched_plan_execute(rocsolver_plan plan,
+                                                                              rocblas_double_complex *A,
+                                                                              const rocblas_int *ipiv,
+                                                                              rocblas_double_complex *B);
+
 
 #ifdef __cplusplus
 }
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_lacgv.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_lacgv_impl(rocblas_handle handle, const rocblas_int n, T* x, const rocblas_int incx)
@@ -10,7 +11,9 @@ rocblas_status rocsolver_lacgv_impl(rocblas_handle handle, const rocblas_int n,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    // logging
+    rocsolver_logger log(handle,"lacgv",rocsolver_precision<T>());
+    log.arg("n",n,"sizen").arg("x",x).arg("incx",incx,"incx").start();
 
     // argument checking
     if (n < 0 || !incx)
@@ -21,6 +24,11 @@ rocblas_status rocsolver_lacgv_impl(rocblas_handle handle, const rocblas_int n,
     rocblas_stride stridex = 0;
     rocblas_int batch_count = 1;
 
+    // memory managment
+    // this function does not requiere memory work space
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle);
+
     // execution
     rocblas_status status =
            rocsolver_lacgv_template<T>(handle,
@@ -45,6 +45,8 @@ rocblas_status rocsolver_lacgv_template(rocblas_handle handle, const rocblas_int
     if (n == 0 || !batch_count || !COMPLEX)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "lacgv");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -53,8 +55,8 @@ rocblas_status rocsolver_lacgv_template(rocblas_handle handle, const rocblas_int
 
     // conjugate x
     rocblas_int blocks = (n - 1)/1024 + 1;
-    hipLaunchKernelGGL(conj_in_place<T>, dim3(1,blocks,batch_count), dim3(1,1024,1), 0, stream,
-                       1, n, x, offset, incx, stridex);
+    ROCSOLVER_LAUNCH_KERNEL(conj_in_place<T>, dim3(1,blocks,batch_count), dim3(1,1024,1), 0, stream,
+                            1, n, x, offset, incx, stridex);
 
     return rocblas_status_success;
 }
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larf.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side side, const rocblas_int m, 
@@ -12,7 +13,10 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side sid
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    // logging
+    rocsolver_logger log(handle,"larf",rocsolver_precision<T>());
+    log.arg("side",side,"side").arg("m",m,"sizem").arg("n",n,"sizen").arg("x",x)
+       .arg("incx",incx,"incx").arg("alpha",alpha).arg("A",A).arg("lda",lda,"lda").start();
 
     // argument checking
     if (n < 0 || m < 0 || lda < m || !incx)
@@ -26,26 +30,25 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side sid
     rocblas_int batch_count=1;
     
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     rocsolver_larf_getMemorySize<T,false>(side,m,n,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE    
-    void *scalars, *work, *workArr;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr))
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"larf",size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *workArr = mem[1];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -64,9 +67,6 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side sid
                                       (T*)work,
                                       (T**)workArr);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
     return status;
 }
 
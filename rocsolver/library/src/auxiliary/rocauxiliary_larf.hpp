@@ -57,6 +57,8 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle, const rocblas_side
     if (n == 0 || m == 0 || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "larf");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larfb.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larfb_impl(rocblas_handle handle, const rocblas_side side, 
@@ -15,7 +16,12 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle, const rocblas_side si
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???
+    // logging
+    rocsolver_logger log(handle,"larfb",rocsolver_precision<T>());
+    log.arg("side",side,"side").arg("trans",trans,"transposeH").arg("direct",direct,"direct")
+       .arg("storev",storev,"storev").arg("m",m,"sizem").arg("n",n,"sizen").arg("k",k,"sizek")
+       .arg("V",V).arg("ldv",ldv,"ldv").arg("F",F).arg("ldf",ldf,"ldt").arg("A",A)
+       .arg("lda",lda,"lda").start();
 
     // argument checking
     if (m < 0 || n < 0 || k < 1 || lda < m || ldf < k)
@@ -40,12 +46,14 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle, const rocblas_side si
     size_t size_2;  //size of array of pointers to workspace
     rocsolver_larfb_getMemorySize<T,false>(side,m,n,k,batch_count,&size_1,&size_2);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *work, *workArr;
-    hipMalloc(&work,size_1);
-    hipMalloc(&workArr,size_2);
-    if ((size_1 && !work) || (size_2 && !workArr))
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_1,size_2);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"larfb",size_1,size_2);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *workArr = mem[1];
 
     //  execution
     rocblas_status status = 
@@ -64,8 +72,6 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle, const rocblas_side si
                                                   (T*)work,
                                                   (T**)workArr);
 
-    hipFree(work);
-    hipFree(workArr);
     return status;
 
 }
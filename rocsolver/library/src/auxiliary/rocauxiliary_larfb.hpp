@@ -97,9 +97,10 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     if (!m || !n || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "larfb");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
-    T *Vp, *Fp;
 
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
@@ -110,15 +111,6 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     T minone = -1;               
     T one = 1;               
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRMM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* VV[batch_count];
-        hipMemcpy(VV, V, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* VV = V;
-    #endif
-
     //determine the side, size of workspace
     //and whether V is trapezoidal
     bool trap;
@@ -157,13 +149,10 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     }
     rocblas_stride strideW = rocblas_stride(ldw)*order;
 
-    // **** TRMM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED ****
-
     //copy A1 to work
     rocblas_int blocksx = (order - 1)/32 + 1;
     rocblas_int blocksy = (ldw - 1)/32 + 1;
-    hipLaunchKernelGGL(copymatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
+    ROCSOLVER_LAUNCH_KERNEL(copymatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
     
     // BACKWARD DIRECTION TO BE IMPLEMENTED...
     rocblas_fill uploT = rocblas_fill_upper;
@@ -174,10 +163,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // V1' * A1, or
     //   or 
     // A1 * V1
-    for (int b=0;b<batch_count;++b) {
-        Vp = load_ptr_batch<T>(VV,b,shiftV,strideV);
-        rocblas_trmm(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,&one,Vp,ldv,(work + b*strideW),ldw);
-    }
+    rocblasCall_trmm<T>(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,
+                        V,shiftV,ldv,strideV,work,0,ldw,strideW,batch_count);
 
     // compute:
     // V1' * A1 + V2' * A2 
@@ -203,10 +190,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // (A1 * V1 + A2 * V2) * trans(T)    
-    for (int b=0;b<batch_count;++b) {
-        Fp = load_ptr_batch<T>(F,b,shiftF,strideF);
-        rocblas_trmm(handle,side,uploT,transt,rocblas_diagonal_non_unit,ldw,order,&one,Fp,ldf,(work + b*strideW),ldw);
-    }
+    rocblasCall_trmm<T>(handle,side,uploT,transt,rocblas_diagonal_non_unit,ldw,order,
+                        F,shiftF,ldf,strideF,work,0,ldw,strideW,batch_count);
 
     // compute:
     // A2 - V2 * trans(T) * (V1' * A1 + V2' * A2)
@@ -237,16 +222,14 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // V1 * trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // (A1 * V1 + A2 * V2) * trans(T) * V1'    
-    for (int b=0;b<batch_count;++b) {
-        Vp = load_ptr_batch<T>(VV,b,shiftV,strideV);
-        rocblas_trmm(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,&one,Vp,ldv,(work + b*strideW),ldw);
-    }
+    rocblasCall_trmm<T>(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,
+                        V,shiftV,ldv,strideV,work,0,ldw,strideW,batch_count);
     
     // compute:
     // A1 - V1 * trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // A1 - (A1 * V1 + A2 * V2) * trans(T) * V1'
-    hipLaunchKernelGGL(addmatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
+    ROCSOLVER_LAUNCH_KERNEL(addmatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
    
     rocblas_set_pointer_mode(handle,old_mode);
     return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larfg.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n, T *alpha, T *x, const rocblas_int incx, T *tau) 
@@ -10,7 +11,9 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???
+    // logging
+    rocsolver_logger log(handle,"larfg",rocsolver_precision<T>());
+    log.arg("n",n,"sizen").arg("alpha",alpha).arg("x",x).arg("incx",incx,"incx").arg("tau",tau).start();
 
     // argument checking
     if (n < 0 || incx < 1)
@@ -27,12 +30,14 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n,
     size_t size_2;  //size of workspace
     rocsolver_larfg_getMemorySize<T>(n,batch_count,&size_1,&size_2);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *norms, *work;
-    hipMalloc(&norms,size_1);
-    hipMalloc(&work, size_2);
-    if (!norms || (size_2 && !work)) 
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_1,size_2);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"larfg",size_1,size_2);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *norms = mem[0], *work = mem[1];
 
     // execution
     rocblas_status status =
@@ -47,8 +52,6 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n,
                                       (T*)norms,
                                       (T*)work);
 
-    hipFree(norms);
-    hipFree(work);
     return status;
 }
 
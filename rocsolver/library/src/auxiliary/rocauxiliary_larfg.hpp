@@ -90,6 +90,8 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle, const rocblas_int
     if (n == 0 || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "larfg");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     
@@ -102,7 +104,7 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle, const rocblas_int
     dim3 gridReset(1, batch_count, 1);
     dim3 threads(1, 1, 1); 
     if (n == 1 && !COMPLEX) {
-        hipLaunchKernelGGL(reset_batch_info,gridReset,threads,0,stream,tau,strideP,1,0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info,gridReset,threads,0,stream,tau,strideP,1,0);
         rocblas_set_pointer_mode(handle,old_mode);
         return rocblas_status_success;    
     }
@@ -113,7 +115,7 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle, const rocblas_int
 
     //set value of tau and beta and scalling factor for vector x
     //alpha <- beta, norms <- scaling   
-    hipLaunchKernelGGL(set_taubeta<T>,dim3(batch_count),dim3(1),0,stream,tau,strideP,norms,alpha,shifta,stridex);
+    ROCSOLVER_LAUNCH_KERNEL(set_taubeta<T>,dim3(batch_count),dim3(1),0,stream,tau,strideP,norms,alpha,shifta,stridex);
      
     //compute vector v=x*norms
     rocblasCall_scal<T>(handle, n-1, norms, 1, x, shiftx, incx, stridex, batch_count);
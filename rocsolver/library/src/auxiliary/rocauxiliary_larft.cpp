@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larft.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larft_impl(rocblas_handle handle, const rocblas_direct direct, 
@@ -13,7 +14,11 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle, const rocblas_direct
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???
+    // logging
+    rocsolver_logger log(handle,"larft",rocsolver_precision<T>());
+    log.arg("direct",direct,"direct").arg("storev",storev,"storev").arg("n",n,"sizen")
+       .arg("k",k,"sizek").arg("V",V).arg("ldv",ldv,"ldv").arg("tau",tau).arg("F",F)
+       .arg("ldf",ldf,"ldt").start();
 
     // argument checking
     if (n < 0 || k < 1 || ldf < k)
@@ -31,26 +36,25 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle, const rocblas_direct
     rocblas_int batch_count=1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     rocsolver_larft_getMemorySize<T,false>(k,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *workArr;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr))
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"larft",size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *workArr = mem[1];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status = 
@@ -69,9 +73,6 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle, const rocblas_direct
                                       (T*)work,
                                       (T**)workArr);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
     return status;
 }
 
@@ -109,7 +109,7 @@ void rocsolver_larft_getMemorySize(const rocblas_int k, const rocblas_int batch_
                                   size_t *size)
 {
     // size of workspace
-    *size *= sizeof(T)*k*batch_count;
+    *size = sizeof(T)*k*batch_count;
 }
 
 
@@ -125,6 +125,8 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle, const rocblas_dir
     if (!n || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "larft");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -149,9 +151,9 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle, const rocblas_dir
     //setup tau (changing signs) and account for the non-stored 1's on the householder vectors
     rocblas_int blocks1 = (k - 1)/32 + 1;
     rocblas_int blocks2 = (n - 1)/32 + 1;
-    hipLaunchKernelGGL(set_triangular,dim3(blocks1,blocks1,batch_count),dim3(32,32),0,stream,
-                        k,V,shiftV,ldv,strideV,tau,strideT,F,ldf,strideF,storev);
-    hipLaunchKernelGGL(set_tau,dim3(blocks1,batch_count),dim3(32,1),0,stream,k,tau,strideT);
+    ROCSOLVER_LAUNCH_KERNEL(set_triangular,dim3(blocks1,blocks1,batch_count),dim3(32,32),0,stream,
+                             k,V,shiftV,ldv,strideV,tau,strideT,F,ldf,strideF,storev);
+    ROCSOLVER_LAUNCH_KERNEL(set_tau,dim3(blocks1,batch_count),dim3(32,1),0,stream,k,tau,strideT);
 
     // **** FOR NOW, IT DOES NOT LOOK FOR TRAILING ZEROS 
     //      AS THIS WOULD REQUIRE SYNCHRONIZATION WITH GPU.
@@ -191,7 +193,7 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle, const rocblas_dir
     }
 
     //restore tau
-    hipLaunchKernelGGL(set_tau,dim3(blocks1,batch_count),dim3(32,1),0,stream,k,tau,strideT);
+    ROCSOLVER_LAUNCH_KERNEL(set_tau,dim3(blocks1,batch_count),dim3(32,1),0,stream,k,tau,strideT);
 
     rocblas_set_pointer_mode(handle,old_mode);  
     return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_laswp.hpp"
+#include "handle.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_laswp_impl(rocblas_handle handle, const rocblas_int n, U A, const rocblas_int lda,
@@ -11,7 +12,10 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle, const rocblas_int n,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    // logging
+    rocsolver_logger log(handle,"laswp",rocsolver_precision<T>());
+    log.arg("n",n,"sizen").arg("A",A).arg("lda",lda,"lda").arg("k1",k1,"k1").arg("k2",k2,"k2")
+       .arg("ipiv",ipiv).arg("incx",incx,"incx").start();
 
     // argument checking
     if (n < 0 || lda < 1 || !incx || k1 < 1 || k2 < 1)
@@ -27,7 +31,8 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle, const rocblas_int n,
     
     // memory managment
     // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle);
 
     // execution 
     return rocsolver_laswp_template<T>(handle,n,
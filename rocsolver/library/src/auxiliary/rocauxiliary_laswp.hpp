@@ -12,36 +12,49 @@
 
 #include "rocblas.hpp"
 #include "rocsolver.h"
+#include "ideal_sizes.hpp"
 #include "common_device.hpp"
 
-template <typename T>
-__device__ void swap(const rocblas_int n, T *a, const rocblas_int lda,
-                               const rocblas_int i,
-                               const rocblas_int exch) {
-
-    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    if (tid < n) {
-        T orig = a[i + lda * tid];
-        a[i + lda * tid] = a[exch + lda * tid];
-        a[exch + lda * tid] = orig;
-    }
-}
-
 template <typename T, typename U>
 __global__ void laswp_kernel(const rocblas_int n, U AA, const rocblas_int shiftA,
-                            const rocblas_int lda, const rocblas_stride stride, const rocblas_int i, const rocblas_int k1,
+                            const rocblas_int lda, const rocblas_stride stride, const rocblas_int start, const rocblas_int end,
+                            const rocblas_int inc, const rocblas_int k1,
                             const rocblas_int *ipivA, const rocblas_int shiftP, const rocblas_stride strideP, const rocblas_int incx) {
 
     int id = hipBlockIdx_y;
+    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
     //shiftP must be used so that ipiv[k1] is the desired first index of ipiv
     const rocblas_int *ipiv = ipivA + id*strideP + shiftP;
-    rocblas_int exch = ipiv[k1 + (i - k1) * incx - 1];
-
-    //will exchange rows i and exch if they are not the same
-    if (exch != i) {
-        T* A = load_ptr_batch(AA,id,shiftA,stride);
-        swap(n,A,lda,i-1,exch-1);  //row indices are base-1 from the API
+    T* A = load_ptr_batch(AA,id,shiftA,stride);
+
+    // every thread applies all the interchanges to its column; the pivot indices
+    // are read once, in chunks of LASWP_BLOCKSIZE, and shared by the work-group
+    __shared__ rocblas_int exch[LASWP_BLOCKSIZE];
+    rocblas_int npiv = (end - start) * inc;
+
+    for (rocblas_int c = 0; c < npiv; c += LASWP_BLOCKSIZE) {
+        rocblas_int nc = min(npiv - c, LASWP_BLOCKSIZE);
+        if (hipThreadIdx_x < nc) {
+            rocblas_int i = start + (c + hipThreadIdx_x) * inc;
+            exch[hipThreadIdx_x] = ipiv[k1 + (i - k1) * incx - 1];
+        }
+        __syncthreads();
+
+        if (tid < n) {
+            T *a = A + lda * tid;
+            for (rocblas_int p = 0; p < nc; ++p) {
+                //will exchange rows i and exch if they are not the same
+                //(row indices are base-1 from the API)
+                rocblas_int i = start + (c + p) * inc;
+                if (exch[p] != i) {
+                    T orig = a[i - 1];
+                    a[i - 1] = a[exch[p] - 1];
+                    a[exch[p] - 1] = orig;
+                }
+            }
+        }
+        __syncthreads();
     }
 }
 
@@ -55,6 +68,8 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle, const rocblas_int
     if (n == 0 || !batch_count) 
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "laswp");
+
     rocblas_int start, end, inc;
     if (incx < 0) {
         start = k2;
@@ -75,10 +90,9 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle, const rocblas_int
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    for (rocblas_int i = start; i != end; i += inc) {
-        hipLaunchKernelGGL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA,
-                           lda, strideA, i, k1, ipiv, shiftP, strideP, incx);
-    }
+    // all the interchanges are applied with a single launch
+    ROCSOLVER_LAUNCH_KERNEL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA,
+                            lda, strideA, start, end, inc, k1, ipiv, shiftP, strideP, incx);
 
     return rocblas_status_success;
 
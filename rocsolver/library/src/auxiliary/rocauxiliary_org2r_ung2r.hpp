@@ -63,6 +63,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle, const rocbl
     if (!n || !m || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, is_complex<T> ? "ung2r" : "org2r");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -74,8 +76,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle, const rocbl
     // Initialize identity matrix (non used columns)
     rocblas_int blocksx = (m - 1)/32 + 1;
     rocblas_int blocksy = (n - 1)/32 + 1;
-    hipLaunchKernelGGL(init_ident_col<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
-                        m,n,k,A,shiftA,lda,strideA);
+    ROCSOLVER_LAUNCH_KERNEL(init_ident_col<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
+                             m,n,k,A,shiftA,lda,strideA);
 
     for (rocblas_int j = k-1; j >= 0; --j) {
         // apply H(i) to Q(i:m,i:n) from the left
@@ -93,8 +95,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle, const rocbl
         }
 
         // set the diagonal element and negative tau
-        hipLaunchKernelGGL(setdiag<T>,dim3(batch_count),dim3(1),0,stream,
-                            j,A,shiftA,lda,strideA,ipiv,strideP);
+        ROCSOLVER_LAUNCH_KERNEL(setdiag<T>,dim3(batch_count),dim3(1),0,stream,
+                                 j,A,shiftA,lda,strideA,ipiv,strideP);
         
         // update i-th column -corresponding to H(i)-
         if (j < m - 1) 
@@ -104,8 +106,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle, const rocbl
     // restore values of tau
     if (k > 0) {
         blocksx = (k - 1)/128 + 1;
-        hipLaunchKernelGGL(restau<T>,dim3(blocksx,batch_count),dim3(128),0,stream,
-                            k,ipiv,strideP);
+        ROCSOLVER_LAUNCH_KERNEL(restau<T>,dim3(blocksx,batch_count),dim3(128),0,stream,
+                                 k,ipiv,strideP);
     }
 
     rocblas_set_pointer_mode(handle,old_mode);
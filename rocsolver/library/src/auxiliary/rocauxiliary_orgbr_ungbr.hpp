@@ -83,25 +83,25 @@ __global__ void copyshift_row(const bool copy, const rocblas_int dim, U A, const
 }
 
 template <typename T, bool BATCHED>
-void rocsolver_orgbr_ungbr_getMemorySize(const rocblas_storev storev, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
+void rocsolver_orgbr_ungbr_getMemorySize(rocblas_handle handle, const rocblas_storev storev, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
                                          size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
 {
     if (storev == rocblas_column_wise) {
         if (m >= k) {
-            rocsolver_orgqr_ungqr_getMemorySize<T,BATCHED>(m,n,k,batch_count,size_1,size_2,size_3,size_4);
+            rocsolver_orgqr_ungqr_getMemorySize<T,BATCHED>(handle,m,n,k,batch_count,size_1,size_2,size_3,size_4);
         } else {
             size_t s1 = sizeof(T)*batch_count*(m-1)*m/2;
             size_t s2;
-            rocsolver_orgqr_ungqr_getMemorySize<T,BATCHED>(m-1,m-1,m-1,batch_count,size_1,&s2,size_3,size_4);
+            rocsolver_orgqr_ungqr_getMemorySize<T,BATCHED>(handle,m-1,m-1,m-1,batch_count,size_1,&s2,size_3,size_4);
             *size_2 = max(s1,s2);
         }
     } else {
         if (n > k) {
-            rocsolver_orglq_unglq_getMemorySize<T,BATCHED>(m,n,k,batch_count,size_1,size_2,size_3,size_4);
+            rocsolver_orglq_unglq_getMemorySize<T,BATCHED>(handle,m,n,k,batch_count,size_1,size_2,size_3,size_4);
         } else {
             size_t s1 = sizeof(T)*batch_count*(n-1)*n/2;
             size_t s2;
-            rocsolver_orglq_unglq_getMemorySize<T,BATCHED>(n-1,n-1,n-1,batch_count,size_1,&s2,size_3,size_4);
+            rocsolver_orglq_unglq_getMemorySize<T,BATCHED>(handle,n-1,n-1,n-1,batch_count,size_1,&s2,size_3,size_4);
             *size_2 = max(s1,s2);
         }
     }
@@ -134,12 +134,12 @@ rocblas_status rocsolver_orgbr_ungbr_template(rocblas_handle handle, const rocbl
             rocblas_int blocks = (m - 2)/BS + 1;
 
             // copy
-            hipLaunchKernelGGL(copyshift_col<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
-                                true,m-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_col<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
+                                     true,m-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
 
             // shift
-            hipLaunchKernelGGL(copyshift_col<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
-                                false,m-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_col<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
+                                     false,m-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
             
             // result
             rocsolver_orgqr_ungqr_template<BATCHED,STRIDED,T>(handle, m-1, m-1, m-1, A, shiftA + idx2D(1,1,lda), lda, strideA, ipiv, strideP, batch_count,
@@ -160,12 +160,12 @@ rocblas_status rocsolver_orgbr_ungbr_template(rocblas_handle handle, const rocbl
             rocblas_int blocks = (n - 2)/BS + 1;
 
             // copy
-            hipLaunchKernelGGL(copyshift_row<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
-                                true,n-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_row<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
+                                     true,n-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
 
             // shift
-            hipLaunchKernelGGL(copyshift_row<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
-                                false,n-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_row<T>,dim3(blocks,blocks,batch_count),dim3(BS,BS),0,stream, 
+                                     false,n-1,A,shiftA,lda,strideA,work,0,ldw,strideW);           
 
             // result
             rocsolver_orglq_unglq_template<BATCHED,STRIDED,T>(handle, n-1, n-1, n-1, A, shiftA + idx2D(1,1,lda), lda, strideA, ipiv, strideP, batch_count,
@@ -65,6 +65,8 @@ rocblas_status rocsolver_orgl2_ungl2_template(rocblas_handle handle, const rocbl
     if (!n || !m || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, is_complex<T> ? "ungl2" : "orgl2");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
    
@@ -76,8 +78,8 @@ rocblas_status rocsolver_orgl2_ungl2_template(rocblas_handle handle, const rocbl
     // Initialize identity matrix (non used columns)
     rocblas_int blocksx = (m - 1)/32 + 1;
     rocblas_int blocksy = (n - 1)/32 + 1;
-    hipLaunchKernelGGL(init_ident_row<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
-                        m,n,k,A,shiftA,lda,strideA);
+    ROCSOLVER_LAUNCH_KERNEL(init_ident_row<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
+                             m,n,k,A,shiftA,lda,strideA);
 
     for (rocblas_int j = k-1; j >= 0; --j) {
         if (COMPLEX)
@@ -102,8 +104,8 @@ rocblas_status rocsolver_orgl2_ungl2_template(rocblas_handle handle, const rocbl
         }
 
         // set the diagonal element and negative tau
-        hipLaunchKernelGGL(setdiag<T>,dim3(batch_count),dim3(1),0,stream,
-                            j,A,shiftA,lda,strideA,ipiv,strideP);
+        ROCSOLVER_LAUNCH_KERNEL(setdiag<T>,dim3(batch_count),dim3(1),0,stream,
+                                 j,A,shiftA,lda,strideA,ipiv,strideP);
 
         if (COMPLEX)
             rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
@@ -118,8 +120,8 @@ rocblas_status rocsolver_orgl2_ungl2_template(rocblas_handle handle, const rocbl
     
     // restore values of tau
     blocksx = (k - 1)/128 + 1;
-    hipLaunchKernelGGL(restau<T>,dim3(blocksx,batch_count),dim3(128),0,stream,
-                            k,ipiv,strideP);
+    ROCSOLVER_LAUNCH_KERNEL(restau<T>,dim3(blocksx,batch_count),dim3(128),0,stream,
+                                 k,ipiv,strideP);
  
     rocblas_set_pointer_mode(handle,old_mode);
     return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_orglq_unglq.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle, const rocblas_int m, const rocblas_int n, 
@@ -11,7 +12,10 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle, const rocblas_i
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???
+    // logging
+    rocsolver_logger log(handle,is_complex<T> ? "unglq" : "orglq",rocsolver_precision<T>());
+    log.arg("m",m,"sizem").arg("n",n,"sizen").arg("k",k,"sizek").arg("A",A).arg("lda",lda,"lda")
+       .arg("ipiv",ipiv).start();
 
     // argument checking
     if (m < 0 || n < 0 || n < m || k < 0 || k > m || lda < m)
@@ -24,28 +28,26 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle, const rocblas_i
     rocblas_int batch_count=1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     size_t size_4;  // size of temporary array for triangular factor
-    rocsolver_orglq_unglq_getMemorySize<T,false>(m,n,k,batch_count,&size_1,&size_2,&size_3,&size_4);
-
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *workArr, *trfact;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&trfact,size_4);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !trfact))
+    rocsolver_orglq_unglq_getMemorySize<T,false>(handle,m,n,k,batch_count,&size_1,&size_2,&size_3,&size_4);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"orglq_unglq",size_2,size_3,size_4);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *workArr = mem[1], *trfact = mem[2];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
     
     // execution
     rocblas_status status = 
@@ -62,10 +64,6 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle, const rocblas_i
                                                          (T**)workArr,
                                                          (T*)trfact);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(trfact);
     return status;
 }
 
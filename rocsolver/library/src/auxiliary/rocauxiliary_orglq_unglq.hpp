@@ -13,6 +13,7 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "tuning.hpp"
 #include "ideal_sizes.hpp"
 #include "../auxiliary/rocauxiliary_orgl2_ungl2.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
@@ -36,19 +37,22 @@ __global__ void set_zero_row(const rocblas_int m, const rocblas_int kk, U A,
 }
 
 template <typename T, bool BATCHED>
-void rocsolver_orglq_unglq_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
+void rocsolver_orglq_unglq_getMemorySize(rocblas_handle handle, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
                                          size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
 {
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, k, batch_count);
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_geqrf_blocksize, k, batch_count);
+
     size_t s1, s2, s3;
     rocsolver_orgl2_ungl2_getMemorySize<T,BATCHED>(m,n,batch_count,size_1,size_2,size_3);
 
-    if (k <= GEQRF_GEQR2_SWITCHSIZE) {
+    if (k <= nx) {
         *size_4 = 0;
     } else {
         // size of workspace
         // maximum of what is needed by org2r, larft and larfb
-        rocblas_int jb = GEQRF_GEQR2_BLOCKSIZE;
-        rocblas_int j = ((k - GEQRF_GEQR2_SWITCHSIZE - 1) / jb) * jb;
+        rocblas_int jb = nb;
+        rocblas_int j = ((k - nx - 1) / jb) * jb;
         rocblas_int kk = min(k, j + jb);
         rocsolver_orgl2_ungl2_getMemorySize<T>(max(m-kk,jb),n,batch_count,&s1);
         rocsolver_larft_getMemorySize<T>(jb, batch_count, &s2);
@@ -72,19 +76,25 @@ rocblas_status rocsolver_orglq_unglq_template(rocblas_handle handle, const rocbl
     if (!n || !m || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, is_complex<T> ? "unglq" : "orglq");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
+
+    // switch size and block size (the same as in the memory size query)
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, k, batch_count);
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_geqrf_blocksize, k, batch_count);
     
     // if the matrix is small, use the unblocked variant of the algorithm
-    if (k <= GEQRF_GEQR2_SWITCHSIZE) 
+    if (k <= nx) 
         return rocsolver_orgl2_ungl2_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work, workArr);
 
-    rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) *ldw;
 
     // start of first blocked block
-    rocblas_int jb = GEQRF_GEQR2_BLOCKSIZE;
-    rocblas_int j = ((k - GEQRF_GEQR2_SWITCHSIZE - 1) / jb) * jb;
+    rocblas_int jb = nb;
+    rocblas_int j = ((k - nx - 1) / jb) * jb;
     
     // start of the unblocked block
     rocblas_int kk = min(k, j + jb); 
@@ -96,8 +106,8 @@ rocblas_status rocsolver_orglq_unglq_template(rocblas_handle handle, const rocbl
     if (kk < m) {
         blocksx = (m - kk - 1)/32 + 1;
         blocksy = (kk - 1)/32 + 1;
-        hipLaunchKernelGGL(set_zero_row<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
-                           m,kk,A,shiftA,lda,strideA);
+        ROCSOLVER_LAUNCH_KERNEL(set_zero_row<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
+                                m,kk,A,shiftA,lda,strideA);
         
         rocsolver_orgl2_ungl2_template<T>(handle, m - kk, n - kk, k - kk, 
                                           A, shiftA + idx2D(kk, kk, lda), lda, 
@@ -128,8 +138,8 @@ rocblas_status rocsolver_orglq_unglq_template(rocblas_handle handle, const rocbl
         if (j > 0) {
             blocksx = (jb - 1)/32 + 1;
             blocksy = (j - 1)/32 + 1;
-            hipLaunchKernelGGL(set_zero_row<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
-                               j+jb,j,A,shiftA,lda,strideA);
+            ROCSOLVER_LAUNCH_KERNEL(set_zero_row<T>,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,
+                                    j+jb,j,A,shiftA,lda,strideA);
         }
         rocsolver_orgl2_ungl2_template<T>(handle, jb, n - j, jb, 
                                           A, shiftA + idx2D(j, j, lda), lda, 
@@ -40,6 +40,8 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle, const rocbl
     if (!n || !m || !k || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, COMPLEX ? "unm2r" : "orm2r");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -85,7 +87,7 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle, const rocbl
         }
     
         // insert one in A(i,i) tobuild/apply the householder matrix 
-        hipLaunchKernelGGL(set_one_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(i,i,lda),strideA);
+        ROCSOLVER_LAUNCH_KERNEL(set_one_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(i,i,lda),strideA);
 
         // Apply current Householder reflector 
         rocsolver_larf_template(handle,side,                        //side
@@ -100,7 +102,7 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle, const rocbl
                                 scalars, work, workArr);
 
         // restore original value of A(i,i)
-        hipLaunchKernelGGL(restore_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(i,i,lda),strideA);
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(i,i,lda),strideA);
     }
 
     // restore tau
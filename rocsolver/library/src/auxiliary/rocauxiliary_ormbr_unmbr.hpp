@@ -17,14 +17,14 @@
 #include "../auxiliary/rocauxiliary_ormlq_unmlq.hpp"
 
 template <typename T, bool BATCHED>
-void rocsolver_ormbr_unmbr_getMemorySize(const rocblas_storev storev, const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
+void rocsolver_ormbr_unmbr_getMemorySize(rocblas_handle handle, const rocblas_storev storev, const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
                                          size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
 {
     rocblas_int nq = side == rocblas_side_left ? m : n;
     if (storev == rocblas_column_wise)
-        rocsolver_ormqr_unmqr_getMemorySize<T,BATCHED>(side,m,n,min(nq,k),batch_count,size_1,size_2,size_3,size_4);
+        rocsolver_ormqr_unmqr_getMemorySize<T,BATCHED>(handle,side,m,n,min(nq,k),batch_count,size_1,size_2,size_3,size_4);
     else
-        rocsolver_ormlq_unmlq_getMemorySize<T,BATCHED>(side,m,n,min(nq,k),batch_count,size_1,size_2,size_3,size_4);
+        rocsolver_ormlq_unmlq_getMemorySize<T,BATCHED>(handle,side,m,n,min(nq,k),batch_count,size_1,size_2,size_3,size_4);
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename U, bool COMPLEX = is_complex<T>>
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_ormlq_unmlq.hpp"
+#include "handle.hpp"
 
 template <typename T, bool COMPLEX = is_complex<T>>
 rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle, const rocblas_side side, const rocblas_operation trans, 
@@ -12,7 +13,11 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle, const rocblas_s
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???
+    // logging
+    rocsolver_logger log(handle,COMPLEX ? "unmlq" : "ormlq",rocsolver_precision<T>());
+    log.arg("side",side,"side").arg("trans",trans,"transposeA").arg("m",m,"sizem")
+       .arg("n",n,"sizen").arg("k",k,"sizek").arg("A",A).arg("lda",lda,"lda").arg("ipiv",ipiv)
+       .arg("C",C).arg("ldc",ldc,"ldc").start();
 
     // argument checking
     if (m < 0 || n < 0 ||  k < 0 || ldc < m || lda < k)
@@ -34,28 +39,26 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle, const rocblas_s
     rocblas_int batch_count=1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  //size of array of pointers to workspace
     size_t size_4;  // size of temporary array for triangular factor or diagonal elements
-    rocsolver_ormlq_unmlq_getMemorySize<T,false>(side,m,n,k,batch_count,&size_1,&size_2,&size_3,&size_4);
-
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *workArr, *trfact;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&trfact,size_4);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !trfact))
+    rocsolver_ormlq_unmlq_getMemorySize<T,false>(handle,side,m,n,k,batch_count,&size_1,&size_2,&size_3,&size_4);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"ormlq_unmlq",size_2,size_3,size_4);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *workArr = mem[1], *trfact = mem[2];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status = 
@@ -75,10 +78,6 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle, const rocblas_s
                                                          (T**)workArr,
                                                          (T*)trfact);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(trfact);
     return status;
 }
 
@@ -13,21 +13,24 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "tuning.hpp"
 #include "../auxiliary/rocauxiliary_orm2r_unm2r.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
 #include "../auxiliary/rocauxiliary_larft.hpp"
 
 template <typename T, bool BATCHED>
-void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
+void rocsolver_ormqr_unmqr_getMemorySize(rocblas_handle handle, const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, const rocblas_int batch_count,
                                          size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
 {
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_ormqr_blocksize, k, batch_count);
+
     size_t s1, s2;
     rocsolver_orm2r_unm2r_getMemorySize<T,BATCHED>(side,m,n,batch_count,size_1,size_2,size_3,size_4);
 
-    if (k > ORMQR_ORM2R_BLOCKSIZE) {
+    if (k > nb) {
         // size of workspace
         // maximum of what is needed by larft and larfb
-        rocblas_int jb = ORMQR_ORM2R_BLOCKSIZE;
+        rocblas_int jb = nb;
         rocsolver_larft_getMemorySize<T>(min(jb,k), batch_count, &s1);
         rocsolver_larfb_getMemorySize<T>(side, m, n, min(jb,k), batch_count, &s2);
 
@@ -51,15 +54,20 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle, const rocbl
     if (!n || !m || !k || !batch_count)
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, is_complex<T> ? "unmqr" : "ormqr");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // block size (the same as in the memory size query)
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_ormqr_blocksize, k, batch_count);
+
     // if the matrix is small, use the unblocked variant of the algorithm
-    if (k <= ORMQR_ORM2R_BLOCKSIZE) 
+    if (k <= nb) 
         return rocsolver_orm2r_unm2r_template<T>(handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc, strideC, batch_count,
                                                  scalars, work, workArr, trfact);
 
-    rocblas_int ldw = ORMQR_ORM2R_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) *ldw;
 
     // determine limits and indices
@@ -31,3 +31,22 @@ extern "C" rocblas_status rocsolver_get_version_string(char* buf, size_t len)
 
     return rocblas_status_success;
 }
+
+/*******************************************************************************
+ *! \brief   loads char* buf with the git commit the library was built from.
+     size_t len is the maximum length of char* buf.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_get_commit_string(char* buf, size_t len)
+{
+    static constexpr char v[] = ROCSOLVER_COMMIT_ID;
+    if(!buf)
+        return rocblas_status_invalid_pointer;
+
+    if(len < sizeof(v))
+        return rocblas_status_invalid_size;
+
+    memcpy(buf, v, sizeof(v));
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "graph.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#ifdef ROCSOLVER_HIP_GRAPH
+
+bool rocsolver_stream_is_capturing(hipStream_t stream)
+{
+    hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+    return hipStreamIsCapturing(stream, &status) == hipSuccess && status == hipStreamCaptureStatusActive;
+}
+
+struct rocsolver_graph_entry
+{
+    rocsolver_graph_key key;
+    hipGraphExec_t exec;
+};
+
+struct rocsolver_graph_cache
+{
+    hipStream_t capture_stream = nullptr;
+    // (the most recently used graph is the last one)
+    std::vector<rocsolver_graph_entry> entries;
+};
+
+rocsolver_graph_cache* rocsolver_graph_cache_create()
+{
+    return new rocsolver_graph_cache;
+}
+
+void rocsolver_graph_cache_release(rocsolver_graph_cache *cache)
+{
+    if (!cache)
+        return;
+    for (auto &e : cache->entries)
+        hipGraphExecDestroy(e.exec);
+    if (cache->capture_stream)
+        hipStreamDestroy(cache->capture_stream);
+    delete cache;
+}
+
+bool rocsolver_graph_launch(rocsolver_graph_cache *cache, const rocsolver_graph_key &key, hipStream_t stream)
+{
+    auto it = std::find_if(cache->entries.begin(), cache->entries.end(), [&](const rocsolver_graph_entry &e) {
+        return !memcmp(e.key.args, key.args, sizeof(key.args));
+    });
+    if (it == cache->entries.end())
+        return false;
+
+    std::rotate(it, it + 1, cache->entries.end());
+    if (hipGraphLaunch(cache->entries.back().exec, stream) == hipSuccess)
+        return true;
+
+    // (the graph is released, so that the call is captured again and cached once for key)
+    hipGraphExecDestroy(cache->entries.back().exec);
+    cache->entries.pop_back();
+    return false;
+}
+
+rocblas_status rocsolver_graph_begin(rocsolver_graph_cache *cache, rocblas_handle handle)
+{
+    if (!cache->capture_stream
+        && hipStreamCreateWithFlags(&cache->capture_stream, hipStreamNonBlocking) != hipSuccess) {
+        cache->capture_stream = nullptr;
+        return rocblas_status_internal_error;
+    }
+
+    // (thread local, so that the calls made by other threads are not affected by the capture)
+    if (hipStreamBeginCapture(cache->capture_stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+        return rocblas_status_internal_error;
+    rocblas_set_stream(handle, cache->capture_stream);
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_graph_end(rocsolver_graph_cache *cache, rocblas_handle handle, hipStream_t stream,
+                                   const rocsolver_graph_key &key, rocblas_status status)
+{
+    rocblas_set_stream(handle, stream);
+
+    hipGraph_t graph = nullptr;
+    hipError_t error = hipStreamEndCapture(cache->capture_stream, &graph);
+    if (status != rocblas_status_success) {
+        if (graph)
+            hipGraphDestroy(graph);
+        return status;
+    }
+    if (error != hipSuccess || !graph)
+        return rocblas_status_internal_error;
+
+    hipGraphExec_t exec = nullptr;
+    error = hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0);
+    hipGraphDestroy(graph);
+    if (error != hipSuccess)
+        return rocblas_status_internal_error;
+
+    if (cache->entries.size() >= PLAN_MAX_GRAPHS) {
+        hipGraphExecDestroy(cache->entries.front().exec);
+        cache->entries.erase(cache->entries.begin());
+    }
+    cache->entries.push_back({key, exec});
+
+    if (hipGraphLaunch(exec, stream) != hipSuccess)
+        return rocblas_status_internal_error;
+    return rocblas_status_success;
+}
+
+#else
+
+bool rocsolver_stream_is_capturing(hipStream_t stream)
+{
+    return false;
+}
+
+struct rocsolver_graph_cache
+{
+};
+
+rocsolver_graph_cache* rocsolver_graph_cache_create()
+{
+    return nullptr;
+}
+
+void rocsolver_graph_cache_release(rocsolver_graph_cache *cache)
+{
+}
+
+bool rocsolver_graph_launch(rocsolver_graph_cache *cache, const rocsolver_graph_key &key, hipStream_t stream)
+{
+    return false;
+}
+
+rocblas_status rocsolver_graph_begin(rocsolver_graph_cache *cache, rocblas_handle handle)
+{
+    return rocblas_status_not_implemented;
+}
+
+rocblas_status rocsolver_graph_end(rocsolver_graph_cache *cache, rocblas_handle handle, hipStream_t stream,
+                                   const rocsolver_graph_key &key, rocblas_status status)
+{
+    return rocblas_status_not_implemented;
+}
+
+#endif /* ROCSOLVER_HIP_GRAPH */
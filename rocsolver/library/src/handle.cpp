@@ -0,0 +1,522 @@
+/* ************************************************************************
+ * Copyright 2019-2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "graph.hpp"
+#include "profiler.hpp"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+/*
+ * ===========================================================================
+ *    Registry of per-handle state
+ * ===========================================================================
+ */
+
+static std::mutex& handle_registry_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+static std::unordered_map<rocblas_handle, rocsolver_handle_data>& handle_registry()
+{
+    static std::unordered_map<rocblas_handle, rocsolver_handle_data> registry;
+    return registry;
+}
+
+rocsolver_handle_data* rocsolver_get_handle_data(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(handle_registry_mutex());
+    // references to elements of an unordered_map remain valid after insertions
+    auto it = handle_registry().find(handle);
+    return it == handle_registry().end() ? nullptr : &it->second;
+}
+
+static void release_handle_data(rocsolver_handle_data *data)
+{
+    rocsolver_logging_write_profile(&data->log);
+    rocsolver_logging_release(&data->log);
+
+    for (auto &p : data->pools) {
+        for (auto &pool : p.second) {
+            if (pool.ptr)
+                hipFree(pool.ptr);
+        }
+    }
+    for (auto &r : data->retired) {
+        hipFree(r.ptr);
+        if (r.done)
+            hipEventDestroy(r.done);
+    }
+    if (data->constants)
+        hipFree(data->constants);
+    if (data->constants_ready)
+        hipEventDestroy(data->constants_ready);
+}
+
+void rocsolver_create_handle_data(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(handle_registry_mutex());
+    // (a state left at the same address belongs to a handle destroyed with rocblas_destroy_handle;
+    // nothing of it, and in particular no user workspace, is passed on to the new handle)
+    auto it = handle_registry().find(handle);
+    if (it != handle_registry().end()) {
+        release_handle_data(&it->second);
+        handle_registry().erase(it);
+    }
+
+    rocsolver_handle_data &data = handle_registry()[handle];
+    rocsolver_tuning_load_environment(&data.tuning);
+    rocsolver_logging_load_environment(&data.log);
+}
+
+void rocsolver_release_handle_data(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(handle_registry_mutex());
+    auto it = handle_registry().find(handle);
+    if (it == handle_registry().end())
+        return;
+
+    release_handle_data(&it->second);
+    handle_registry().erase(it);
+}
+
+
+/*
+ * ===========================================================================
+ *    Device constants
+ * ===========================================================================
+ */
+
+// position of the constants of each precision in the device array
+// (every precision starts at a multiple of WORKSPACE_ALIGNMENT)
+template <typename T> constexpr int constants_offset();
+template <> constexpr int constants_offset<float>() { return 0; }
+template <> constexpr int constants_offset<double>() { return 1; }
+template <> constexpr int constants_offset<rocblas_float_complex>() { return 2; }
+template <> constexpr int constants_offset<rocblas_double_complex>() { return 3; }
+
+template <typename T>
+__host__ __device__ static void set_constants(char *base)
+{
+    T *c = (T*)(base + constants_offset<T>() * WORKSPACE_ALIGNMENT);
+    c[0] = -1;
+    c[1] = 0;
+    c[2] = 1;
+}
+
+__global__ static void init_constants(char *base)
+{
+    set_constants<float>(base);
+    set_constants<double>(base);
+    set_constants<rocblas_float_complex>(base);
+    set_constants<rocblas_double_complex>(base);
+}
+
+// constants of the current device shared by the handles that were not created with
+// rocsolver_create_handle. (They are initialized once per device, by a blocking copy,
+// and live until the end of the process.)
+static void* shared_constants(hipStream_t stream)
+{
+    static std::mutex mtx;
+    static std::unordered_map<int, void*> constants;
+
+    int device;
+    if (hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = constants.find(device);
+    if (it != constants.end())
+        return it->second;
+    if (rocsolver_stream_is_capturing(stream))
+        return nullptr;
+
+    alignas(WORKSPACE_ALIGNMENT) char host[4 * WORKSPACE_ALIGNMENT];
+    set_constants<float>(host);
+    set_constants<double>(host);
+    set_constants<rocblas_float_complex>(host);
+    set_constants<rocblas_double_complex>(host);
+
+    void *ptr = nullptr;
+    if (hipMalloc(&ptr, sizeof(host)) != hipSuccess || !ptr)
+        return nullptr;
+    if (hipMemcpy(ptr, host, sizeof(host), hipMemcpyHostToDevice) != hipSuccess) {
+        hipFree(ptr);
+        return nullptr;
+    }
+    constants[device] = ptr;
+    return ptr;
+}
+
+template <typename T>
+T* rocsolver_get_constants(rocblas_handle handle)
+{
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if (!data) {
+        char *constants = (char*)shared_constants(stream);
+        return constants ? (T*)(constants + constants_offset<T>() * WORKSPACE_ALIGNMENT) : nullptr;
+    }
+
+    if (!data->constants) {
+        // (nothing can be allocated while the stream is captured into a graph)
+        if (rocsolver_stream_is_capturing(stream))
+            return nullptr;
+
+        static_assert(sizeof(rocblas_double_complex)*3 <= WORKSPACE_ALIGNMENT, "constants do not fit");
+        void *constants = nullptr;
+        if (hipMalloc(&constants, 4 * WORKSPACE_ALIGNMENT) != hipSuccess || !constants)
+            return nullptr;
+
+        // (initialized on the device, as a blocking upload would synchronize the stream)
+        hipLaunchKernelGGL(init_constants, dim3(1), dim3(1), 0, stream, (char*)constants);
+        if (hipEventCreateWithFlags(&data->constants_ready, hipEventDisableTiming) != hipSuccess
+            || hipEventRecord(data->constants_ready, stream) != hipSuccess) {
+            // (waiting for the device here is the only way to be sure the constants are ready)
+            if (data->constants_ready)
+                hipEventDestroy(data->constants_ready);
+            data->constants_ready = nullptr;
+            hipStreamSynchronize(stream);
+        }
+        data->constants = constants;
+        data->constants_stream = stream;
+    } else if (data->constants_ready && stream != data->constants_stream
+               && !rocsolver_stream_is_capturing(stream)) {
+        // work on other streams is ordered after the initialization until it is complete
+        if (hipEventQuery(data->constants_ready) == hipSuccess) {
+            hipEventDestroy(data->constants_ready);
+            data->constants_ready = nullptr;
+        } else {
+            hipStreamWaitEvent(stream, data->constants_ready, 0);
+        }
+    }
+
+    return (T*)((char*)data->constants + constants_offset<T>() * WORKSPACE_ALIGNMENT);
+}
+
+template float* rocsolver_get_constants<float>(rocblas_handle);
+template double* rocsolver_get_constants<double>(rocblas_handle);
+template rocblas_float_complex* rocsolver_get_constants<rocblas_float_complex>(rocblas_handle);
+template rocblas_double_complex* rocsolver_get_constants<rocblas_double_complex>(rocblas_handle);
+
+
+/*
+ * ===========================================================================
+ *    Device memory size queries and workspace
+ * ===========================================================================
+ */
+
+bool rocsolver_is_device_memory_size_query(rocblas_handle handle)
+{
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    return data && data->size_query;
+}
+
+rocblas_status rocsolver_set_optimal_device_memory_size(rocblas_handle handle, std::initializer_list<size_t> sizes)
+{
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_success;
+    size_t total = rocsolver_workspace_size(sizes);
+    if (total > data->query_size)
+        data->query_size = total;
+    return rocblas_status_success;
+}
+
+// releases the retired memory that is not used anymore by the work queued before its
+// retirement (hipEventQuery does not wait for the device), or all of it if wait is true.
+static void rocsolver_release_retired(rocsolver_handle_data *data, const bool wait)
+{
+    auto kept = data->retired.begin();
+    for (auto &r : data->retired) {
+        if (wait || (r.done && hipEventQuery(r.done) == hipSuccess)) {
+            hipFree(r.ptr);
+            if (r.done)
+                hipEventDestroy(r.done);
+            data->retired_size -= r.size;
+        } else {
+            *kept++ = r;
+        }
+    }
+    data->retired.erase(kept, data->retired.end());
+}
+
+// makes sure that the pool of stream holds at least size bytes.
+// The pool grows geometrically to keep the number of re-allocations low when
+// the sizes of consecutive calls increase.
+static bool rocsolver_reserve_pool(rocsolver_handle_data *data, rocsolver_memory_pool *pool,
+                                   hipStream_t stream, const size_t size)
+{
+    if (size <= pool->size)
+        return true;
+
+    size_t new_size = rocsolver_workspace_align(std::max(size, pool->size / 100 * WORKSPACE_GROWTH_FACTOR));
+    void *new_ptr = nullptr;
+
+    if (hipMalloc(&new_ptr, new_size) != hipSuccess || !new_ptr) {
+        // try again without the extra room, and then after releasing all the retired memory
+        // (hipFree synchronizes the device, thus that memory is not in use by queued work anymore)
+        new_size = size;
+        if (hipMalloc(&new_ptr, new_size) != hipSuccess || !new_ptr) {
+            if (data->retired.empty())
+                return false;
+            rocsolver_release_retired(data, true);
+            if (hipMalloc(&new_ptr, new_size) != hipSuccess || !new_ptr)
+                return false;
+        }
+    }
+
+    // (the old memory may still be used by the work queued on the stream; without an
+    // event, it is kept until the handle is destroyed or the device runs out of memory)
+    if (pool->ptr) {
+        rocsolver_retired_memory r;
+        r.ptr = pool->ptr;
+        r.size = pool->size;
+        if (hipEventCreateWithFlags(&r.done, hipEventDisableTiming) != hipSuccess)
+            r.done = nullptr;
+        else if (hipEventRecord(r.done, stream) != hipSuccess) {
+            hipEventDestroy(r.done);
+            r.done = nullptr;
+        }
+        data->retired.push_back(r);
+        data->retired_size += r.size;
+        data->pool_stats.current -= r.size;
+    }
+
+    pool->ptr = new_ptr;
+    pool->size = new_size;
+    data->pool_stats.current += new_size;
+    data->pool_stats.peak = std::max(data->pool_stats.peak, data->pool_stats.current + data->retired_size);
+    return true;
+}
+
+void rocsolver_device_malloc::allocate(rocblas_handle handle, const char *routine, std::initializer_list<size_t> sizes)
+{
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    size_t total = rocsolver_workspace_size(sizes);
+    char *base = nullptr;
+
+    if (!data) {
+        // a handle without state (not created with rocsolver_create_handle): the memory
+        // is allocated for the call, and released at its end
+        if (total) {
+            hipStream_t stream;
+            rocblas_get_stream(handle, &stream);
+            if (rocsolver_stream_is_capturing(stream))
+                return;
+            if (hipMalloc(&owned, total) != hipSuccess || !owned) {
+                owned = nullptr;
+                return;
+            }
+            base = (char*)owned;
+        }
+    } else if (data->workspace) {
+        // the user manages the memory; no allocation is done here
+        if (total > data->workspace_size)
+            return;
+        base = (char*)data->workspace;
+    } else if (total) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        auto &stream_pools = data->pools[stream];
+
+        // the first pool that is not taken by another call in progress on the same stream
+        rocsolver_memory_pool *p = nullptr;
+        for (auto &q : stream_pools) {
+            if (!q.in_use) {
+                p = &q;
+                break;
+            }
+        }
+
+        // (no memory can be allocated while the stream is captured into a graph; the
+        // pool must have been grown by a previous call)
+        if ((!p || total > p->size) && rocsolver_stream_is_capturing(stream))
+            return;
+        if (!data->retired.empty() && !rocsolver_stream_is_capturing(stream))
+            rocsolver_release_retired(data, false);
+        if (!p) {
+            stream_pools.emplace_back();
+            p = &stream_pools.back();
+        }
+        if (!rocsolver_reserve_pool(data, p, stream, total))
+            return;
+
+        pool = p;
+        pool->in_use = true;
+        base = (char*)pool->ptr;
+    }
+
+    int i = 0;
+    for (size_t s : sizes) {
+        ptr[i++] = s ? base : nullptr;
+        base += rocsolver_workspace_align(s);
+    }
+    success = true;
+
+    // (there are no statistics without state)
+    if (!data)
+        return;
+    auto it = data->routine_stats.find(routine);
+    if (it == data->routine_stats.end())
+        it = data->routine_stats.emplace(routine, rocsolver_memory_stats()).first;
+    stats = &it->second;
+    used = total;
+    stats->current += used;
+    stats->peak = std::max(stats->peak, stats->current);
+}
+
+rocsolver_device_malloc::~rocsolver_device_malloc()
+{
+    // (hipFree waits for the work queued on the device, that may still use the memory)
+    if (owned)
+        hipFree(owned);
+    if (pool)
+        pool->in_use = false;
+    if (stats)
+        stats->current -= used;
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_create_handle(rocblas_handle *handle)
+{
+    const rocblas_status stat = rocblas_create_handle(handle);
+    if (stat != rocblas_status_success)
+        return stat;
+
+    const rocblas_status mode = rocblas_set_pointer_mode(*handle, rocblas_pointer_mode_device);
+    if (mode != rocblas_status_success)
+        return mode;
+
+    // (this is the only place where the state of a handle is created)
+    rocsolver_create_handle_data(*handle);
+
+    // (the constants are allocated here rather than by the first call on the handle)
+    rocsolver_get_constants<float>(*handle);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_destroy_handle(rocblas_handle handle)
+{
+    // (the phases of the trace requested from the environment are written while HIP is
+    // still available, rather than at exit)
+    rocsolver_phase_flush();
+    rocsolver_release_handle_data(handle);
+    return rocblas_destroy_handle(handle);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_device_memory_size_query(rocblas_handle handle)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    if (data->size_query)
+        return rocblas_status_internal_error;
+
+    data->size_query = true;
+    data->query_size = 0;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_device_memory_size_query(rocblas_handle handle, size_t *size)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    if (!data->size_query)
+        return rocblas_status_internal_error;
+
+    *size = data->query_size;
+    data->size_query = false;
+    data->query_size = 0;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_workspace(rocblas_handle handle, void *workspace, size_t size)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!workspace && size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    data->workspace = size ? workspace : nullptr;
+    data->workspace_size = size;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_workspace_size(rocblas_handle handle, size_t *size)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    *size = data ? data->workspace_size : 0;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_device_memory_stats(rocblas_handle handle, const char *routine,
+                                                                   size_t *current, size_t *peak)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!current || !peak)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    // (nothing is kept for a handle without state)
+    rocsolver_memory_stats stats;
+    if (!data) {
+        stats = rocsolver_memory_stats();
+    } else if (!routine) {
+        stats = data->pool_stats;
+    } else {
+        auto it = data->routine_stats.find(routine);
+        if (it != data->routine_stats.end())
+            stats = it->second;
+    }
+
+    *current = stats.current;
+    *peak = stats.peak;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_retired_device_memory(rocblas_handle handle, size_t *size)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    *size = data ? data->retired_size : 0;
+    return rocblas_status_success;
+}
+
+} //extern C
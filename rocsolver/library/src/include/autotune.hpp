@@ -0,0 +1,156 @@
+/* ************************************************************************
+ * Copyright 2019-2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_AUTOTUNE_HPP
+#define ROCSOLVER_AUTOTUNE_HPP
+
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <initializer_list>
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "handle.hpp"
+#include "tuning.hpp"
+
+// maximum size (in bytes) of the scratch matrices used to time the candidates
+#define AUTOTUNE_MAX_SCRATCH (256 << 20)
+
+
+/*
+ * ===========================================================================
+ *    Autotuning: when it is enabled, the first call for a problem that has
+ *    no value in the tuning table times a set of candidate values on scratch
+ *    data. The fastest one is added to the table (for the sizes and batch
+ *    counts in the same power-of-two bands) and to the tuning cache file.
+ * ===========================================================================
+ */
+
+// returns true if param must be tuned for a call with the given precision, size and batch count
+bool rocsolver_autotune_wanted(rocblas_handle handle, const rocsolver_tuning_param param, const char precision,
+                               const rocblas_int size, const rocblas_int batch_count);
+
+// records the value chosen for param in the tuning table and in the cache file
+void rocsolver_autotune_record(rocblas_handle handle, const rocsolver_tuning_param param, const char precision,
+                               const rocblas_int size, const rocblas_int batch_count, const rocblas_int value);
+
+// sets (value > 0) or removes (value = 0) the candidate being timed
+void rocsolver_autotune_try(rocblas_handle handle, const rocsolver_tuning_param param, const rocblas_int value);
+
+// times run() with every candidate value of param and records the fastest one
+template <typename T, typename F>
+void rocsolver_autotune(rocblas_handle handle, const rocsolver_tuning_param param, const rocblas_int size,
+                        const rocblas_int batch_count, std::initializer_list<rocblas_int> candidates, F run)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    hipEvent_t start, stop;
+    if (hipEventCreate(&start) != hipSuccess)
+        return;
+    if (hipEventCreate(&stop) != hipSuccess) {
+        hipEventDestroy(start);
+        return;
+    }
+
+    rocblas_int best = 0;
+    float best_time = 0;
+    for (rocblas_int value : candidates) {
+        rocsolver_autotune_try(handle, param, value);
+
+        // the first run also sets up the memory pools
+        if (run() != rocblas_status_success)
+            continue;
+
+        float time;
+        hipEventRecord(start, stream);
+        rocblas_status status = run();
+        hipEventRecord(stop, stream);
+        if (status != rocblas_status_success || hipEventSynchronize(stop) != hipSuccess
+            || hipEventElapsedTime(&time, start, stop) != hipSuccess)
+            continue;
+
+        if (!best || time < best_time) {
+            best = value;
+            best_time = time;
+        }
+    }
+    rocsolver_autotune_try(handle, param, 0);
+
+    hipEventDestroy(start);
+    hipEventDestroy(stop);
+
+    if (best)
+        rocsolver_autotune_record(handle, param, rocsolver_precision<T>(), size, batch_count, best);
+}
+
+
+// fills a strided batch of matrices with Hermitian, diagonally dominant data
+// (so that the timed factorizations succeed and do not depend on the data of the call)
+template <typename T>
+__global__ void autotune_init(const rocblas_int m, const rocblas_int n, T *A, const rocblas_int lda,
+                              const rocblas_stride strideA, const rocblas_int batch_count)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < m) {
+        int lo = min(i, j), hi = max(i, j);
+        real_t<T> v = real_t<T>((lo * 7 + hi * 13) % 17) / 17 - real_t<T>(0.5);
+        if (i == j)
+            v += max(m, n);
+        for (rocblas_int b = 0; b < batch_count; ++b)
+            A[b * strideA + i + j * lda] = v;
+    }
+}
+
+// scratch matrices (and pivots and info) for the timing runs. The batch count is
+// reduced if the matrices would take more than AUTOTUNE_MAX_SCRATCH bytes.
+template <typename T>
+class rocsolver_autotune_scratch
+{
+    bool success = false;
+
+public:
+    rocblas_int m, n, lda, batch_count;
+    rocblas_stride strideA, strideP;
+    T *A = nullptr;
+    rocblas_int *ipiv = nullptr;
+    rocblas_int *info = nullptr;
+
+    rocsolver_autotune_scratch(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count)
+        : m(m), n(n), lda(m), strideA(rocblas_stride(m) * n), strideP(min(m, n))
+    {
+        size_t bytes = sizeof(T) * m * n;
+        this->batch_count = rocblas_int(std::max<size_t>(1, std::min<size_t>(batch_count, AUTOTUNE_MAX_SCRATCH / bytes)));
+
+        success = hipMalloc(&A, bytes * this->batch_count) == hipSuccess
+                  && hipMalloc(&ipiv, sizeof(rocblas_int) * strideP * this->batch_count) == hipSuccess
+                  && hipMalloc(&info, sizeof(rocblas_int) * this->batch_count) == hipSuccess;
+    }
+
+    ~rocsolver_autotune_scratch()
+    {
+        hipFree(A);
+        hipFree(ipiv);
+        hipFree(info);
+    }
+
+    rocsolver_autotune_scratch(const rocsolver_autotune_scratch&) = delete;
+    rocsolver_autotune_scratch& operator=(const rocsolver_autotune_scratch&) = delete;
+
+    explicit operator bool() const
+    {
+        return success;
+    }
+
+    // (re)initializes the matrices
+    void init(hipStream_t stream)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(autotune_init<T>, dim3((m - 1) / BLOCKSIZE + 1, n), dim3(BLOCKSIZE), 0, stream,
+                                m, n, A, lda, strideA, batch_count);
+    }
+};
+
+#endif /* ROCSOLVER_AUTOTUNE_HPP */
@@ -7,6 +7,7 @@
 
 #include <hip/hip_runtime.h>
 #include "utility.hpp"
+#include "profiler.hpp"
 
 // **********************************************************
 // GPU kernels that are used by many rocsolver functions
@@ -40,6 +41,70 @@ __global__ void get_array(T** out, T* in, rocblas_stride stride, rocblas_int bat
         out[b] = in + b*stride;
 }
 
+template<typename T>
+__global__ void shift_array(T** out, T *const in[], const rocblas_int shift, const rocblas_int batch) 
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    
+    if (b < batch)
+        out[b] = in[b] + shift;
+}
+
+// In-place triangular matrix multiplication B = op(A)*B (left side) or B = B*op(A) (right side).
+// Every work-group updates one column (left side) or row (right side) of B in chunks of 
+// hipBlockDim_x entries. The chunks are visited in the order that leaves unmodified the entries 
+// still needed by the following chunks, so no extra memory is required.
+template <typename T, typename U, typename V>
+__global__ void trmm_kernel(const rocblas_side side, const rocblas_fill uplo, const rocblas_operation trans,
+                            const rocblas_diagonal diag, const rocblas_int m, const rocblas_int n,
+                            U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                            V B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_y;
+    const auto v = hipBlockIdx_x;
+    const auto tid = hipThreadIdx_x;
+    const auto nb = hipBlockDim_x;
+
+    T *Ap = load_ptr_batch<T>(A,b,shiftA,strideA);
+    T *Bp = load_ptr_batch<T>(B,b,shiftB,strideB);
+
+    // the column (or row) x of B is multiplied by M = op(A) (left side) or M = op(A)' (right side)
+    bool left = (side == rocblas_side_left);
+    bool transposed = (left == (trans != rocblas_operation_none));
+    bool conjugate = (trans == rocblas_operation_conjugate_transpose);
+    bool upper = (transposed != (uplo == rocblas_fill_upper));
+    rocblas_int k = left ? m : n;
+    rocblas_int incx = left ? 1 : ldb;
+    T *x = left ? Bp + v*ldb : Bp + v;
+
+    rocblas_int chunks = (k - 1)/nb + 1;
+    for (rocblas_int c = 0; c < chunks; ++c) {
+        rocblas_int i = (upper ? c : chunks - 1 - c) * nb + tid;
+        T res = 0;
+        
+        if (i < k) {
+            rocblas_int jmin = upper ? i : 0;
+            rocblas_int jmax = upper ? k : i + 1;
+            for (rocblas_int j = jmin; j < jmax; ++j) {
+                T a;
+                if (i == j && diag == rocblas_diagonal_unit) {
+                    a = 1;
+                } else {
+                    a = transposed ? Ap[j + i*lda] : Ap[i + j*lda];
+                    if (conjugate)
+                        a = conj(a);
+                }
+                res += a * x[j*incx];
+            }
+        }
+        __syncthreads();
+
+        if (i < k)
+            x[i*incx] = res;
+        __syncthreads();
+    }
+}
+
 template <typename T, typename U>
 __global__ void setdiag(const rocblas_int j, U A, 
                         const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_GRAPH_HPP
+#define ROCSOLVER_GRAPH_HPP
+
+#include <hip/hip_runtime.h>
+#include <initializer_list>
+#include "rocsolver.h"
+
+// maximum number of graphs kept by a plan (the least recently used one is released first)
+#define PLAN_MAX_GRAPHS 16
+
+/*
+ * ===========================================================================
+ *    hipGraph support. A call made while its stream is being captured into a
+ *    graph must not allocate memory, synchronize, or read device data: the
+ *    memory pools are not grown, autotuning is skipped and the profile layer
+ *    and phase profiler do not record events during a capture.
+ *
+ *    With graphs enabled, a plan captures its execution once for every set of
+ *    matrix pointers (on a stream of its own) and replays the graph afterwards.
+ *    (When rocSOLVER is built with a HIP that does not support stream capture,
+ *    no stream is ever capturing and graphs cannot be enabled.)
+ * ===========================================================================
+ */
+
+// returns true if the work queued on stream is being captured into a graph
+bool rocsolver_stream_is_capturing(hipStream_t stream);
+
+inline bool rocsolver_is_capturing(rocblas_handle handle)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    return rocsolver_stream_is_capturing(stream);
+}
+
+// the graphs of a plan, indexed by the pointers to the matrices and vectors of the calls
+struct rocsolver_graph_cache;
+
+struct rocsolver_graph_key
+{
+    const void *args[4] = {};
+
+    rocsolver_graph_key(std::initializer_list<const void*> ptrs)
+    {
+        int i = 0;
+        for (const void *p : ptrs)
+            args[i++] = p;
+    }
+};
+
+// returns a new (empty) cache, or nullptr if graphs are not supported
+rocsolver_graph_cache* rocsolver_graph_cache_create();
+
+void rocsolver_graph_cache_release(rocsolver_graph_cache *cache);
+
+// launches the graph cached for key on stream, if there is one. It returns false if there is
+// none, or if the launch failed (the graph is then removed from the cache)
+bool rocsolver_graph_launch(rocsolver_graph_cache *cache, const rocsolver_graph_key &key, hipStream_t stream);
+
+// sets the capture stream of the cache on the handle and starts capturing it
+rocblas_status rocsolver_graph_begin(rocsolver_graph_cache *cache, rocblas_handle handle);
+
+// ends the capture started by rocsolver_graph_begin and restores stream on the handle. If the
+// captured call succeeded (status), the graph is instantiated, cached for key and launched on stream.
+rocblas_status rocsolver_graph_end(rocsolver_graph_cache *cache, rocblas_handle handle, hipStream_t stream,
+                                   const rocsolver_graph_key &key, rocblas_status status);
+
+#endif /* ROCSOLVER_GRAPH_HPP */
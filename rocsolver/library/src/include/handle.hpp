@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright 2019-2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_HANDLE_HPP
+#define ROCSOLVER_HANDLE_HPP
+
+#include <hip/hip_runtime.h>
+#include <deque>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "logging.hpp"
+#include "rocsolver.h"
+#include "tuning.hpp"
+
+// every buffer carved from the device workspace starts at a multiple of this size (in bytes)
+#define WORKSPACE_ALIGNMENT 256
+// maximum number of buffers that can be requested by a single call
+#define WORKSPACE_MAX_BUFFERS 12
+// when a memory pool is too small, it grows to at least this factor (in percentage) of its current size
+#define WORKSPACE_GROWTH_FACTOR 150
+
+
+/*
+ * ===========================================================================
+ *    rocSOLVER state associated with a rocblas_handle.
+ *    (rocblas_handle is opaque, thus this state lives in a registry owned by
+ *    rocsolver; it is created by rocsolver_create_handle and released by
+ *    rocsolver_destroy_handle)
+ *
+ *    A handle created with rocblas_create_handle has no state, as nothing
+ *    would release it: its calls allocate their device memory themselves
+ *    (and release it at their end, which synchronizes the device), use the
+ *    constants shared by all such handles, the tuning table and the trace and
+ *    bench layers given by the environment.
+ *
+ *    Every call is stream-ordered: once the memory pools of the handle have
+ *    grown to the size of the calls (and the memory they replaced has been
+ *    released by a call, after the work that used it completed), nothing in a
+ *    call synchronizes the host with the device (no hipMalloc, hipFree or
+ *    blocking copies). Only the
+ *    autotuning of a call (when enabled) and the convergence checks of the
+ *    mixed-precision solvers wait for the device.
+ * ===========================================================================
+ */
+
+// device memory cached for the calls executed on a given stream.
+// (a pool is never shared between streams, so that a call cannot reuse memory
+// still in use by work queued on another stream)
+struct rocsolver_memory_pool
+{
+    void *ptr = nullptr;
+    size_t size = 0;
+    bool in_use = false;
+};
+
+// memory replaced by the growth of a pool. The work queued on the stream of the pool before
+// the growth may still use it; done is recorded on that stream when the memory is retired.
+struct rocsolver_retired_memory
+{
+    void *ptr = nullptr;
+    size_t size = 0;
+    hipEvent_t done = nullptr;
+};
+
+// device memory used by a routine (or by the whole handle)
+struct rocsolver_memory_stats
+{
+    size_t current = 0;
+    size_t peak = 0;
+};
+
+struct rocsolver_handle_data
+{
+    // device workspace provided by the user (nullptr if the library manages the memory)
+    void *workspace = nullptr;
+    size_t workspace_size = 0;
+
+    // device memory managed by the library. A stream has more than one pool when
+    // calls in progress on it are nested (a deque keeps the pools in place as it grows).
+    std::unordered_map<hipStream_t, std::deque<rocsolver_memory_pool>> pools;
+    // memory replaced by the growth of a pool. It is released by a later call once its
+    // event has completed (or with the handle), and it is counted apart from the memory of
+    // the pools: pool_stats.current is the memory of the pools, and pool_stats.peak the
+    // maximum of the memory of the pools and the retired memory held at the same time.
+    std::vector<rocsolver_retired_memory> retired;
+    size_t retired_size = 0;
+    rocsolver_memory_stats pool_stats;
+    std::map<std::string, rocsolver_memory_stats, std::less<>> routine_stats;
+
+    // device memory size query
+    bool size_query = false;
+    size_t query_size = 0;
+
+    // constants {-1, 0, 1} for all the precisions, stored on the device. They are
+    // initialized on constants_stream; ready is recorded after the initialization and
+    // is waited for by the other streams until it completes.
+    void *constants = nullptr;
+    hipStream_t constants_stream = nullptr;
+    hipEvent_t constants_ready = nullptr;
+
+    // tuned algorithm parameters
+    rocsolver_tuning_table tuning;
+
+    // logging layers and profile
+    rocsolver_logging log;
+};
+
+// returns the state associated with handle, or nullptr if the handle has no state
+rocsolver_handle_data* rocsolver_get_handle_data(rocblas_handle handle);
+
+// creates the state of a new handle, with the tuning table and the logging layers given by
+// the environment. (A state left at the same address by a handle destroyed without
+// rocsolver_destroy_handle is released first.)
+void rocsolver_create_handle_data(rocblas_handle handle);
+
+// releases the state associated with handle (if any), including its memory pools.
+// The profile of the handle is written first.
+void rocsolver_release_handle_data(rocblas_handle handle);
+
+
+// returns a device array with the constants {-1, 0, 1} of type T.
+// (the constants are initialized by a kernel the first time they are requested for the
+// handle, thus no call on the handle needs any host-device transfer)
+template <typename T>
+T* rocsolver_get_constants(rocblas_handle handle);
+
+
+/*
+ * ===========================================================================
+ *    Device memory size queries
+ * ===========================================================================
+ */
+
+inline size_t rocsolver_workspace_align(const size_t size)
+{
+    return ((size - 1) / WORKSPACE_ALIGNMENT + 1) * WORKSPACE_ALIGNMENT * (size > 0);
+}
+
+inline size_t rocsolver_workspace_size(std::initializer_list<size_t> sizes)
+{
+    size_t total = 0;
+    for (size_t s : sizes)
+        total += rocsolver_workspace_align(s);
+    return total;
+}
+
+bool rocsolver_is_device_memory_size_query(rocblas_handle handle);
+
+rocblas_status rocsolver_set_optimal_device_memory_size(rocblas_handle handle, std::initializer_list<size_t> sizes);
+
+template <typename... Ss>
+rocblas_status rocsolver_set_optimal_device_memory_size(rocblas_handle handle, Ss... sizes)
+{
+    return rocsolver_set_optimal_device_memory_size(handle, {size_t(sizes)...});
+}
+
+
+/*
+ * ===========================================================================
+ *    rocsolver_device_malloc reserves all the device workspace required by a
+ *    call at once. The buffers are carved from the workspace attached to the
+ *    handle by the user, or from a free memory pool of the handle stream otherwise
+ *    (or from memory allocated for the call if the handle has no state).
+ *    The memory is given back when the object goes out of scope.
+ * ===========================================================================
+ */
+
+class rocsolver_device_malloc
+{
+    rocsolver_memory_pool *pool = nullptr;
+    void *owned = nullptr;  // memory allocated for the call (handles without state)
+    rocsolver_memory_stats *stats = nullptr;
+    size_t used = 0;
+    void *ptr[WORKSPACE_MAX_BUFFERS] = {};
+    bool success = false;
+
+    void allocate(rocblas_handle handle, const char *routine, std::initializer_list<size_t> sizes);
+
+public:
+    template <typename... Ss>
+    rocsolver_device_malloc(rocblas_handle handle, const char *routine, Ss... sizes)
+    {
+        static_assert(sizeof...(Ss) <= WORKSPACE_MAX_BUFFERS, "too many workspace buffers");
+        allocate(handle, routine, {size_t(sizes)...});
+    }
+
+    ~rocsolver_device_malloc();
+
+    rocsolver_device_malloc(const rocsolver_device_malloc&) = delete;
+    rocsolver_device_malloc& operator=(const rocsolver_device_malloc&) = delete;
+
+    explicit operator bool() const
+    {
+        return success;
+    }
+
+    void* operator[](const int i) const
+    {
+        return ptr[i];
+    }
+};
+
+#endif /* ROCSOLVER_HANDLE_HPP */
@@ -9,15 +9,27 @@
 // IDEAL SIZES ARE DEFINED FOR NOW AS IN CPU-LAPACK
 // BENCHMARKING OF ROCSOLVER WILL BE NEEDED TO DETERMINE
 // MORE SUITABLE VALUES  
+// (THE SWITCH SIZES, BLOCK SIZES AND CUTOFFS OF THE BLOCKED ALGORITHMS
+// ARE ONLY DEFAULTS; THEY CAN BE TUNED AT RUN TIME, SEE tuning.hpp)
 #define BLOCKSIZE 256
 #define LASWP_BLOCKSIZE 256
 #define GETF2_BLOCKSIZE 256
+#define GETF2_MIN_WAVESIZE 32
+#define GETF2_IAMAX_CHUNKSIZE 4096
+#define GETF2_IAMAX_MAXBLOCKS 64
+#define GETF2_PANEL_LDSSIZE 49152
 #define ORMQR_ORM2R_BLOCKSIZE 32
 #define ORMLQ_ORML2_BLOCKSIZE 32
 #define GETRF_GETF2_SWITCHSIZE 64
+#define GETRF_SMALL_MAXSIZE 64
+#define GETRF_RGETF2_CUTOFF 16
 #define POTRF_POTF2_SWITCHSIZE 64
 #define GEQRF_GEQR2_SWITCHSIZE 128
 #define GEQRF_GEQR2_BLOCKSIZE 64
+#define TRMM_BLOCKSIZE 64
+#define GESV_MIXED_BLOCKSIZE 256
+#define GESV_SMALL_MAXSIZE 32
+#define GESV_SMALL_RHS_BLOCK 8
 
 // THESE VALUES ARE TO MATCH ROCBLAS C++ INTERFACE
 // THEY ARE DEFINED/TUNNED IN ROCBLAS
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_LOGGING_HPP
+#define ROCSOLVER_LOGGING_HPP
+
+#include <hip/hip_runtime.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    Logging of the API calls. As in rocBLAS, there are three layers that can
+ *    be enabled independently (see rocblas_layer_mode):
+ *    - trace: every call is printed with all its arguments,
+ *    - bench: every call is printed as the rocsolver-bench command line that
+ *      reproduces it,
+ *    - profile: the calls are aggregated by routine and arguments, with their
+ *      number and total device time. The summary is written when the handle is
+ *      destroyed, as a rocsolver-bench suite that replays the same calls.
+ * ===========================================================================
+ */
+
+struct rocsolver_profile_entry
+{
+    rocblas_int calls = 0;
+    double time = 0;    // in microseconds
+};
+
+// a call timed by the profile layer. (The events are only read once they have
+// completed, so that the profile layer does not synchronize the device.)
+struct rocsolver_profile_call
+{
+    std::string key;
+    hipEvent_t start, stop;
+};
+
+struct rocsolver_logging
+{
+    rocblas_int layers = rocblas_layer_mode_none;
+
+    // profile, indexed by the rocsolver-bench suite entry of the calls
+    std::map<std::string, rocsolver_profile_entry> profile;
+    std::vector<rocsolver_profile_call> pending;
+    std::vector<hipEvent_t> free_events;
+};
+
+// enables the layers given by the environment variable ROCSOLVER_LAYER
+void rocsolver_logging_load_environment(rocsolver_logging *log);
+
+// logging of the handle (for a handle without state, the trace and bench layers given by
+// the environment, shared by all such handles)
+rocsolver_logging* rocsolver_get_logging(rocblas_handle handle);
+
+// waits for the calls still in progress, and writes the profile (if it is not empty) and clears it
+void rocsolver_logging_write_profile(rocsolver_logging *log);
+
+// releases the events of the profile layer
+void rocsolver_logging_release(rocsolver_logging *log);
+
+// values of the arguments, as they are printed
+std::string rocsolver_log_value(const rocblas_int value);
+std::string rocsolver_log_value(const rocblas_stride value);
+std::string rocsolver_log_value(const rocblas_operation value);
+std::string rocsolver_log_value(const rocblas_fill value);
+std::string rocsolver_log_value(const rocblas_side value);
+std::string rocsolver_log_value(const rocblas_direct value);
+std::string rocsolver_log_value(const rocblas_storev value);
+std::string rocsolver_log_value(const void *value);
+
+
+/*
+ * ===========================================================================
+ *    rocsolver_logger logs a call. It is created at the beginning of the call;
+ *    the arguments are added with arg() and start() writes the trace and bench
+ *    logs. With the profile layer, the call is timed from start() until the
+ *    object goes out of scope. When logging is disabled, nothing is formatted.
+ *
+ *    rocsolver_logger log(handle, "getrf", rocsolver_precision<T>());
+ *    log.arg("m", m, "sizem").arg("n", n, "sizen").arg("A", A).start();
+ * ===========================================================================
+ */
+
+class rocsolver_logger
+{
+    rocblas_handle handle;
+    rocsolver_logging *log = nullptr;   // nullptr when logging is disabled
+    const char *routine;
+    char precision;
+    std::string trace_args, bench_args, profile_args;
+    hipEvent_t start_event = nullptr;
+
+    void add(const char *name, const std::string &value, const char *bench_option);
+
+public:
+    rocsolver_logger(rocblas_handle handle, const char *routine, const char precision);
+    // (for the callers that already hold the logging state of the handle, such as the plans)
+    rocsolver_logger(rocblas_handle handle, rocsolver_logging *handle_log, const char *routine, const char precision);
+    ~rocsolver_logger();
+
+    rocsolver_logger(const rocsolver_logger&) = delete;
+    rocsolver_logger& operator=(const rocsolver_logger&) = delete;
+
+    // adds an argument. bench_option is the option of rocsolver-bench that takes its value
+    // (nullptr if there is none, as for the pointers)
+    template <typename V>
+    rocsolver_logger& arg(const char *name, const V value, const char *bench_option = nullptr)
+    {
+        if (log)
+            add(name, rocsolver_log_value(value), bench_option);
+        return *this;
+    }
+
+    void start();
+};
+
+#endif /* ROCSOLVER_LOGGING_HPP */
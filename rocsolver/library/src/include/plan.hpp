@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_PLAN_HPP
+#define ROCSOLVER_PLAN_HPP
+
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include "graph.hpp"
+#include "handle.hpp"
+#include "rocsolver.h"
+#include "tuning.hpp"
+
+/*
+ * ===========================================================================
+ *    Plans for repeated calls with the same arguments. Everything that does
+ *    not depend on the matrices is done once, when the plan is created:
+ *    autotuning, resolution of the tuning parameters, device workspace (the
+ *    plan owns its memory, so that it is not taken from the handle at every
+ *    call) and constants. The execution of a plan only checks the pointers
+ *    and calls the template of the routine.
+ *
+ *    A plan is bound to its handle and must be destroyed before it. It can be
+ *    executed on any stream set on the handle, but not by several threads at
+ *    the same time, as its workspace is not shared. An event is recorded at the
+ *    end of every execution, and an execution on another stream waits for it,
+ *    so that the executions use the workspace one after the other. (While the
+ *    stream is captured by the user, the order is left to the captured graph.)
+ *
+ *    As it does not allocate memory nor synchronize, the execution of a plan
+ *    can be captured into a hipGraph. With graphs enabled on the plan, it is
+ *    captured once for every set of matrix pointers and replayed afterwards
+ *    (see graph.hpp).
+ * ===========================================================================
+ */
+
+struct _rocsolver_plan
+{
+    rocblas_handle handle;
+    rocsolver_logging *log;
+    const char *routine;    // name of the routine (e.g. "getrf_batched")
+    char precision;
+
+    // arguments fixed by the plan
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int m = 0, n = 0, nrhs = 0, lda = 0, ldb = 0, batch_count = 1;
+    rocblas_stride strideA = 0, strideP = 0, strideB = 0;
+
+    // values of the tuning parameters for the problem size
+    rocblas_int tuning[tuning_num_params] = {};
+
+    // device memory owned by the plan, and the buffers carved from it
+    void *memory = nullptr;
+    void *buffers[WORKSPACE_MAX_BUFFERS] = {};
+    void *scalars = nullptr;
+
+    // end of the last execution, and the stream it was queued on
+    hipEvent_t done = nullptr;
+    hipStream_t last_stream = nullptr;
+
+    // executable graphs (nullptr if graphs are not enabled)
+    rocsolver_graph_cache *graphs = nullptr;
+
+    _rocsolver_plan(rocblas_handle handle, const char *routine, const char precision)
+        : handle(handle), log(rocsolver_get_logging(handle)), routine(routine), precision(precision)
+    {}
+
+    ~_rocsolver_plan()
+    {
+        rocsolver_graph_cache_release(graphs);
+        if (done)
+            hipEventDestroy(done);
+        if (memory)
+            hipFree(memory);
+    }
+
+    _rocsolver_plan(const _rocsolver_plan&) = delete;
+    _rocsolver_plan& operator=(const _rocsolver_plan&) = delete;
+
+    // returns true if the plan was created for the given routine and precision
+    bool is(const char *name, const char prec) const
+    {
+        return precision == prec && !strcmp(routine, name);
+    }
+};
+
+// resolves all the tuning parameters of the plan for the given size (as the templates
+// query them), and allocates its workspace and event. It returns false if there is not
+// enough memory.
+bool rocsolver_plan_prepare(rocsolver_plan plan, const rocblas_int size, std::initializer_list<size_t> sizes);
+
+template <typename... Ss>
+bool rocsolver_plan_prepare(rocsolver_plan plan, const rocblas_int size, Ss... sizes)
+{
+    static_assert(sizeof...(Ss) <= WORKSPACE_MAX_BUFFERS, "too many workspace buffers");
+    return rocsolver_plan_prepare(plan, size, {size_t(sizes)...});
+}
+
+// makes the tuning values of a plan visible to the templates executed by the current
+// thread, until the object goes out of scope
+class rocsolver_plan_scope
+{
+    const rocblas_int *previous;
+
+public:
+    explicit rocsolver_plan_scope(rocsolver_plan plan) : previous(rocsolver_pinned_tuning)
+    {
+        rocsolver_pinned_tuning = plan->tuning;
+    }
+
+    ~rocsolver_plan_scope()
+    {
+        rocsolver_pinned_tuning = previous;
+    }
+
+    rocsolver_plan_scope(const rocsolver_plan_scope&) = delete;
+    rocsolver_plan_scope& operator=(const rocsolver_plan_scope&) = delete;
+};
+
+// executes a plan with run(), or replays the graph captured from run() for the given matrix
+// pointers if graphs are enabled
+template <typename F>
+rocblas_status rocsolver_plan_run(rocsolver_plan plan, const rocsolver_graph_key &key, F run)
+{
+    hipStream_t stream;
+    rocblas_get_stream(plan->handle, &stream);
+
+    // (the previous execution may still be using the workspace on another stream)
+    const bool ordered = !rocsolver_stream_is_capturing(stream);
+    if (ordered && stream != plan->last_stream)
+        hipStreamWaitEvent(stream, plan->done, 0);
+
+    rocblas_status status;
+    if (!plan->graphs) {
+        status = run();
+    } else if (rocsolver_graph_launch(plan->graphs, key, stream)) {
+        status = rocblas_status_success;
+    } else {
+        status = rocsolver_graph_begin(plan->graphs, plan->handle);
+        if (status == rocblas_status_success)
+            status = rocsolver_graph_end(plan->graphs, plan->handle, stream, key, run());
+    }
+
+    if (ordered) {
+        hipEventRecord(plan->done, stream);
+        plan->last_stream = stream;
+    }
+    return status;
+}
+
+#endif /* ROCSOLVER_PLAN_HPP */
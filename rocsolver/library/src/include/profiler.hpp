@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_PROFILER_HPP
+#define ROCSOLVER_PROFILER_HPP
+
+#include <atomic>
+#include <hip/hip_runtime.h>
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    Per-phase profiler. The internal phases of the algorithms (panel
+ *    factorizations, trailing matrix updates, row interchanges, block
+ *    reflectors, ...) are timed with device events and annotated with the
+ *    number of kernels launched and rocBLAS functions called within them.
+ *    The result is written as a Chrome trace (chrome://tracing or Perfetto).
+ *    When rocSOLVER is built with roctx, the phases are also pushed as roctx
+ *    ranges, so that they appear in the traces of rocprof.
+ *
+ *    The profiler is enabled with rocsolver_start_phase_trace, or with the
+ *    environment variables ROCSOLVER_PHASE_TRACE=<file> (the phases are
+ *    appended to the file when a handle is destroyed, and when the trace is
+ *    full) and ROCSOLVER_PHASE_ROCTX=1 (roctx ranges only). The counts of
+ *    the outermost phases alone are added up between
+ *    rocsolver_start_phase_counters and rocsolver_stop_phase_counters. When it is
+ *    disabled, a phase costs a single branch; when rocSOLVER is built without
+ *    ROCSOLVER_PHASE_PROFILER, it costs nothing.
+ *
+ *    {
+ *        ROCSOLVER_PHASE(handle, "panel");
+ *        ...
+ *        ROCSOLVER_LAUNCH_KERNEL(kernel<T>, grid, threads, 0, stream, ...);
+ *    }
+ * ===========================================================================
+ */
+
+#ifdef ROCSOLVER_PHASE_PROFILER
+
+#define ROCSOLVER_PHASE_TRACE 1   // the phases are recorded for the trace
+#define ROCSOLVER_PHASE_ROCTX 2   // the phases are pushed as roctx ranges
+#define ROCSOLVER_PHASE_COUNT 4   // the launches of the outermost phases are added up
+
+// enabled modes (0 when the profiler is disabled). It is changed by any thread and
+// read with relaxed loads, as a phase only needs to see the mode eventually.
+extern std::atomic<int> rocsolver_phase_mode;
+
+inline int rocsolver_get_phase_mode()
+{
+    return rocsolver_phase_mode.load(std::memory_order_relaxed);
+}
+
+// appends the recorded phases to the trace requested from the environment (if any),
+// waiting for them to complete. (Called when a handle is destroyed)
+void rocsolver_phase_flush();
+
+class rocsolver_phase
+{
+    rocsolver_phase *parent = nullptr;
+    const char *name = nullptr;   // nullptr when the profiler is disabled
+    hipStream_t stream;
+    hipEvent_t start_event = nullptr;
+    rocblas_int launches = 0;
+    rocblas_int blas_calls = 0;
+    rocblas_int depth = 0;
+
+    void begin(rocblas_handle handle, const char *phase_name);
+    void end();
+    static void count(const bool blas);
+
+public:
+    rocsolver_phase(rocblas_handle handle, const char *phase_name)
+    {
+        if (rocsolver_get_phase_mode())
+            begin(handle, phase_name);
+    }
+
+    ~rocsolver_phase()
+    {
+        if (name)
+            end();
+    }
+
+    rocsolver_phase(const rocsolver_phase&) = delete;
+    rocsolver_phase& operator=(const rocsolver_phase&) = delete;
+
+    // counts a kernel launch (or a rocBLAS call) in the innermost phase of the calling thread
+    static void count_launch()
+    {
+        if (rocsolver_get_phase_mode())
+            count(false);
+    }
+
+    static void count_blas_call()
+    {
+        if (rocsolver_get_phase_mode())
+            count(true);
+    }
+};
+
+#define ROCSOLVER_PHASE_CONCAT2(a, b) a##b
+#define ROCSOLVER_PHASE_CONCAT(a, b) ROCSOLVER_PHASE_CONCAT2(a, b)
+
+// times the rest of the enclosing scope as the phase name
+#define ROCSOLVER_PHASE(handle, name) \
+    rocsolver_phase ROCSOLVER_PHASE_CONCAT(rocsolver_phase_, __LINE__)(handle, name)
+
+#define ROCSOLVER_COUNT_BLAS_CALL() rocsolver_phase::count_blas_call()
+#define ROCSOLVER_COUNT_LAUNCH() rocsolver_phase::count_launch()
+
+// hipLaunchKernelGGL, counting the launch in the current phase
+#define ROCSOLVER_LAUNCH_KERNEL(...)                \
+    do {                                            \
+        ROCSOLVER_COUNT_LAUNCH();                   \
+        hipLaunchKernelGGL(__VA_ARGS__);            \
+    } while (0)
+
+#else
+
+inline void rocsolver_phase_flush() {}
+
+#define ROCSOLVER_PHASE(handle, name) ((void)0)
+#define ROCSOLVER_COUNT_BLAS_CALL() ((void)0)
+#define ROCSOLVER_COUNT_LAUNCH() ((void)0)
+#define ROCSOLVER_LAUNCH_KERNEL(...) hipLaunchKernelGGL(__VA_ARGS__)
+
+#endif /* ROCSOLVER_PHASE_PROFILER */
+
+#endif /* ROCSOLVER_PROFILER_HPP */
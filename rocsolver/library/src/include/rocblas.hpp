@@ -23,6 +23,7 @@ rocblas_status rocblasCall_scal(rocblas_handle handle,
                             rocblas_stride stridex,
                             rocblas_int    batch_count)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_scal_template<ROCBLAS_SCAL_NB,T>(handle,n,alpha,stridea,x,offsetx,incx,stridex,batch_count);
 } 
 
@@ -42,6 +43,7 @@ rocblas_status rocblasCall_dot(rocblas_handle handle,
                            T*             results,
                            T*             workspace)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_dot_template<ROCBLAS_DOT_NB,CONJ,T>(handle,n,cast2constType<T>(x),offsetx,incx,stridex,
                                                        cast2constType<T>(y),offsety,incy,stridey,
                                                        batch_count,results,workspace);                         
@@ -69,6 +71,7 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                            rocblas_int    batch_count,
                            T**            work)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(x),offsetx,incx,stridex,
                                         cast2constType<T>(y),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
 }
@@ -95,11 +98,12 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                            rocblas_int    batch_count,
                            T**            work)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,y,stridey,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array,dim3(blocks),dim3(256),0,stream,work,y,stridey,batch_count);
  
     return rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(x),offsetx,incx,stridex,
                                           cast2constType<T>(work),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
@@ -127,11 +131,12 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                            rocblas_int    batch_count,
                            T**            work)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,x,stridex,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array,dim3(blocks),dim3(256),0,stream,work,x,stridex,batch_count);
  
     return rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(work),offsetx,incx,stridex,
                                           cast2constType<T>(y),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
@@ -162,6 +167,7 @@ rocblas_status rocblasCall_gemv(rocblas_handle    handle,
                             rocblas_int       batch_count,
                             T**               work)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_gemv_template<T>(handle,transA,m,n,alpha,stride_alpha,
                                     cast2constType<T>(A),offseta,lda,strideA,
                                     cast2constType<T>(x),offsetx,incx,stridex,
@@ -194,11 +200,12 @@ rocblas_status rocblasCall_gemv(rocblas_handle    handle,
                             rocblas_int       batch_count,
                             T**               work)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,y,stridey,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array,dim3(blocks),dim3(256),0,stream,work,y,stridey,batch_count);
  
     return rocblas_gemv_template<T>(handle,transA,m,n,alpha,stride_alpha,
                                       cast2constType<T>(A),offseta,lda,strideA,
@@ -225,6 +232,7 @@ rocblas_status rocblasCall_trmv(rocblas_handle    handle,
                             rocblas_stride    stridew,
                             rocblas_int       batch_count)
 {
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_trmv_template<ROCBLAS_TRMV_NB>(handle,uplo,transa,diag,m,cast2constType<T>(a),offseta,lda,stridea,
                                                   x,offsetx,incx,stridex,w,stridew,batch_count);
 }
@@ -254,6 +262,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_int       batch_count,
                             T**               work)
 {
+    ROCSOLVER_PHASE(handle, "gemm");
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
                                                     cast2constType<T>(A),offset_a,ld_a,stride_a,
                                                     cast2constType<T>(B),offset_b,ld_b,stride_b,beta,
@@ -285,11 +295,13 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_int       batch_count,
                             T**               work)
 {
+    ROCSOLVER_PHASE(handle, "gemm");
+    ROCSOLVER_COUNT_BLAS_CALL();
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,A,stride_a,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array,dim3(blocks),dim3(256),0,stream,work,A,stride_a,batch_count);
  
     return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
                                                       cast2constType<T>(work),offset_a,ld_a,stride_a,
@@ -322,11 +334,13 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_int       batch_count,
                             T**               work)
 {
+    ROCSOLVER_PHASE(handle, "gemm");
+    ROCSOLVER_COUNT_BLAS_CALL();
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,B,stride_b,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array,dim3(blocks),dim3(256),0,stream,work,B,stride_b,batch_count);
  
     return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
                                                       cast2constType<T>(A),offset_a,ld_a,stride_a,
@@ -359,11 +373,13 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_int       batch_count,
                             T**               work)
 {
+    ROCSOLVER_PHASE(handle, "gemm");
+    ROCSOLVER_COUNT_BLAS_CALL();
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,C,stride_c,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array,dim3(blocks),dim3(256),0,stream,work,C,stride_c,batch_count);
  
     return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
                                                       cast2constType<T>(A),offset_a,ld_a,stride_a,
@@ -390,6 +406,8 @@ rocblas_status rocblasCall_syrk(rocblas_handle    handle,
                             rocblas_stride    strideC,
                             rocblas_int       batch_count)
 {
+    ROCSOLVER_PHASE(handle, "syrk");
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_syrk_template(handle,uplo,transA,n,k,cast2constType<T>(alpha),cast2constType<T>(A),offsetA,lda,strideA,
                                  cast2constType<T>(beta),C,offsetC,ldc,strideC,batch_count);
 }
@@ -413,6 +431,8 @@ rocblas_status rocblasCall_herk(rocblas_handle    handle,
                             rocblas_stride    strideC,
                             rocblas_int       batch_count)
 {
+    ROCSOLVER_PHASE(handle, "herk");
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_syrk_template(handle,uplo,transA,n,k,cast2constType<S>(alpha),cast2constType<T>(A),offsetA,lda,strideA,
                                  cast2constType<S>(beta),C,offsetC,ldc,strideC,batch_count);
 }
@@ -435,6 +455,8 @@ rocblas_status rocblasCall_herk(rocblas_handle    handle,
                             rocblas_stride    strideC,
                             rocblas_int       batch_count)
 {
+    ROCSOLVER_PHASE(handle, "herk");
+    ROCSOLVER_COUNT_BLAS_CALL();
     return rocblas_herk_template(handle,uplo,transA,n,k,cast2constType<S>(alpha),cast2constType<T>(A),offsetA,lda,strideA,
                                  cast2constType<S>(beta),C,offsetC,ldc,strideC,batch_count);
 }
@@ -552,5 +574,126 @@ rocblas_status rocblas_trmm(rocblas_handle handle, rocblas_side side, rocblas_fi
 }*/
 
 
+// trsm_batched
+template <typename T>
+rocblas_status rocblas_trsm_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const T *alpha, const T *const A[], rocblas_int lda, 
+                            T *const B[], rocblas_int ldb, rocblas_int batch_count);
+
+// trsm_strided_batched
+template <typename T>
+rocblas_status rocblas_trsm_strided_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const T *alpha, const T *A, rocblas_int lda, rocblas_stride strideA,
+                            T *B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+
+// trsm
+template <typename T>
+rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const T*          alpha,
+                            T*                A,
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            T*                B,
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count,
+                            T**               workArr)
+{
+    ROCSOLVER_PHASE(handle, "trsm");
+    ROCSOLVER_COUNT_BLAS_CALL();
+    return rocblas_trsm_strided_batched<T>(handle,side,uplo,transA,diag,m,n,alpha,
+                                           A + offsetA,lda,strideA,
+                                           B + offsetB,ldb,strideB,batch_count);
+}
+
+//trsm overload
+template <typename T>
+rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const T*          alpha,
+                            T *const          A[],
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            T *const          B[],
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count,
+                            T**               workArr)
+{
+    ROCSOLVER_PHASE(handle, "trsm");
+    ROCSOLVER_COUNT_BLAS_CALL();
+    // the shifted arrays of pointers are built on the device (workArr holds 2*batch_count pointers)
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1)/256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(shift_array,dim3(blocks),dim3(256),0,stream,workArr,A,offsetA,batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(shift_array,dim3(blocks),dim3(256),0,stream,workArr + batch_count,B,offsetB,batch_count);
+
+    return rocblas_trsm_batched<T>(handle,side,uplo,transA,diag,m,n,alpha,
+                                   cast2constType<T>(workArr),lda,
+                                   workArr + batch_count,ldb,batch_count);
+}
+
+// trmm
+// (computes B = op(A)*B or B = B*op(A), i.e. alpha is always 1. 
+// Batched trmm is not available from rocBLAS, thus it is done with a rocsolver kernel
+// that works with strided and pointer-array batches alike)
+template <typename T, typename U, typename V>
+rocblas_status rocblasCall_trmm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            U                 A,
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            V                 B,
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count)
+{
+    ROCSOLVER_PHASE(handle, "trmm");
+    if (!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // one work-group per column (left side) or row (right side) of B
+    rocblas_int vectors = (side == rocblas_side_left) ? n : m;
+    ROCSOLVER_LAUNCH_KERNEL(trmm_kernel<T>,dim3(vectors,batch_count),dim3(TRMM_BLOCKSIZE),0,stream,
+                            side,uplo,transA,diag,m,n,A,offsetA,lda,strideA,B,offsetB,ldb,strideB);
+
+    return rocblas_status_success;
+}
+
 
 #endif // _ROCBLAS_HPP_
@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright 2019-2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_TUNING_HPP
+#define ROCSOLVER_TUNING_HPP
+
+#include <string>
+#include <vector>
+#include "rocsolver.h"
+
+/*
+ * ===========================================================================
+ *    Algorithm parameters that can be tuned at run time.
+ *    (their default values are the ones defined in ideal_sizes.hpp)
+ * ===========================================================================
+ */
+
+enum rocsolver_tuning_param
+{
+    tuning_getrf_blocksize,         // GETRF_GETF2_SWITCHSIZE
+    tuning_getrf_rgetf2_cutoff,     // GETRF_RGETF2_CUTOFF
+    tuning_potrf_blocksize,         // POTRF_POTF2_SWITCHSIZE
+    tuning_geqrf_switchsize,        // GEQRF_GEQR2_SWITCHSIZE
+    tuning_geqrf_blocksize,         // GEQRF_GEQR2_BLOCKSIZE
+    tuning_ormqr_blocksize,         // ORMQR_ORM2R_BLOCKSIZE
+    tuning_ormlq_blocksize,         // ORMLQ_ORML2_BLOCKSIZE
+    tuning_num_params
+};
+
+// an entry of the tuning table: param takes the given value for the calls whose precision,
+// size and batch count fall in the given ranges (precision '*' matches any precision)
+struct rocsolver_tuning_entry
+{
+    rocsolver_tuning_param param;
+    char precision;
+    rocblas_int size_min, size_max;
+    rocblas_int batch_min, batch_max;
+    rocblas_int value;
+};
+
+struct rocsolver_tuning_table
+{
+    // entries loaded from files or the environment (the last matching entry wins)
+    std::vector<rocsolver_tuning_entry> entries;
+
+    // values set with rocsolver_set_tuning_parameter; they take precedence over
+    // the entries (0 means that there is no override)
+    rocblas_int overrides[tuning_num_params] = {};
+
+    // autotuning (see autotune.hpp). The values found are kept in the cache file
+    // together with the name of the device, so that they can be reused by later processes.
+    bool autotune = false;
+    std::string device;
+    std::string cache_file;
+    bool cache_loaded = false;
+};
+
+// default value of a parameter
+rocblas_int rocsolver_tuning_default(const rocsolver_tuning_param param);
+
+// returns the parameter with the given name (e.g. "getrf_blocksize"), or false if there is none
+bool rocsolver_tuning_param_from_name(const char *name, rocsolver_tuning_param *param);
+const char* rocsolver_tuning_param_name(const rocsolver_tuning_param param);
+
+// parses the entries in text and appends them to the table. Entries are separated by new lines
+// or ';' and have the form "param precision size_min size_max batch_min batch_max value",
+// where '*' matches anything; '#' starts a comment.
+bool rocsolver_tuning_parse(const std::string &text, rocsolver_tuning_table *table);
+
+// loads the file ROCSOLVER_TUNING_FILE and the entries in ROCSOLVER_TUNING (if they are set),
+// and enables autotuning if ROCSOLVER_AUTOTUNE is set (and not 0)
+void rocsolver_tuning_load_environment(rocsolver_tuning_table *table);
+
+// enables autotuning and loads the entries of the cache file that correspond to the current device
+// (the cache file is ROCSOLVER_TUNING_CACHE, or .rocsolver_tuning_cache in the home directory)
+void rocsolver_tuning_enable_autotune(rocsolver_tuning_table *table);
+
+// values of all the parameters fixed by the plan being executed by the current thread (see plan.hpp),
+// or nullptr. While they are set, they are returned without looking at the table of the handle.
+extern thread_local const rocblas_int *rocsolver_pinned_tuning;
+
+// returns the value of param for a call with the given precision, size and batch count
+rocblas_int rocsolver_get_tuning(rocblas_handle handle, const rocsolver_tuning_param param, const char precision,
+                                 const rocblas_int size, const rocblas_int batch_count);
+
+template <typename T> constexpr char rocsolver_precision();
+template <> constexpr char rocsolver_precision<float>() { return 's'; }
+template <> constexpr char rocsolver_precision<double>() { return 'd'; }
+template <> constexpr char rocsolver_precision<rocblas_float_complex>() { return 'c'; }
+template <> constexpr char rocsolver_precision<rocblas_double_complex>() { return 'z'; }
+
+template <typename T>
+rocblas_int rocsolver_get_tuning(rocblas_handle handle, const rocsolver_tuning_param param,
+                                 const rocblas_int size, const rocblas_int batch_count)
+{
+    return rocsolver_get_tuning(handle, param, rocsolver_precision<T>(), size, batch_count);
+}
+
+#endif /* ROCSOLVER_TUNING_HPP */
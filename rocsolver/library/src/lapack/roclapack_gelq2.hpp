@@ -38,6 +38,8 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle, const rocblas_int
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "gelq2");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -59,7 +61,7 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle, const rocblas_int
                                  batch_count, diag, work);
 
         // insert one in A(j,j) tobuild/apply the householder matrix 
-        hipLaunchKernelGGL(set_one_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(j,j,lda),strideA);
+        ROCSOLVER_LAUNCH_KERNEL(set_one_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(j,j,lda),strideA);
 
         // Apply Householder reflector to the rest of matrix from the right 
         if (j < m - 1) {
@@ -75,7 +77,7 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle, const rocblas_int
         }
 
         // restore original value of A(j,j)
-        hipLaunchKernelGGL(restore_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(j,j,lda),strideA);
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(j,j,lda),strideA);
 
         // restore the jth row of A
         if (COMPLEX)
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_gelqf.hpp"
+#include "handle.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_gelqf_impl(rocblas_handle handle, const rocblas_int m,
@@ -12,7 +13,9 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle, const rocblas_int m,
     if(!handle)
         return rocblas_status_invalid_handle;
     
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"gelqf",rocsolver_precision<T>());
+    log.arg("m",m,"sizem").arg("n",n,"sizen").arg("A",A).arg("lda",lda,"lda").arg("ipiv",ipiv).start();
     
     // argument checking
     if (!A || !ipiv)
@@ -25,30 +28,27 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_int batch_count = 1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;
     size_t size_4;
     size_t size_5;
-    rocsolver_gelqf_getMemorySize<T,false>(m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
-
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *workArr, *diag, *trfact;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&workArr,size_3);
-    hipMalloc(&diag,size_4);
-    hipMalloc(&trfact,size_5);
-    if (!scalars || (size_2 && !work) || (size_3 && !workArr) || (size_4 && !diag) || (size_5 && !trfact))
+    rocsolver_gelqf_getMemorySize<T,false>(handle,m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4,size_5);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"gelqf",size_2,size_3,size_4,size_5);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *workArr = mem[1], *diag = mem[2], *trfact = mem[3];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -64,11 +64,6 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle, const rocblas_int m,
                                                     (T*)diag,
                                                     (T*)trfact);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(workArr);
-    hipFree(diag);
-    hipFree(trfact);
     return status;
 }
 
@@ -14,21 +14,25 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "tuning.hpp"
 #include "roclapack_gelq2.hpp"
 #include "../auxiliary/rocauxiliary_larft.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
 
 template <typename T, bool BATCHED>
-void rocsolver_gelqf_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count,
+void rocsolver_gelqf_getMemorySize(rocblas_handle handle, const rocblas_int m, const rocblas_int n, const rocblas_int batch_count,
                                   size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5)
 {
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, min(m, n), batch_count);
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_geqrf_blocksize, min(m, n), batch_count);
+
     size_t s1,s2,s3;
     rocsolver_gelq2_getMemorySize<T,BATCHED>(m,n,batch_count,size_1,&s1,size_3,size_4);
-    if (m <= GEQRF_GEQR2_SWITCHSIZE || n <= GEQRF_GEQR2_SWITCHSIZE) {
+    if (m <= nx || n <= nx) {
         *size_2 = s1;
         *size_5 = 0;
     } else {
-        rocblas_int jb = GEQRF_GEQR2_BLOCKSIZE;
+        rocblas_int jb = nb;
         rocsolver_larft_getMemorySize<T>(jb,batch_count,&s2);
         rocsolver_larfb_getMemorySize<T>(rocblas_side_right,m-jb,n,jb,batch_count,&s3);
         *size_2 = max(s1,max(s2,s3));
@@ -47,22 +51,28 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle, const rocblas_int
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "gelqf");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // switch size and block size (the same as in the memory size query)
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, min(m, n), batch_count);
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_geqrf_blocksize, min(m, n), batch_count);
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the algorithm
-    if (m <= GEQRF_GEQR2_SWITCHSIZE || n <= GEQRF_GEQR2_SWITCHSIZE) 
+    if (m <= nx || n <= nx) 
         return rocsolver_gelq2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work, workArr, diag);
     
     rocblas_int dim = min(m, n);    //total number of pivots
     rocblas_int jb, j = 0;
 
-    rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
-    while (j < dim - GEQRF_GEQR2_SWITCHSIZE) {
+    while (j < dim - nx) {
         // Factor diagonal and subdiagonal blocks 
-        jb = min(dim - j, GEQRF_GEQR2_BLOCKSIZE);  //number of rows in the block
+        jb = min(dim - j, nb);  //number of rows in the block
         rocsolver_gelq2_template<T>(handle, jb, n-j, A, shiftA + idx2D(j,j,lda), lda, strideA, (ipiv + j), strideP, batch_count, scalars, work, workArr, diag);
 
         //apply transformation to the rest of the matrix
@@ -84,7 +94,7 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle, const rocblas_int
                                         A, shiftA + idx2D(j+jb,j,lda), lda, strideA, batch_count, work, workArr);
 
         }
-        j += GEQRF_GEQR2_BLOCKSIZE;
+        j += nb;
     }
 
     //factor last block
@@ -14,21 +14,26 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "tuning.hpp"
+#include "autotune.hpp"
 #include "roclapack_geqr2.hpp"
 #include "../auxiliary/rocauxiliary_larft.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
 
 template <typename T, bool BATCHED>
-void rocsolver_geqrf_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count,
+void rocsolver_geqrf_getMemorySize(rocblas_handle handle, const rocblas_int m, const rocblas_int n, const rocblas_int batch_count,
                                   size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5)
 {
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, min(m, n), batch_count);
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_geqrf_blocksize, min(m, n), batch_count);
+
     size_t s1,s2,s3;
     rocsolver_geqr2_getMemorySize<T,BATCHED>(m,n,batch_count,size_1,&s1,size_3,size_4);
-    if (m <= GEQRF_GEQR2_SWITCHSIZE || n <= GEQRF_GEQR2_SWITCHSIZE) {
+    if (m <= nx || n <= nx) {
         *size_2 = s1;
         *size_5 = 0;
     } else {
-        rocblas_int jb = GEQRF_GEQR2_BLOCKSIZE;
+        rocblas_int jb = nb;
         rocsolver_larft_getMemorySize<T>(jb,batch_count,&s2);
         rocsolver_larfb_getMemorySize<T>(rocblas_side_left,m,n-jb,jb,batch_count,&s3);
         *size_2 = max(s1,max(s2,s3));
@@ -47,22 +52,28 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle, const rocblas_int
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "geqrf");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // switch size and block size (the same as in the memory size query)
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, min(m, n), batch_count);
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_geqrf_blocksize, min(m, n), batch_count);
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the algorithm
-    if (m <= GEQRF_GEQR2_SWITCHSIZE || n <= GEQRF_GEQR2_SWITCHSIZE) 
+    if (m <= nx || n <= nx) 
         return rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work, workArr, diag);
     
     rocblas_int dim = min(m, n);    //total number of pivots
     rocblas_int jb, j = 0;
 
-    rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) *ldw;
 
-    while (j < dim - GEQRF_GEQR2_SWITCHSIZE) {
+    while (j < dim - nx) {
         // Factor diagonal and subdiagonal blocks 
-        jb = min(dim - j, GEQRF_GEQR2_BLOCKSIZE);  //number of columns in the block
+        jb = min(dim - j, nb);  //number of columns in the block
         rocsolver_geqr2_template<T>(handle, m-j, jb, A, shiftA + idx2D(j,j,lda), lda, strideA, (ipiv + j), strideP, batch_count, scalars, work, workArr, diag);
 
         //apply transformation to the rest of the matrix
@@ -83,7 +94,7 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle, const rocblas_int
                                         A, shiftA + idx2D(j,j+jb,lda), lda, strideA, batch_count, work, workArr);
 
         }
-        j += GEQRF_GEQR2_BLOCKSIZE;
+        j += nb;
     }
 
     //factor last block
@@ -93,4 +104,41 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle, const rocblas_int
     return rocblas_status_success;
 }
 
+// chooses the block size for the given problem if autotuning is enabled and
+// there is no value for it yet (see autotune.hpp)
+template <typename T>
+void rocsolver_geqrf_autotune(rocblas_handle handle, const rocblas_int m, const rocblas_int n, const rocblas_int batch_count)
+{
+    // (the block size is not used if the unblocked algorithm is selected)
+    rocblas_int nx = rocsolver_get_tuning<T>(handle, tuning_geqrf_switchsize, min(m, n), batch_count);
+    if (m <= nx || n <= nx)
+        return;
+    if (!rocsolver_autotune_wanted(handle, tuning_geqrf_blocksize, rocsolver_precision<T>(), min(m, n), batch_count))
+        return;
+
+    rocsolver_autotune_scratch<T> scratch(m, n, batch_count);
+    if (!scratch)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    auto run = [&]() {
+        size_t size_1, size_2, size_3, size_4, size_5;
+        size_t size_6 = sizeof(T)*scratch.strideP*scratch.batch_count;  //householder scalars
+        rocsolver_geqrf_getMemorySize<T,false>(handle,m,n,scratch.batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+        rocsolver_device_malloc mem(handle,"geqrf_autotune",size_2,size_3,size_4,size_5,size_6);
+        T *scalars = rocsolver_get_constants<T>(handle);
+        if (!mem || !scalars)
+            return rocblas_status_memory_error;
+
+        scratch.init(stream);
+        return rocsolver_geqrf_template<false,true,T>(handle,m,n,scratch.A,0,scratch.lda,scratch.strideA,
+                                                      (T*)mem[4],scratch.strideP,scratch.batch_count,
+                                                      scalars,(T*)mem[0],(T**)mem[1],(T*)mem[2],(T*)mem[3]);
+    };
+    rocsolver_autotune<T>(handle, tuning_geqrf_blocksize, min(m, n), batch_count, {16, 32, 64, 128}, run);
+}
+
 #endif /* ROCLAPACK_GEQRF_H */
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqrf.hpp"
+#include "plan.hpp"
+
+template <bool BATCHED, typename T>
+rocblas_status rocsolver_geqrf_plan_create_impl(rocblas_handle handle, const char *routine, const rocblas_int m,
+                                                const rocblas_int n, const rocblas_int lda, const rocblas_stride strideA,
+                                                const rocblas_stride stridep, const rocblas_int batch_count,
+                                                rocsolver_plan *plan)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if (m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+
+    // block size selection (only when autotuning is enabled)
+    rocsolver_geqrf_autotune<T>(handle,m,n,batch_count);
+
+    // memory managment
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
+    size_t size_2;  //size of workspace
+    size_t size_3;
+    size_t size_4;
+    size_t size_5;  //size of the triangular factor of the block reflectors
+    rocsolver_geqrf_getMemorySize<T,BATCHED>(handle,m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+    std::unique_ptr<_rocsolver_plan> p(new _rocsolver_plan(handle,routine,rocsolver_precision<T>()));
+    p->m = m;
+    p->n = n;
+    p->lda = lda;
+    p->strideA = strideA;
+    p->strideP = stridep;
+    p->batch_count = batch_count;
+
+    // tuning values and memory allocation (the workspace is owned by the plan)
+    if (!rocsolver_plan_prepare(p.get(),min(m,n),size_2,size_3,size_4,size_5))
+        return rocblas_status_memory_error;
+
+    // scalars constants for rocblas functions calls
+    p->scalars = rocsolver_get_constants<T>(handle);
+    if (!p->scalars)
+        return rocblas_status_memory_error;
+
+    *plan = p.release();
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geqrf_plan_execute_impl(rocsolver_plan plan, const char *routine, U A, T* ipiv)
+{
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+    if (!plan->is(routine,rocsolver_precision<T>()))
+        return rocblas_status_invalid_value;
+
+    // logging (as a call to the routine)
+    rocsolver_logger log(plan->handle,plan->log,routine,rocsolver_precision<T>());
+    log.arg("m",plan->m,"sizem").arg("n",plan->n,"sizen").arg("A",A).arg("lda",plan->lda,"lda");
+    if (STRIDED)
+        log.arg("strideA",plan->strideA,"bsa");
+    log.arg("ipiv",ipiv);
+    if (BATCHED || STRIDED)
+        log.arg("stridep",plan->strideP,"bsp").arg("batch_count",plan->batch_count,"batch");
+    log.start();
+
+    // argument checking
+    if (!A || !ipiv)
+        return rocblas_status_invalid_pointer;
+
+    // execution (with the tuning values of the plan), or replay of its graph
+    rocsolver_plan_scope scope(plan);
+    void **buf = plan->buffers;
+    return rocsolver_plan_run(plan,{A,ipiv},[&] {
+        return rocsolver_geqrf_template<BATCHED,STRIDED,T>(plan->handle,plan->m,plan->n,
+                                                            A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                                            plan->lda,plan->strideA,
+                                                            ipiv,
+                                                            plan->strideP,
+                                                            plan->batch_count,
+                                                            (T*)plan->scalars,
+                                                            (T*)buf[0],
+                                                            (T**)buf[1],
+                                                            (T*)buf[2],
+                                                            (T*)buf[3]);
+    });
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,float>(handle, "geqrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,double>(handle, "geqrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,rocblas_float_complex>(handle, "geqrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,rocblas_double_complex>(handle, "geqrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride stridep, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<true,float>(handle, "geqrf_batched", m, n, lda, 0, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride stridep, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<true,double>(handle, "geqrf_batched", m, n, lda, 0, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride stridep, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<true,rocblas_float_complex>(handle, "geqrf_batched", m, n, lda, 0, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride stridep, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<true,rocblas_double_complex>(handle, "geqrf_batched", m, n, lda, 0, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride stridep, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,float>(handle, "geqrf_strided_batched", m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride stridep, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,double>(handle, "geqrf_strided_batched", m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride stridep, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,rocblas_float_complex>(handle, "geqrf_strided_batched", m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride stridep, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_geqrf_plan_create_impl<false,rocblas_double_complex>(handle, "geqrf_strided_batched", m, n, lda, strideA, stridep, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_plan_execute(rocsolver_plan plan, float *A, float *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,false,float>(plan, "geqrf", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_plan_execute(rocsolver_plan plan, double *A, double *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,false,double>(plan, "geqrf", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_float_complex *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,false,rocblas_float_complex>(plan, "geqrf", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_double_complex *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,false,rocblas_double_complex>(plan, "geqrf", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched_plan_execute(rocsolver_plan plan, float *const A[], float *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<true,false,float>(plan, "geqrf_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched_plan_execute(rocsolver_plan plan, double *const A[], double *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<true,false,double>(plan, "geqrf_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], rocblas_float_complex *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<true,false,rocblas_float_complex>(plan, "geqrf_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], rocblas_double_complex *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<true,false,rocblas_double_complex>(plan, "geqrf_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched_plan_execute(rocsolver_plan plan, float *A, float *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,true,float>(plan, "geqrf_strided_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched_plan_execute(rocsolver_plan plan, double *A, double *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,true,double>(plan, "geqrf_strided_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgeqrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_float_complex *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,true,rocblas_float_complex>(plan, "geqrf_strided_batched", A, ipiv);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgeqrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_double_complex *ipiv)
+{
+    return rocsolver_geqrf_plan_execute_impl<false,true,rocblas_double_complex>(plan, "geqrf_strided_batched", A, ipiv);
+}
+
+} //extern C
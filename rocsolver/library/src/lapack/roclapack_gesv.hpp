@@ -0,0 +1,259 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_HPP
+#define ROCLAPACK_GESV_HPP
+
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+// LU factorization and solution of tiny systems (at most DIM equations) with one
+// work-group per system. A stays in registers from the factorization to the triangular
+// solves, and the right hand sides are solved in blocks of GESV_SMALL_RHS_BLOCK columns
+// (every thread keeps a row of the block in registers; only the solved row goes through LDS).
+template <int DIM, typename T, typename U>
+__global__ void gesv_small(const rocblas_int n, const rocblas_int nrhs, U A, const rocblas_int shiftA,
+                           const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipivA,
+                           const rocblas_stride strideP, U B, const rocblas_int shiftB,
+                           const rocblas_int ldb, const rocblas_stride strideB, rocblas_int* info)
+{
+    int b = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;   //row owned by this thread
+
+    T* M = load_ptr_batch<T>(A,b,shiftA,strideA);
+    T* X = load_ptr_batch<T>(B,b,shiftB,strideB);
+    rocblas_int *ipiv = ipivA + b*strideP;
+
+    __shared__ rocblas_int sipiv[DIM];
+    __shared__ rocblas_int perm[DIM];              //row of B that ends in every row after the interchanges
+    __shared__ T xrow[GESV_SMALL_RHS_BLOCK];       //solved row
+
+    // factorize A
+    T rA[DIM];
+    #pragma unroll
+    for (int k = 0; k < DIM; ++k)
+        rA[k] = (tid < n && k < n) ? M[tid + k*lda] : 0;
+
+    rocblas_int iinfo = getrf_small_factor<DIM>(n, n, rA, sipiv);
+
+    if (tid < n) {
+        #pragma unroll
+        for (int k = 0; k < DIM; ++k) {
+            if (k < n)
+                M[tid + k*lda] = rA[k];
+        }
+        ipiv[tid] = sipiv[tid];
+    }
+    if (tid == 0)
+        info[b] = iinfo;
+
+    // (as in LAPACK, B is not modified if A is singular)
+    if (iinfo > 0)
+        return;
+
+    if (tid == 0) {
+        for (rocblas_int i = 0; i < n; ++i)
+            perm[i] = i;
+        for (rocblas_int j = 0; j < n; ++j) {
+            rocblas_int p = sipiv[j] - 1;
+            rocblas_int t = perm[j];
+            perm[j] = perm[p];
+            perm[p] = t;
+        }
+    }
+    __syncthreads();
+
+    for (rocblas_int c = 0; c < nrhs; c += GESV_SMALL_RHS_BLOCK) {
+        // load the block of B with the interchanges applied
+        T rB[GESV_SMALL_RHS_BLOCK];
+        #pragma unroll
+        for (int k = 0; k < GESV_SMALL_RHS_BLOCK; ++k)
+            rB[k] = (tid < n && c + k < nrhs) ? X[perm[tid] + (c + k)*ldb] : 0;
+        __syncthreads();
+
+        // solve L*Y = B
+        #pragma unroll
+        for (int j = 0; j < DIM; ++j) {
+            if (j < n) {
+                if (tid == j) {
+                    #pragma unroll
+                    for (int k = 0; k < GESV_SMALL_RHS_BLOCK; ++k)
+                        xrow[k] = rB[k];
+                }
+                __syncthreads();
+
+                if (tid > j && tid < n) {
+                    #pragma unroll
+                    for (int k = 0; k < GESV_SMALL_RHS_BLOCK; ++k)
+                        rB[k] -= rA[j] * xrow[k];
+                }
+                __syncthreads();
+            }
+        }
+
+        // solve U*X = Y
+        #pragma unroll
+        for (int j = DIM - 1; j >= 0; --j) {
+            if (j < n) {
+                if (tid == j) {
+                    T d = 1 / rA[j];
+                    #pragma unroll
+                    for (int k = 0; k < GESV_SMALL_RHS_BLOCK; ++k) {
+                        rB[k] *= d;
+                        xrow[k] = rB[k];
+                    }
+                }
+                __syncthreads();
+
+                if (tid < j) {
+                    #pragma unroll
+                    for (int k = 0; k < GESV_SMALL_RHS_BLOCK; ++k)
+                        rB[k] -= rA[j] * xrow[k];
+                }
+                __syncthreads();
+            }
+        }
+
+        if (tid < n) {
+            #pragma unroll
+            for (int k = 0; k < GESV_SMALL_RHS_BLOCK; ++k) {
+                if (c + k < nrhs)
+                    X[tid + (c + k)*ldb] = rB[k];
+            }
+        }
+    }
+}
+
+template <typename T, typename U>
+void rocsolver_gesv_small(hipStream_t stream, const rocblas_int n, const rocblas_int nrhs, U A, const rocblas_int shiftA,
+                          const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipiv,
+                          const rocblas_stride strideP, U B, const rocblas_int shiftB, const rocblas_int ldb,
+                          const rocblas_stride strideB, rocblas_int* info, const rocblas_int batch_count)
+{
+    dim3 grid(batch_count, 1, 1);
+    dim3 threads(GETRF_SMALL_MAXSIZE, 1, 1);
+
+    // the number of registers kept per thread is the smallest of {8,16,32} that fits n
+    // (HIP_KERNEL_NAME cannot go through ROCSOLVER_LAUNCH_KERNEL, thus the launch is counted here)
+    ROCSOLVER_COUNT_LAUNCH();
+    if (n <= 8)
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(gesv_small<8,T>), grid, threads, 0, stream,
+                           n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info);
+    else if (n <= 16)
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(gesv_small<16,T>), grid, threads, 0, stream,
+                           n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info);
+    else
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(gesv_small<32,T>), grid, threads, 0, stream,
+                           n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info);
+}
+
+// copies B of the singular systems (info > 0) to W, or back from W if restore
+// (as in LAPACK, B is not modified if A is singular, but getrs solves every system of the batch)
+template <typename T, typename U>
+__global__ void gesv_keep_singular(const rocblas_int n, U B, const rocblas_int shiftB, const rocblas_int ldb,
+                                   const rocblas_stride strideB, T *W, const rocblas_int *info, const bool restore)
+{
+    int b = hipBlockIdx_z;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < n && info[b] > 0) {
+        T *X = load_ptr_batch<T>(B,b,shiftB,strideB);
+        T *Wb = W + size_t(b)*n*hipGridDim_y;
+        if (restore)
+            X[i + j*ldb] = Wb[i + j*n];
+        else
+            Wb[i + j*n] = X[i + j*ldb];
+    }
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_gesv_getMemorySize(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count,
+                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4,
+                                  size_t *size_5, size_t *size_6, size_t *size_7)
+{
+    // tiny systems need no workspace
+    if (n <= GESV_SMALL_MAXSIZE || batch_count == 0) {
+        *size_1 = 0;
+        *size_2 = 0;
+        *size_3 = 0;
+        *size_4 = 0;
+        *size_5 = 0;
+        *size_6 = 0;
+        *size_7 = 0;
+        return;
+    }
+
+    // (the arrays of pointers are shared by getrf and getrs)
+    size_t s;
+    rocsolver_getrf_getMemorySize<BATCHED,T>(handle,n,n,batch_count,size_1,size_2,size_3,size_4,size_5,size_6);
+    rocsolver_getrs_getMemorySize<BATCHED,T>(n,nrhs,batch_count,&s);
+    *size_4 = max(*size_4, s);
+
+    // copy of the right hand sides of the singular systems
+    *size_7 = sizeof(T)*n*nrhs*batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gesv_template(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                       U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                       rocblas_int *ipiv, const rocblas_stride strideP,
+                                       U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                                       rocblas_int *info, const rocblas_int batch_count,
+                                       T* scalars, T* pivotGPU, rocblas_int* iinfo, T** workArr,
+                                       real_t<T>* pivotVal, rocblas_int* pivotIdx, T* keepB)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if (n == 0) {
+        rocblas_int blocks = (batch_count - 1) / GETF2_BLOCKSIZE + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info,dim3(blocks,1,1),dim3(GETF2_BLOCKSIZE,1,1),0,stream,info,batch_count,0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_PHASE(handle, "gesv");
+
+    // tiny systems are factorized and solved in one pass, with one work-group per system
+    if (n <= GESV_SMALL_MAXSIZE) {
+        rocsolver_gesv_small<T>(stream, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP,
+                                B, shiftB, ldb, strideB, info, batch_count);
+        return rocblas_status_success;
+    }
+
+    // factorize A
+    rocsolver_getrf_template<BATCHED,STRIDED,T>(handle,n,n,A,shiftA,lda,strideA,ipiv,0,strideP,info,batch_count,
+                                                scalars,pivotGPU,iinfo,workArr,pivotVal,pivotIdx);
+
+    if (nrhs == 0)
+        return rocblas_status_success;
+
+    // solve A*X = B, overwriting B with X
+    // (the right hand sides of the singular systems are restored afterwards)
+    rocblas_int blocks = (n - 1) / GETF2_BLOCKSIZE + 1;
+    dim3 grid(blocks,nrhs,batch_count);
+    dim3 threads(GETF2_BLOCKSIZE,1,1);
+    ROCSOLVER_LAUNCH_KERNEL(gesv_keep_singular<T>,grid,threads,0,stream,
+                            n,B,shiftB,ldb,strideB,keepB,info,false);
+    rocsolver_getrs_template<T>(handle,rocblas_operation_none,n,nrhs,A,shiftA,lda,strideA,ipiv,strideP,
+                                B,shiftB,ldb,strideB,batch_count,workArr);
+    ROCSOLVER_LAUNCH_KERNEL(gesv_keep_singular<T>,grid,threads,0,stream,
+                            n,B,shiftB,ldb,strideB,keepB,info,true);
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GESV_HPP */
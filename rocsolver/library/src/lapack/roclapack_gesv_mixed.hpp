@@ -0,0 +1,484 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routines DSGESV and ZCGESV (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_MIXED_HPP
+#define ROCLAPACK_GESV_MIXED_HPP
+
+#include <limits>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "graph.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+// maximum number of refinement steps, and the factor of the backward error accepted
+// (as in LAPACK)
+#define GESV_MIXED_ITERMAX 30
+#define GESV_MIXED_BWDMAX 1.0
+
+// precision in which the mixed-precision solvers factorize the matrices
+template <typename T> struct gesv_mixed_lower;
+template <> struct gesv_mixed_lower<double> { using type = float; };
+template <> struct gesv_mixed_lower<rocblas_double_complex> { using type = rocblas_float_complex; };
+template <typename T> using lower_t = typename gesv_mixed_lower<T>::type;
+
+// name of the routine for the logger, which prepends the precision (rocsolver_dsgesv is
+// "sgesv" in double precision, and rocsolver_zcgesv is "cgesv" in double complex precision),
+// or for the memory statistics of the handle (e.g. "dsgesv" and "zcgesv", so that they are
+// not mixed with the statistics of sgesv and cgesv)
+template <typename T> constexpr const char* gesv_mixed_name(const char *real, const char *complex)
+{
+    return is_complex<T> ? complex : real;
+}
+
+// state of every system during the refinement: GESV_MIXED_REFINING until it converges
+// (GESV_MIXED_DONE), or the value of iter (< 0) that tells why it falls back to the factorization
+// in working precision
+#define GESV_MIXED_REFINING 0
+#define GESV_MIXED_DONE 1
+
+template <typename T, typename S, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ __host__ inline T gesv_mixed_cast(const S x)
+{
+    return T(x);
+}
+
+template <typename T, typename S, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ __host__ inline T gesv_mixed_cast(const S x)
+{
+    return T(x.real(), x.imag());
+}
+
+// modulus of x (for the norm of A, as LAPACK ZLANGE)
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline T gesv_mixed_abs(const T x)
+{
+    return x < 0 ? -x : x;
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline real_t<T> gesv_mixed_abs(const T x)
+{
+    return sqrt(x.real()*x.real() + x.imag()*x.imag());
+}
+
+// returns true if x cannot be represented in precision S (as LAPACK DLAG2S, NaNs are converted)
+template <typename S, typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline bool gesv_mixed_overflows(const T x)
+{
+    const T rmax = std::numeric_limits<S>::max();
+    return x < -rmax || x > rmax;
+}
+
+template <typename S, typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline bool gesv_mixed_overflows(const T x)
+{
+    return gesv_mixed_overflows<real_t<S>>(x.real()) || gesv_mixed_overflows<real_t<S>>(x.imag());
+}
+
+// maximum of val over the work-group (the result is returned to all the threads)
+template <typename S>
+__device__ S gesv_mixed_max_reduce(S val)
+{
+    __shared__ S sval[GESV_MIXED_BLOCKSIZE];
+    int tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+    for (int s = GESV_MIXED_BLOCKSIZE / 2; s > 0; s /= 2) {
+        if (tid < s && sval[tid + s] > sval[tid])
+            sval[tid] = sval[tid + s];
+        __syncthreads();
+    }
+    val = sval[0];
+    __syncthreads();
+    return val;
+}
+
+// starts the refinement of every system, and computes the threshold of its residual from the
+// infinity-norm of A. One work-group per matrix.
+template <typename T, typename U>
+__global__ void gesv_mixed_init(const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda,
+                                const rocblas_stride strideA, real_t<T> *cte, rocblas_int *state,
+                                rocblas_int *iter, rocblas_int *info)
+{
+    using R = real_t<T>;
+    int b = hipBlockIdx_x;
+    T *Ap = load_ptr_batch<T>(A,b,shiftA,strideA);
+
+    R anrm = 0;
+    for (rocblas_int i = hipThreadIdx_x; i < n; i += GESV_MIXED_BLOCKSIZE) {
+        R s = 0;
+        for (rocblas_int j = 0; j < n; ++j) {
+            s += gesv_mixed_abs(Ap[i + j*lda]);
+        }
+        anrm = s > anrm ? s : anrm;
+    }
+    anrm = gesv_mixed_max_reduce(anrm);
+
+    if (hipThreadIdx_x == 0) {
+        // (LAPACK uses the relative machine precision, half the epsilon of C++)
+        cte[b] = anrm * std::numeric_limits<R>::epsilon() * R(0.5) * sqrt(R(n)) * R(GESV_MIXED_BWDMAX);
+        state[b] = GESV_MIXED_REFINING;
+        iter[b] = 0;
+        info[b] = 0;
+    }
+}
+
+// converts the m-by-n matrices A of the systems still refining to the lower precision S.
+// If an entry overflows, the system falls back to the working precision.
+template <typename T, typename S, typename U>
+__global__ void gesv_mixed_lower_copy(const rocblas_int m, const rocblas_int n, U A, const rocblas_int shiftA,
+                                      const rocblas_int lda, const rocblas_stride strideA,
+                                      S *W, const rocblas_int ldw, const rocblas_stride strideW,
+                                      rocblas_int *state)
+{
+    int b = hipBlockIdx_z;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < m && state[b] == GESV_MIXED_REFINING) {
+        T a = load_ptr_batch<T>(A,b,shiftA,strideA)[i + j*lda];
+        if (gesv_mixed_overflows<S>(a))
+            state[b] = -2;
+        W[b*strideW + i + j*ldw] = gesv_mixed_cast<S>(a);
+    }
+}
+
+// sets the sinfo of a failed factorization in lower precision as the state of the system
+template <typename T>
+__global__ void gesv_mixed_check_info(const rocblas_int *sinfo, rocblas_int *state, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b < batch_count && state[b] == GESV_MIXED_REFINING && sinfo[b] > 0)
+        state[b] = -3;
+}
+
+// R = B for the systems still refining (the residual B - A*X is then completed by gemm)
+template <typename T, typename U>
+__global__ void gesv_mixed_copy(const rocblas_int n, U B, const rocblas_int shiftB, const rocblas_int ldb,
+                                const rocblas_stride strideB, T *R, const rocblas_int ldr,
+                                const rocblas_stride strideR, const rocblas_int *state)
+{
+    int b = hipBlockIdx_z;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < n && state[b] == GESV_MIXED_REFINING)
+        R[b*strideR + i + j*ldr] = load_ptr_batch<T>(B,b,shiftB,strideB)[i + j*ldb];
+}
+
+// X = W (first) or X = X + W, with the solution W in lower precision, for the systems still refining
+template <typename T, typename S, typename U>
+__global__ void gesv_mixed_update(const rocblas_int n, U X, const rocblas_int shiftX, const rocblas_int ldx,
+                                  const rocblas_stride strideX, const S *W, const rocblas_int ldw,
+                                  const rocblas_stride strideW, const rocblas_int *state, const bool first)
+{
+    int b = hipBlockIdx_z;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < n && state[b] == GESV_MIXED_REFINING) {
+        T *x = load_ptr_batch<T>(X,b,shiftX,strideX) + i + j*ldx;
+        T w = gesv_mixed_cast<T>(W[b*strideW + i + j*ldw]);
+        *x = first ? w : *x + w;
+    }
+}
+
+// checks the convergence of the systems still refining after it refinement steps: every column
+// of the residual R must be at most cte times the corresponding column of X (in max-norm).
+// The systems that do not converge are counted in remaining. One work-group per matrix.
+template <typename T, typename U>
+__global__ void gesv_mixed_check(const rocblas_int n, const rocblas_int nrhs, U X, const rocblas_int shiftX,
+                                 const rocblas_int ldx, const rocblas_stride strideX, const T *R,
+                                 const rocblas_int ldr, const rocblas_stride strideR, const real_t<T> *cte,
+                                 rocblas_int *state, rocblas_int *iter, const rocblas_int it, rocblas_int *remaining)
+{
+    using S = real_t<T>;
+    int b = hipBlockIdx_x;
+
+    if (state[b] != GESV_MIXED_REFINING)
+        return;
+
+    T *Xp = load_ptr_batch<T>(X,b,shiftX,strideX);
+    const T *Rp = R + b*strideR;
+    bool converged = true;
+
+    for (rocblas_int j = 0; j < nrhs && converged; ++j) {
+        S xnrm = 0, rnrm = 0;
+        for (rocblas_int i = hipThreadIdx_x; i < n; i += GESV_MIXED_BLOCKSIZE) {
+            S x = getf2_abs(Xp[i + j*ldx]);
+            S r = getf2_abs(Rp[i + j*ldr]);
+            xnrm = x > xnrm ? x : xnrm;
+            rnrm = r > rnrm ? r : rnrm;
+        }
+        xnrm = gesv_mixed_max_reduce(xnrm);
+        rnrm = gesv_mixed_max_reduce(rnrm);
+        converged = !(rnrm > xnrm * cte[b]);
+    }
+
+    if (hipThreadIdx_x == 0) {
+        if (converged) {
+            state[b] = GESV_MIXED_DONE;
+            iter[b] = it;
+        } else if (it == GESV_MIXED_ITERMAX) {
+            state[b] = -(GESV_MIXED_ITERMAX + 1);
+        } else {
+            atomicAdd(remaining, 1);
+        }
+    }
+}
+
+// lists the systems that fall back to the working precision (their number is counted in count),
+// with the pointers to their matrices
+template <typename T, typename U>
+__global__ void gesv_mixed_fallback_list(U A, const rocblas_int shiftA, const rocblas_stride strideA,
+                                         U X, const rocblas_int shiftX, const rocblas_stride strideX,
+                                         const rocblas_int *state, rocblas_int *iter, const rocblas_int batch_count,
+                                         T **Aptr, T **Xptr, rocblas_int *map, rocblas_int *count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b < batch_count && state[b] < 0) {
+        iter[b] = state[b];
+        rocblas_int k = atomicAdd(count, 1);
+        map[k] = b;
+        Aptr[k] = load_ptr_batch<T>(A,b,shiftA,strideA);
+        Xptr[k] = load_ptr_batch<T>(X,b,shiftX,strideX);
+    }
+}
+
+// X = B for the k-th listed system
+template <typename T, typename U>
+__global__ void gesv_mixed_fallback_copy(const rocblas_int n, U B, const rocblas_int shiftB, const rocblas_int ldb,
+                                         const rocblas_stride strideB, T *const Xptr[], const rocblas_int ldx,
+                                         const rocblas_int *map)
+{
+    int k = hipBlockIdx_z;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < n)
+        Xptr[k][i + j*ldx] = load_ptr_batch<T>(B,map[k],shiftB,strideB)[i + j*ldb];
+}
+
+// copies the pivots and info of the k-th listed system to their place in the batch
+template <typename T>
+__global__ void gesv_mixed_fallback_scatter(const rocblas_int n, const rocblas_int *ipivW, const rocblas_int *infoW,
+                                            rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int *info,
+                                            const rocblas_int *map)
+{
+    int k = hipBlockIdx_y;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int b = map[k];
+
+    if (i < n)
+        ipiv[b*strideP + i] = ipivW[k*n + i];
+    if (i == 0)
+        info[b] = infoW[k];
+}
+
+// reads a counter kept on the device. This waits for all the work queued on the stream.
+inline rocblas_int gesv_mixed_read(hipStream_t stream, const rocblas_int *counter)
+{
+    rocblas_int value = 0;
+    if (hipMemcpyAsync(&value, counter, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream) != hipSuccess
+        || hipStreamSynchronize(stream) != hipSuccess)
+        return -1;
+    return value;
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_gesv_mixed_getMemorySize(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                        const rocblas_int batch_count,
+                                        size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4,
+                                        size_t *size_5, size_t *size_6, size_t *size_7, size_t *size_8,
+                                        size_t *size_9, size_t *size_10, size_t *size_11, size_t *size_12)
+{
+    using S = lower_t<T>;
+
+    // workspace of the factorizations (in lower precision, and in working precision for the
+    // systems that fall back to it; they are used one after the other)
+    size_t s1, s2, s3, s4, s5, s6, sr;
+    rocsolver_getrf_getMemorySize<false,S>(handle,n,n,batch_count,size_1,size_2,size_3,size_4,size_5,size_6);
+    rocsolver_getrf_getMemorySize<true,T>(handle,n,n,batch_count,&s1,&s2,&s3,&s4,&s5,&s6);
+    rocsolver_getrs_getMemorySize<true,T>(n,nrhs,batch_count,&sr);
+    *size_1 = max(*size_1, s1);
+    *size_2 = max(*size_2, s2);
+    *size_3 = max(*size_3, s3);
+    *size_4 = max(max(*size_4, s4), sr);
+    *size_5 = max(*size_5, s5);
+    *size_6 = max(*size_6, s6);
+
+    // matrices and solutions in lower precision
+    *size_7 = sizeof(S)*n*(n + nrhs)*batch_count;
+
+    // residuals
+    *size_8 = sizeof(T)*n*nrhs*batch_count;
+
+    // thresholds of the residuals
+    *size_9 = sizeof(real_t<T>)*batch_count;
+
+    // state, info of the factorization in lower precision, list of systems that fall back
+    // to the working precision (and their info) and counters
+    *size_10 = sizeof(rocblas_int)*(4*batch_count + 2);
+
+    // pivots of the systems that fall back to the working precision
+    *size_11 = sizeof(rocblas_int)*n*batch_count;
+
+    // arrays of pointers to their matrices and solutions
+    *size_12 = 2*sizeof(T*)*batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gesv_mixed_template(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                             U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                             rocblas_int *ipiv, const rocblas_stride strideP,
+                                             U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                                             U X, const rocblas_int shiftX, const rocblas_int ldx, const rocblas_stride strideX,
+                                             rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count,
+                                             lower_t<T>* scalarsS, T* scalars, void* pivotGPU, rocblas_int* iinfo, void** workArr,
+                                             void* pivotVal, rocblas_int* pivotIdx, lower_t<T>* swork, T* R,
+                                             real_t<T>* cte, rocblas_int* flags, rocblas_int* ipivW, T** ptrs)
+{
+    using S = lower_t<T>;
+
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / GESV_MIXED_BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(GESV_MIXED_BLOCKSIZE, 1, 1);
+
+    if (n == 0 || nrhs == 0) {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,iter,batch_count,0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
+        return rocblas_status_success;
+    }
+
+    // (the convergence of the refinement is read on the host, which cannot be done while
+    // the stream is captured into a graph)
+    if (rocsolver_is_capturing(handle))
+        return rocblas_status_not_implemented;
+
+    ROCSOLVER_PHASE(handle, "gesv_mixed");
+
+    rocblas_int *state = flags;
+    rocblas_int *sinfo = flags + batch_count;
+    rocblas_int *map = flags + 2*batch_count;
+    rocblas_int *infoW = flags + 3*batch_count;
+    rocblas_int *counter = flags + 4*batch_count;
+
+    // the matrices and the solutions in lower precision are packed in swork
+    // (the strides are computed in 64 bits, as n*n*batch_count may not fit in rocblas_int)
+    rocblas_stride strideSA = rocblas_stride(n)*n;
+    rocblas_stride strideSX = rocblas_stride(n)*nrhs;
+    rocblas_stride strideR = rocblas_stride(n)*nrhs;
+    S *SA = swork;
+    S *SX = swork + strideSA*batch_count;
+
+    rocblas_int blocks = (n - 1) / GESV_MIXED_BLOCKSIZE + 1;
+    dim3 gridA(blocks, n, batch_count);
+    dim3 gridB(blocks, nrhs, batch_count);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle,&old_mode);
+    rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
+
+    //constants to use when calling rocablas functions
+    T one = 1;                    //constant 1 in host
+    T minone = -1;                //constant -1 in host
+
+    // convert B and A to lower precision, and factorize A
+    ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_init<T>),dim3(batch_count),threads,0,stream,
+                            n,A,shiftA,lda,strideA,cte,state,iter,info);
+    ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_lower_copy<T,S>),gridB,threads,0,stream,
+                            n,nrhs,B,shiftB,ldb,strideB,SX,n,strideSX,state);
+    ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_lower_copy<T,S>),gridA,threads,0,stream,
+                            n,n,A,shiftA,lda,strideA,SA,n,strideSA,state);
+
+    rocsolver_getrf_template<false,true,S>(handle,n,n,SA,0,n,strideSA,ipiv,0,strideP,sinfo,batch_count,
+                                           scalarsS,(S*)pivotGPU,iinfo,(S**)workArr,(real_t<S>*)pivotVal,pivotIdx);
+    ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_check_info<T>,gridReset,threads,0,stream,sinfo,state,batch_count);
+
+    // solve in lower precision, and refine the solution until the residual is small enough.
+    // (the systems that converge, or that fall back to the working precision, are skipped by
+    // the kernels; the refinement ends as soon as no system is left)
+    for (rocblas_int it = 0; it <= GESV_MIXED_ITERMAX; ++it) {
+        ROCSOLVER_PHASE(handle, "refine");
+
+        if (it > 0)
+            ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_lower_copy<T,S>),gridB,threads,0,stream,
+                                    n,nrhs,R,0,n,strideR,SX,n,strideSX,state);
+        rocsolver_getrs_template<S>(handle,rocblas_operation_none,n,nrhs,SA,0,n,strideSA,ipiv,strideP,
+                                    SX,0,n,strideSX,batch_count,(S**)workArr);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_update<T,S>),gridB,threads,0,stream,
+                                n,X,shiftX,ldx,strideX,SX,n,strideSX,state,it == 0);
+
+        // R = B - A*X
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_copy<T>,gridB,threads,0,stream,
+                                n,B,shiftB,ldb,strideB,R,n,strideR,state);
+        rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                            n, nrhs, n, &minone,
+                                            A, shiftA, lda, strideA,
+                                            X, shiftX, ldx, strideX, &one,
+                                            R, 0, n, strideR, batch_count, (T**)workArr);
+
+        ROCSOLVER_LAUNCH_KERNEL(reset_info,dim3(1),dim3(1),0,stream,counter,1,0);
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_check<T>,dim3(batch_count),threads,0,stream,
+                                n,nrhs,X,shiftX,ldx,strideX,R,n,strideR,cte,state,iter,it,counter);
+        rocblas_int remaining = gesv_mixed_read(stream, counter);
+        if (remaining < 0) {
+            rocblas_set_pointer_mode(handle,old_mode);
+            return rocblas_status_internal_error;
+        }
+        if (remaining == 0)
+            break;
+    }
+
+    // the systems that did not converge are solved with a factorization in working precision
+    // (as batched problems, through arrays of pointers to their matrices)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info,dim3(1),dim3(1),0,stream,counter,1,0);
+    ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_fallback_list<T>,gridReset,threads,0,stream,
+                            A,shiftA,strideA,X,shiftX,strideX,state,iter,batch_count,
+                            ptrs,ptrs + batch_count,map,counter);
+    rocblas_int count = gesv_mixed_read(stream, counter);
+    if (count < 0) {
+        rocblas_set_pointer_mode(handle,old_mode);
+        return rocblas_status_internal_error;
+    }
+
+    if (count > 0) {
+        ROCSOLVER_PHASE(handle, "fallback");
+
+        T *const *Aptr = ptrs;
+        T *const *Xptr = ptrs + batch_count;
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_fallback_copy<T>,dim3(blocks,nrhs,count),threads,0,stream,
+                                n,B,shiftB,ldb,strideB,Xptr,ldx,map);
+        rocsolver_getrf_template<true,false,T>(handle,n,n,Aptr,0,lda,0,ipivW,0,n,infoW,count,
+                                               scalars,(T*)pivotGPU,iinfo,(T**)workArr,(real_t<T>*)pivotVal,pivotIdx);
+        rocsolver_getrs_template<T>(handle,rocblas_operation_none,n,nrhs,Aptr,0,lda,0,ipivW,n,
+                                    Xptr,0,ldx,0,count,(T**)workArr);
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_fallback_scatter<T>,dim3(blocks,count),threads,0,stream,
+                                n,ipivW,infoW,ipiv,strideP,info,map);
+    }
+
+    rocblas_set_pointer_mode(handle,old_mode);
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GESV_MIXED_HPP */
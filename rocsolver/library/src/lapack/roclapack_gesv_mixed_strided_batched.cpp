@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv_mixed.hpp"
+#include "handle.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_mixed_strided_batched_impl(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                         U A, const rocblas_int lda, const rocblas_stride strideA,
+                                         rocblas_int *ipiv, const rocblas_stride strideP,
+                                         U B, const rocblas_int ldb, const rocblas_stride strideB,
+                                         U X, const rocblas_int ldx, const rocblas_stride strideX,
+                                         rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count)
+{
+    using S = lower_t<T>;
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // logging
+    rocsolver_logger log(handle,gesv_mixed_name<T>("sgesv_strided_batched","cgesv_strided_batched"),rocsolver_precision<T>());
+    log.arg("n",n,"sizem").arg("nrhs",nrhs,"sizen").arg("A",A).arg("lda",lda,"lda")
+       .arg("strideA",strideA,"bsa").arg("ipiv",ipiv).arg("strideP",strideP,"bsp").arg("B",B).arg("ldb",ldb,"ldb")
+       .arg("strideB",strideB,"bsb").arg("X",X).arg("ldx",ldx,"ldc").arg("strideX",strideX,"bsc").arg("iter",iter).arg("info",info)
+       .arg("batch_count",batch_count,"batch").start();
+
+    // argument checking
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!A || !ipiv || !B || !X || !iter || !info)
+        return rocblas_status_invalid_pointer;
+
+    // block size selection (only when autotuning is enabled)
+    rocsolver_getrf_autotune<S>(handle,n,n,batch_count);
+
+    // memory managment
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
+    size_t size_2;
+    size_t size_3;
+    size_t size_4;  //size of arrays of pointers (for batched cases)
+    size_t size_5;  //partial results of the pivot search
+    size_t size_6;
+    size_t size_7;  //matrices and solutions in lower precision
+    size_t size_8;  //residuals
+    size_t size_9;  //thresholds of the residuals
+    size_t size_10; //state of the refinement, and counters
+    size_t size_11; //pivots of the systems that fall back to the working precision
+    size_t size_12; //arrays of pointers to their matrices and solutions
+    rocsolver_gesv_mixed_getMemorySize<false,T>(handle,n,nrhs,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6,
+                                                &size_7,&size_8,&size_9,&size_10,&size_11,&size_12);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4,size_5,size_6,
+                                                        size_7,size_8,size_9,size_10,size_11,size_12);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,gesv_mixed_name<T>("dsgesv_strided_batched","zcgesv_strided_batched"),size_2,size_3,size_4,size_5,size_6,
+                                size_7,size_8,size_9,size_10,size_11,size_12);
+    if (!mem)
+        return rocblas_status_memory_error;
+    void *pivotGPU = mem[0], *iinfo = mem[1], *workArr = mem[2], *pivotVal = mem[3], *pivotIdx = mem[4];
+    void *swork = mem[5], *R = mem[6], *cte = mem[7], *flags = mem[8], *ipivW = mem[9], *ptrs = mem[10];
+
+    // scalars constants for rocblas functions calls
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    S *scalarsS = rocsolver_get_constants<S>(handle);
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalarsS || !scalars)
+        return rocblas_status_memory_error;
+
+    // execution
+    return rocsolver_gesv_mixed_template<false,true,T>(handle,n,nrhs,
+                                                        A,0,lda,strideA,
+                                                        ipiv,strideP,
+                                                        B,0,ldb,strideB,
+                                                        X,0,ldx,strideX,
+                                                        iter,info,batch_count,
+                                                        scalarsS,scalars,
+                                                        pivotGPU,
+                                                        (rocblas_int*)iinfo,
+                                                        (void**)workArr,
+                                                        pivotVal,
+                                                        (rocblas_int*)pivotIdx,
+                                                        (S*)swork,
+                                                        (T*)R,
+                                                        (real_t<T>*)cte,
+                                                        (rocblas_int*)flags,
+                                                        (rocblas_int*)ipivW,
+                                                        (T**)ptrs);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsgesv_strided_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 double *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+                 double *B, const rocblas_int ldb, const rocblas_stride strideB, double *X, const rocblas_int ldx, const rocblas_stride strideX,
+                 rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_mixed_strided_batched_impl<double>(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, X, ldx, strideX, iter, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zcgesv_strided_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_double_complex *X, const rocblas_int ldx, const rocblas_stride strideX,
+                 rocblas_int *iter, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_mixed_strided_batched_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, X, ldx, strideX, iter, info, batch_count);
+}
+
+} //extern C
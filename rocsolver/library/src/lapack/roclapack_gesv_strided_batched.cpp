@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv.hpp"
+#include "handle.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_strided_batched_impl(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                   U A, const rocblas_int lda, const rocblas_stride strideA,
+                                   rocblas_int *ipiv, const rocblas_stride strideP,
+                                   U B, const rocblas_int ldb, const rocblas_stride strideB,
+                                   rocblas_int* info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // logging
+    rocsolver_logger log(handle,"gesv_strided_batched",rocsolver_precision<T>());
+    log.arg("n",n,"sizem").arg("nrhs",nrhs,"sizen").arg("A",A).arg("lda",lda,"lda")
+       .arg("strideA",strideA,"bsa").arg("ipiv",ipiv).arg("strideP",strideP,"bsp").arg("B",B).arg("ldb",ldb,"ldb")
+       .arg("strideB",strideB,"bsb").arg("info",info).arg("batch_count",batch_count,"batch").start();
+
+    // argument checking
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!A || !ipiv || !B || !info)
+        return rocblas_status_invalid_pointer;
+
+    // block size selection (only when autotuning is enabled)
+    if (n > GESV_SMALL_MAXSIZE)
+        rocsolver_getrf_autotune<T>(handle,n,n,batch_count);
+
+    // memory managment
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
+    size_t size_2;
+    size_t size_3;
+    size_t size_4;  //size of arrays of pointers (for batched cases)
+    size_t size_5;  //partial results of the pivot search
+    size_t size_6;
+    size_t size_7;  //copy of the right hand sides of the singular systems
+    rocsolver_gesv_getMemorySize<false,T>(handle,n,nrhs,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6,&size_7);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4,size_5,size_6,size_7);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"gesv_strided_batched",size_2,size_3,size_4,size_5,size_6,size_7);
+    if (!mem)
+        return rocblas_status_memory_error;
+    void *pivotGPU = mem[0], *iinfo = mem[1], *workArr = mem[2], *pivotVal = mem[3], *pivotIdx = mem[4], *keepB = mem[5];
+
+    // scalars constants for rocblas functions calls
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
+
+    // execution
+    return rocsolver_gesv_template<false,true,T>(handle,n,nrhs,
+                                                  A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                  lda,strideA,
+                                                  ipiv,strideP,
+                                                  B,0,
+                                                  ldb,strideB,
+                                                  info,batch_count,
+                                                  (T*)scalars,
+                                                  (T*)pivotGPU,
+                                                  (rocblas_int*)iinfo,
+                                                  (T**)workArr,
+                                                  (real_t<T>*)pivotVal,
+                                                  (rocblas_int*)pivotIdx,
+                                                  (T*)keepB);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_strided_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 float *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+                 float *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_strided_batched_impl<float>(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_strided_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 double *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+                 double *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_strided_batched_impl<double>(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_strided_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_float_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_strided_batched_impl<rocblas_float_complex>(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_strided_batched(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count)
+{
+    return rocsolver_gesv_strided_batched_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+}
+
+} //extern C
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getf2.hpp"
+#include "handle.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
@@ -12,7 +13,10 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
     if(!handle)
         return rocblas_status_invalid_handle;
     
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"getf2",rocsolver_precision<T>());
+    log.arg("m",m,"sizem").arg("n",n,"sizen").arg("A",A).arg("lda",lda,"lda").arg("ipiv",ipiv)
+       .arg("info",info).start();
     
     // argument checking
     if (!A || !ipiv || !info)
@@ -25,24 +29,26 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_int batch_count = 1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //pivots
-    rocsolver_getf2_getMemorySize<T>(batch_count,&size_1,&size_2);
+    size_t size_3;  //partial results of the pivot search
+    size_t size_4;
+    rocsolver_getf2_getMemorySize<T>(m,batch_count,&size_1,&size_2,&size_3,&size_4);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *pivotGPU;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&pivotGPU,size_2);
-    if (!scalars || (size_2 && !pivotGPU))
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"getf2",size_2,size_3,size_4);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *pivotGPU = mem[0], *pivotVal = mem[1], *pivotIdx = mem[2];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -53,10 +59,10 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle, const rocblas_int m,
                                         strideP,
                                         info,batch_count,
                                         (T*)scalars,
-                                        (T*)pivotGPU);
+                                        (T*)pivotGPU,
+                                        (real_t<T>*)pivotVal,
+                                        (rocblas_int*)pivotIdx);
 
-    hipFree(scalars);
-    hipFree(pivotGPU);
     return status;    
 }
 
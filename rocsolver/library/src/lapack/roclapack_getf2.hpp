@@ -16,37 +16,240 @@
 #include "common_device.hpp"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
+// magnitude used to choose the pivots (|Re| + |Im| as in BLAS iamax)
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ __host__ inline T getf2_abs(const T x)
+{
+    return x < 0 ? -x : x;
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ __host__ inline real_t<T> getf2_abs(const T x)
+{
+    return getf2_abs(x.real()) + getf2_abs(x.imag());
+}
+
+// keeps in (val,idx) the candidate of largest magnitude. Ties are resolved in favor
+// of the smallest index, so that the result is the same as with BLAS iamax.
+// NaN is larger than any other magnitude, thus a column with NaNs still gets a pivot
+// among its own rows.
+template <typename S>
+__device__ inline void getf2_iamax_update(S &val, rocblas_int &idx, const S v, const rocblas_int i)
+{
+    bool vnan = v != v;
+    bool valnan = val != val;
+    if ((vnan && !valnan) || v > val || ((v == val || (vnan && valnan)) && i < idx)) {
+        val = v;
+        idx = i;
+    }
+}
+
+// reduces the candidates of all the threads in the work-group; the result is left in thread 0.
+// (warp-shuffle reduction within every wavefront, then the partial results go through LDS)
+template <typename S>
+__device__ void getf2_iamax_reduce(S &val, rocblas_int &idx)
+{
+    __shared__ S sval[GETF2_BLOCKSIZE / GETF2_MIN_WAVESIZE];
+    __shared__ rocblas_int sidx[GETF2_BLOCKSIZE / GETF2_MIN_WAVESIZE];
+
+    int tid = hipThreadIdx_x;
+    int lane = tid % warpSize;
+    int wave = tid / warpSize;
+    int nwaves = (hipBlockDim_x - 1) / warpSize + 1;
+
+    for (int offset = warpSize / 2; offset > 0; offset /= 2)
+        getf2_iamax_update(val, idx, __shfl_down(val, offset), __shfl_down(idx, offset));
+
+    if (lane == 0) {
+        sval[wave] = val;
+        sidx[wave] = idx;
+    }
+    __syncthreads();
+
+    if (tid == 0) {
+        for (int w = 1; w < nwaves; ++w)
+            getf2_iamax_update(val, idx, sval[w], sidx[w]);
+    }
+}
+
+// first stage of the pivot search for tall panels: every work-group looks for
+// the candidate of largest magnitude in its chunk of column j and stores it in (pval,pidx)
+template <typename T, typename U, typename S>
+__global__ void getf2_iamax_partial(const rocblas_int m, U A, const rocblas_int shiftA, const rocblas_int lda,
+                                    const rocblas_stride strideA, const rocblas_int j,
+                                    S *pval, rocblas_int *pidx)
+{
+    int b = hipBlockIdx_y;
+    int blk = hipBlockIdx_x;
+    int nblk = hipGridDim_x;
+
+    // column j from the diagonal downwards
+    T* x = load_ptr_batch<T>(A,b,shiftA + j + j*lda,strideA);
+
+    // (the threads without candidates keep the first row of the column)
+    S val = -1;
+    rocblas_int idx = 0;
+    for (rocblas_int i = blk * hipBlockDim_x + hipThreadIdx_x; i < m - j; i += nblk * hipBlockDim_x)
+        getf2_iamax_update(val, idx, getf2_abs(x[i]), i);
+
+    getf2_iamax_reduce(val, idx);
+
+    if (hipThreadIdx_x == 0) {
+        pval[b * nblk + blk] = val;
+        pidx[b * nblk + blk] = idx;
+    }
+}
+
+// pivot search for column j, with one work-group per matrix in the batch. If nblk > 1,
+// the candidates found by getf2_iamax_partial are reduced; otherwise the whole column is searched.
+// The (1-based) pivot index is written in ipiv, the inverse of the pivot in invpivot, and
+// info is set if the pivot is zero.
+template <typename T, typename U, typename S>
+__global__ void getf2_iamax(const rocblas_int m, U A, const rocblas_int shiftA, const rocblas_int lda,
+                            const rocblas_stride strideA, rocblas_int* ipivA, const rocblas_int shiftP,
+                            const rocblas_stride strideP, const rocblas_int j, const rocblas_int nblk,
+                            S *pval, rocblas_int *pidx, T* invpivot, rocblas_int* info)
+{
+    int b = hipBlockIdx_x;
+
+    T* x = load_ptr_batch<T>(A,b,shiftA + j + j*lda,strideA);
+    rocblas_int *ipiv = ipivA + b*strideP + shiftP;
+
+    // (the threads without candidates keep the first row of the column)
+    S val = -1;
+    rocblas_int idx = 0;
+    if (nblk > 1) {
+        for (rocblas_int i = hipThreadIdx_x; i < nblk; i += hipBlockDim_x)
+            getf2_iamax_update(val, idx, pval[b * nblk + i], pidx[b * nblk + i]);
+    } else {
+        for (rocblas_int i = hipThreadIdx_x; i < m - j; i += hipBlockDim_x)
+            getf2_iamax_update(val, idx, getf2_abs(x[i]), i);
+    }
+
+    getf2_iamax_reduce(val, idx);
+
+    if (hipThreadIdx_x == 0) {
+        ipiv[j] = j + idx + 1;  //use Fortran 1-based indexing
+        T pivot = x[idx];
+        if (pivot == 0) {
+            invpivot[b] = 1;
+            if (info[b] == 0)
+               info[b] = j + 1;   //use Fortran 1-based indexing
+        }
+        else
+            invpivot[b] = 1 / pivot;
+    }
+}
+
+// LU factorization of a whole m-by-n panel by a single work-group per matrix.
+// The panel is kept in LDS, thus pivot search, row interchanges, scaling and
+// rank-1 updates of all the columns are done in one launch.
 template <typename T, typename U>
-__global__ void getf2_check_singularity(U AA, const rocblas_int shiftA, const rocblas_stride strideA,
-                                        rocblas_int* ipivA, const rocblas_int shiftP,
-                                        const rocblas_stride strideP, const rocblas_int j,
-                                        const rocblas_int lda,
-                                        T* invpivot, rocblas_int* info)
+__global__ void getf2_panel(const rocblas_int m, const rocblas_int n, U A, const rocblas_int shiftA,
+                            const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipivA,
+                            const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info)
 {
-    int id = hipBlockIdx_x;
+    using S = real_t<T>;
+    int b = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+    int nthr = hipBlockDim_x;
+
+    T* M = load_ptr_batch<T>(A,b,shiftA,strideA);
+    rocblas_int *ipiv = ipivA + b*strideP + shiftP;
+
+    // the panel is stored in LDS with leading dimension m
+    HIP_DYNAMIC_SHARED(char, lmem);
+    T* P = reinterpret_cast<T*>(lmem);
+    __shared__ rocblas_int piv;
+    __shared__ T invpivot;
+
+    for (rocblas_int k = tid; k < m * n; k += nthr)
+        P[k] = M[(k % m) + (k / m) * lda];
+    __syncthreads();
+
+    rocblas_int dim = min(m, n);
+    rocblas_int iinfo = 0;
+    for (rocblas_int j = 0; j < dim; ++j) {
+        T* x = P + j + j*m;
+
+        // find pivot and check singularity
+        // (the threads without candidates keep the first row of the column)
+        S val = -1;
+        rocblas_int idx = 0;
+        for (rocblas_int i = tid; i < m - j; i += nthr)
+            getf2_iamax_update(val, idx, getf2_abs(x[i]), i);
+        getf2_iamax_reduce(val, idx);
+
+        if (tid == 0) {
+            piv = j + idx;
+            ipiv[j] = piv + 1;  //use Fortran 1-based indexing
+            if (x[idx] == 0) {
+                invpivot = 1;
+                if (iinfo == 0)
+                    iinfo = j + 1;   //use Fortran 1-based indexing
+            }
+            else
+                invpivot = 1 / x[idx];
+        }
+        __syncthreads();
 
-    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
-    rocblas_int *ipiv = ipivA + id*strideP + shiftP;
+        // swap pivot row and j-th row
+        if (piv != j) {
+            for (rocblas_int k = tid; k < n; k += nthr) {
+                T temp = P[j + k*m];
+                P[j + k*m] = P[piv + k*m];
+                P[piv + k*m] = temp;
+            }
+        }
+        __syncthreads();
+
+        // compute elements j+1:m of j-th column
+        for (rocblas_int i = j + 1 + tid; i < m; i += nthr)
+            P[i + j*m] *= invpivot;
+        __syncthreads();
 
-    ipiv[j] += j;           //update the pivot index
-    if (A[j * lda + ipiv[j] - 1] == 0) {
-        invpivot[id] = 1.0;
-        if (info[id] == 0)
-           info[id] = j + 1;   //use Fortran 1-based indexing
+        // update trailing submatrix
+        rocblas_int mm = m - j - 1;
+        for (rocblas_int k = tid; k < mm * (n - j - 1); k += nthr) {
+            rocblas_int r = j + 1 + k % mm;
+            rocblas_int c = j + 1 + k / mm;
+            P[r + c*m] -= P[r + j*m] * P[j + c*m];
+        }
+        __syncthreads();
     }
-    else
-        invpivot[id] = 1.0 / A[j * lda + ipiv[j] - 1];
+
+    for (rocblas_int k = tid; k < m * n; k += nthr)
+        M[(k % m) + (k / m) * lda] = P[k];
+
+    if (tid == 0)
+        info[b] = iinfo;
+}
+
+// number of work-groups searching for the pivot of a column with mj entries
+inline rocblas_int getf2_iamax_blocks(const rocblas_int mj)
+{
+    return min((mj - 1) / GETF2_IAMAX_CHUNKSIZE + 1, GETF2_IAMAX_MAXBLOCKS);
 }
 
 template <typename T>
-void rocsolver_getf2_getMemorySize(const rocblas_int batch_count,
-                                  size_t *size_1, size_t *size_2)
+void rocsolver_getf2_getMemorySize(const rocblas_int m, const rocblas_int batch_count,
+                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
 {
     // for scalars
     *size_1 = sizeof(T)*3;
 
     // for pivots
     *size_2 = sizeof(T)*batch_count;
+
+    // for the partial results of the pivot search (only with tall panels)
+    rocblas_int nblk = getf2_iamax_blocks(m);
+    if (nblk > 1) {
+        *size_3 = sizeof(real_t<T>)*nblk*batch_count;
+        *size_4 = sizeof(rocblas_int)*nblk*batch_count;
+    } else {
+        *size_3 = 0;
+        *size_4 = 0;
+    }
 }
 
 
@@ -55,11 +258,13 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, 
                                         const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP, 
                                         const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count,
-                                        T* scalars, T* pivotGPU)
+                                        T* scalars, T* pivotGPU, real_t<T>* pivotVal, rocblas_int* pivotIdx)
 {
     // quick return
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
+
+    ROCSOLVER_PHASE(handle, "getf2");
         
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
@@ -69,39 +274,35 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
     rocblas_get_pointer_mode(handle,&old_mode);
     rocblas_set_pointer_mode(handle,rocblas_pointer_mode_device);    
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      IAMAX_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
-
     rocblas_int blocksReset = (batch_count - 1) / GETF2_BLOCKSIZE + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(GETF2_BLOCKSIZE, 1, 1);
     rocblas_int dim = min(m, n);    //total number of pivots
-    T* M;
+    rocblas_int nblk;
+
+    // if the panel fits in LDS, factorize it with a single kernel launch
+    size_t lmemsize = sizeof(T) * m * n;
+    if (lmemsize <= GETF2_PANEL_LDSSIZE) {
+        ROCSOLVER_LAUNCH_KERNEL(getf2_panel<T>, dim3(batch_count), threads, lmemsize, stream,
+                       m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+
+        rocblas_set_pointer_mode(handle,old_mode);
+        return rocblas_status_success;
+    }
 
     //info=0 (starting with a nonsingular matrix)
-    hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
     
 
-    // **** IAMAX_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
-
     for (rocblas_int j = 0; j < dim; ++j) {
-        // find pivot. Use Fortran 1-based indexing for the ipiv array as iamax does that as well!
-        for (int b=0;b<batch_count;++b) {
-            M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-            rocblas_iamax(handle, m - j, (M + idx2D(j, j, lda)), 1, 
-                        (ipiv + shiftP + b*strideP + j));
-        }
-
-        // adjust pivot indices and check singularity
-        hipLaunchKernelGGL(getf2_check_singularity<T>, dim3(batch_count), dim3(1), 0, stream,
-                  A, shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivotGPU, info);
+        // find pivot and check singularity
+        // (tall columns are first split among several work-groups per matrix)
+        nblk = getf2_iamax_blocks(m - j);
+        if (nblk > 1)
+            ROCSOLVER_LAUNCH_KERNEL(getf2_iamax_partial<T>, dim3(nblk, batch_count), threads, 0, stream,
+                           m, A, shiftA, lda, strideA, j, pivotVal, pivotIdx);
+        ROCSOLVER_LAUNCH_KERNEL(getf2_iamax<T>, dim3(batch_count), threads, 0, stream,
+                       m, A, shiftA, lda, strideA, ipiv, shiftP, strideP, j, nblk, pivotVal, pivotIdx, pivotGPU, info);
 
         // Swap pivot row and j-th row 
         rocsolver_laswp_template<T>(handle, n, A, shiftA, lda, strideA, j+1, j+1, ipiv, shiftP, strideP, 1, batch_count);
@@ -14,6 +14,8 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "tuning.hpp"
+#include "autotune.hpp"
 #include "roclapack_getf2.hpp"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
@@ -33,15 +35,240 @@ __global__ void getrf_check_singularity(const rocblas_int n, const rocblas_int j
         ipiv[tid] += j;
 }
 
-template <typename T>
-void rocsolver_getrf_getMemorySize(const rocblas_int n, const rocblas_int m, const rocblas_int batch_count,
-                                  size_t *size_1, size_t *size_2, size_t *size_3)
+// LU factorization of a tiny m-by-n matrix (at most GETRF_SMALL_MAXSIZE rows and DIM columns)
+// held by a work-group. Every thread keeps a row of the matrix in rA; only the pivot row goes
+// through LDS, thus the whole factorization is done in one pass. The pivots are written to ipiv
+// (by thread 0) and the first zero pivot is returned (to all the threads).
+template <int DIM, typename T>
+__device__ rocblas_int getrf_small_factor(const rocblas_int m, const rocblas_int n, T *rA, rocblas_int *ipiv)
+{
+    using S = real_t<T>;
+    int tid = hipThreadIdx_x;   //row owned by this thread
+
+    __shared__ T prow[DIM];     //pivot row
+    __shared__ T jrow[DIM];     //row j before the interchange
+    __shared__ rocblas_int piv;
+
+    rocblas_int dim = min(m, n);
+    rocblas_int iinfo = 0;
+
+    #pragma unroll
+    for (int j = 0; j < DIM; ++j) {
+        if (j < dim) {
+            // find pivot
+            // (the threads without candidates keep row j)
+            S val = -1;
+            rocblas_int idx = j;
+            if (tid >= j && tid < m) {
+                val = getf2_abs(rA[j]);
+                idx = tid;
+            }
+            getf2_iamax_reduce(val, idx);
+
+            if (tid == 0) {
+                piv = idx;
+                ipiv[j] = idx + 1;  //use Fortran 1-based indexing
+            }
+            __syncthreads();
+
+            // swap pivot row and j-th row
+            if (tid == piv) {
+                #pragma unroll
+                for (int k = 0; k < DIM; ++k)
+                    prow[k] = rA[k];
+            }
+            if (tid == j) {
+                #pragma unroll
+                for (int k = 0; k < DIM; ++k)
+                    jrow[k] = rA[k];
+            }
+            __syncthreads();
+
+            if (tid == j) {
+                #pragma unroll
+                for (int k = 0; k < DIM; ++k)
+                    rA[k] = prow[k];
+            } else if (tid == piv) {
+                #pragma unroll
+                for (int k = 0; k < DIM; ++k)
+                    rA[k] = jrow[k];
+            }
+
+            // check singularity, compute the multiplier and update the rest of the row
+            T pivot = prow[j];
+            if (pivot == 0) {
+                if (iinfo == 0)
+                    iinfo = j + 1;  //use Fortran 1-based indexing
+            } else if (tid > j && tid < m) {
+                rA[j] *= 1 / pivot;
+                #pragma unroll
+                for (int k = j + 1; k < DIM; ++k)
+                    rA[k] -= rA[j] * prow[k];
+            }
+            __syncthreads();
+        }
+    }
+
+    return iinfo;
+}
+
+// LU factorization of tiny matrices (at most GETRF_SMALL_MAXSIZE rows and DIM columns)
+// with one work-group per matrix.
+template <int DIM, typename T, typename U>
+__global__ void getrf_small(const rocblas_int m, const rocblas_int n, U A, const rocblas_int shiftA,
+                            const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipivA,
+                            const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info)
 {
-    rocsolver_getf2_getMemorySize<T>(batch_count,size_1,size_2);
-    if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) {
+    int b = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;   //row owned by this thread
+
+    T* M = load_ptr_batch<T>(A,b,shiftA,strideA);
+    rocblas_int *ipiv = ipivA + b*strideP + shiftP;
+
+    T rA[DIM];
+    #pragma unroll
+    for (int k = 0; k < DIM; ++k)
+        rA[k] = (tid < m && k < n) ? M[tid + k*lda] : 0;
+
+    rocblas_int iinfo = getrf_small_factor<DIM>(m, n, rA, ipiv);
+
+    if (tid < m) {
+        #pragma unroll
+        for (int k = 0; k < DIM; ++k) {
+            if (k < n)
+                M[tid + k*lda] = rA[k];
+        }
+    }
+
+    if (tid == 0)
+        info[b] = iinfo;
+}
+
+template <typename T, typename U>
+void rocsolver_getrf_small(hipStream_t stream, const rocblas_int m, const rocblas_int n, U A, const rocblas_int shiftA,
+                           const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipiv,
+                           const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info,
+                           const rocblas_int batch_count)
+{
+    dim3 grid(batch_count, 1, 1);
+    dim3 threads(GETRF_SMALL_MAXSIZE, 1, 1);
+
+    // the number of registers kept per thread is the smallest of {8,16,32,64} that fits n
+    // (HIP_KERNEL_NAME cannot go through ROCSOLVER_LAUNCH_KERNEL, thus the launch is counted here)
+    ROCSOLVER_COUNT_LAUNCH();
+    if (n <= 8)
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(getrf_small<8,T>), grid, threads, 0, stream,
+                           m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+    else if (n <= 16)
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(getrf_small<16,T>), grid, threads, 0, stream,
+                           m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+    else if (n <= 32)
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(getrf_small<32,T>), grid, threads, 0, stream,
+                           m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+    else
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(getrf_small<64,T>), grid, threads, 0, stream,
+                           m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+}
+
+// number of nested splits done by the recursive panel factorization of n columns
+inline rocblas_int rocsolver_rgetf2_depth(rocblas_int n, const rocblas_int cutoff)
+{
+    rocblas_int depth = 0;
+    while (n > cutoff) {
+        n -= n / 2;
+        depth++;
+    }
+    return depth;
+}
+
+// recursive LU factorization of a tall m-by-n panel (m >= n). The panel is split in
+// left and right halves, so that most of the work is done by trsm and gemm; panels of
+// at most cutoff columns are factorized with getf2.
+// (iinfo holds one info array for every recursion level below this one)
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void rocsolver_rgetf2_template(rocblas_handle handle, const rocblas_int m,
+                               const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                               rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count,
+                               T* scalars, T* pivotGPU, rocblas_int* iinfo, T** workArr,
+                               real_t<T>* pivotVal, rocblas_int* pivotIdx, const rocblas_int cutoff)
+{
+    if (n <= cutoff) {
+        rocsolver_getf2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, scalars, pivotGPU, pivotVal, pivotIdx);
+        return;
+    }
+
+    ROCSOLVER_PHASE(handle, "rgetf2");
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    //constants to use when calling rocablas functions
+    T one = 1;                    //constant 1 in host
+    T minone = -1;                //constant -1 in host
+
+    rocblas_int n1 = n / 2;
+    rocblas_int n2 = n - n1;
+    dim3 threads(GETF2_BLOCKSIZE, 1, 1);
+    dim3 gridPivot((n2 - 1) / GETF2_BLOCKSIZE + 1, batch_count, 1);
+
+    // factorize left half
+    rocsolver_rgetf2_template<BATCHED,STRIDED,T>(handle, m, n1, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+                                                 scalars, pivotGPU, iinfo + batch_count, workArr, pivotVal, pivotIdx, cutoff);
+
+    // apply interchanges to right half
+    rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, n1, lda), lda, strideA, 1, n1, ipiv, shiftP, strideP, 1, batch_count);
+
+    // compute A12 and update A22
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle,&old_mode);
+    rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
+
+    rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                        rocblas_diagonal_unit, n1, n2, &one,
+                        A, shiftA, lda, strideA,
+                        A, shiftA + idx2D(0, n1, lda), lda, strideA, batch_count, workArr);
+
+    rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                        m - n1, n2, n1, &minone,
+                                        A, shiftA + idx2D(n1, 0, lda), lda, strideA,
+                                        A, shiftA + idx2D(0, n1, lda), lda, strideA, &one,
+                                        A, shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count, nullptr);
+
+    rocblas_set_pointer_mode(handle,old_mode);
+
+    // factorize right half
+    rocsolver_rgetf2_template<BATCHED,STRIDED,T>(handle, m - n1, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA, ipiv, shiftP + n1, strideP, iinfo, batch_count,
+                                                 scalars, pivotGPU, iinfo + batch_count, workArr, pivotVal, pivotIdx, cutoff);
+
+    // adjust pivot indices and check singularity
+    ROCSOLVER_LAUNCH_KERNEL(getrf_check_singularity<U>,gridPivot,threads,0,stream,
+                            n2,n1,ipiv,shiftP + n1,strideP,iinfo,info);
+
+    // apply interchanges to left half
+    rocsolver_laswp_template<T>(handle, n1, A, shiftA, lda, strideA, n1 + 1, n, ipiv, shiftP, strideP, 1, batch_count);
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_getrf_getMemorySize(rocblas_handle handle, const rocblas_int m, const rocblas_int n, const rocblas_int batch_count,
+                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4,
+                                  size_t *size_5, size_t *size_6)
+{
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_getrf_blocksize, min(m, n), batch_count);
+    rocblas_int cutoff = rocsolver_get_tuning<T>(handle, tuning_getrf_rgetf2_cutoff, min(m, n), batch_count);
+
+    rocsolver_getf2_getMemorySize<T>(m,batch_count,size_1,size_2,size_5,size_6);
+    if (m < nb || n < nb) {
         *size_3 = 0;
+        *size_4 = 0;
     } else {
-        *size_3 = sizeof(rocblas_int)*batch_count;
+        // (one info array for the panel and one for every level of the recursive panel factorization)
+        *size_3 = sizeof(rocblas_int)*batch_count*(1 + rocsolver_rgetf2_depth(nb, cutoff));
+
+        // size of arrays of pointers (for batched trsm)
+        if (BATCHED)
+            *size_4 = 2*sizeof(T*)*batch_count;
+        else
+            *size_4 = 0;
     }
 }
 
@@ -49,33 +276,37 @@ template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int m,
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
                                         rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count,
-                                        T* scalars, T* pivotGPU, rocblas_int* iinfo)
+                                        T* scalars, T* pivotGPU, rocblas_int* iinfo, T** workArr,
+                                        real_t<T>* pivotVal, rocblas_int* pivotIdx)
 {
     // quick return
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "getrf");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // tiny matrices are factorized in one pass, with one work-group per matrix
+    if (m <= GETRF_SMALL_MAXSIZE && n <= GETRF_SMALL_MAXSIZE) {
+        rocsolver_getrf_small<T>(stream, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle,&old_mode);
     rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
 
+    // block size and recursion cutoff (the same as in the memory size query)
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_getrf_blocksize, min(m, n), batch_count);
+    rocblas_int cutoff = rocsolver_get_tuning<T>(handle, tuning_getrf_rgetf2_cutoff, min(m, n), batch_count);
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the algorithm
-    if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) 
-        return rocsolver_getf2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, scalars, pivotGPU);
-
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
-    
+    if (m < nb || n < nb) 
+        return rocsolver_getf2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, scalars, pivotGPU, pivotVal, pivotIdx);
+
     //constants to use when calling rocablas functions
     T one = 1;                    //constant 1 in host
     T minone = -1;                //constant -1 in host
@@ -86,26 +317,27 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(GETF2_BLOCKSIZE, 1, 1);
     rocblas_int dim = min(m, n);    //total number of pivots
-    T* M;
     rocblas_int jb, sizePivot;
 
     //info=0 (starting with a nonsingular matrix)
-    hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
-
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
+    ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
 
-    for (rocblas_int j = 0; j < dim; j += GETRF_GETF2_SWITCHSIZE) {
+    for (rocblas_int j = 0; j < dim; j += nb) {
         // Factor diagonal and subdiagonal blocks 
-        jb = min(dim - j, GETRF_GETF2_SWITCHSIZE);  //number of columns in the block
-        hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
-        rocsolver_getf2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j, strideP, iinfo, batch_count, scalars, pivotGPU);
+        jb = min(dim - j, nb);  //number of columns in the block
+        ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
+        // (tall panels that do not fit in LDS are factorized recursively)
+        if (sizeof(T) * (m - j) * jb > GETF2_PANEL_LDSSIZE)
+            rocsolver_rgetf2_template<BATCHED,STRIDED,T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j, strideP, iinfo, batch_count,
+                                                         scalars, pivotGPU, iinfo + batch_count, workArr, pivotVal, pivotIdx, cutoff);
+        else
+            rocsolver_getf2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j, strideP, iinfo, batch_count, scalars, pivotGPU, pivotVal, pivotIdx);
         
         // adjust pivot indices and check singularity
         sizePivot = min(m - j, jb);     //number of pivots in the block
         blocksPivot = (sizePivot - 1) / GETF2_BLOCKSIZE + 1; 
         gridPivot = dim3(blocksPivot, batch_count, 1);
-        hipLaunchKernelGGL(getrf_check_singularity<U>,gridPivot,threads,0,stream,
+        ROCSOLVER_LAUNCH_KERNEL(getrf_check_singularity<U>,gridPivot,threads,0,stream,
 			   sizePivot,j,ipiv,shiftP + j,strideP,iinfo,info);
 
         // apply interchanges to columns 1 : j-1
@@ -118,12 +350,10 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
                                   ipiv, shiftP, strideP, 1, batch_count);
 
             // compute block row of U
-            for (int b=0;b<batch_count;++b) {
-                M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                rocblas_trsm(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
-                             rocblas_diagonal_unit, jb, (n - j - jb), &one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j, j + jb, lda)), lda);
-            }
+            rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                                rocblas_diagonal_unit, jb, (n - j - jb), &one,
+                                A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, workArr);
 
             // update trailing submatrix
             if (j + jb < m) {
@@ -140,5 +370,41 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
     return rocblas_status_success;
 }
 
+// chooses the block size for the given problem if autotuning is enabled and
+// there is no value for it yet (see autotune.hpp)
+template <typename T>
+void rocsolver_getrf_autotune(rocblas_handle handle, const rocblas_int m, const rocblas_int n, const rocblas_int batch_count)
+{
+    // (tiny matrices do not use the block size)
+    if (m <= GETRF_SMALL_MAXSIZE && n <= GETRF_SMALL_MAXSIZE)
+        return;
+    if (!rocsolver_autotune_wanted(handle, tuning_getrf_blocksize, rocsolver_precision<T>(), min(m, n), batch_count))
+        return;
+
+    rocsolver_autotune_scratch<T> scratch(m, n, batch_count);
+    if (!scratch)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    auto run = [&]() {
+        size_t size_1, size_2, size_3, size_4, size_5, size_6;
+        rocsolver_getrf_getMemorySize<false,T>(handle,m,n,scratch.batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
+
+        rocsolver_device_malloc mem(handle,"getrf_autotune",size_2,size_3,size_4,size_5,size_6);
+        T *scalars = rocsolver_get_constants<T>(handle);
+        if (!mem || !scalars)
+            return rocblas_status_memory_error;
+
+        scratch.init(stream);
+        return rocsolver_getrf_template<false,true,T>(handle,m,n,scratch.A,0,scratch.lda,scratch.strideA,
+                                                      scratch.ipiv,0,scratch.strideP,scratch.info,scratch.batch_count,
+                                                      scalars,(T*)mem[0],(rocblas_int*)mem[1],(T**)mem[2],
+                                                      (real_t<T>*)mem[3],(rocblas_int*)mem[4]);
+    };
+    rocsolver_autotune<T>(handle, tuning_getrf_blocksize, min(m, n), batch_count, {32, 64, 128, 256}, run);
+}
+
 
 #endif /* ROCLAPACK_GETRF_HPP */
@@ -2,8 +2,8 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getrf.hpp"
+#include "handle.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle, rocblas_int m,
@@ -12,7 +12,10 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle, rocblas_int m
     if(!handle)
         return rocblas_status_invalid_handle;
     
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"getrf_batched",rocsolver_precision<T>());
+    log.arg("m",m,"sizem").arg("n",n,"sizen").arg("A",A).arg("lda",lda,"lda").arg("ipiv",ipiv)
+       .arg("strideP",strideP,"bsp").arg("info",info).arg("batch_count",batch_count,"batch").start();
 
     // argument checking
     if (m < 0 || n < 0 || batch_count < 0 || lda < m) 
@@ -22,27 +25,32 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle, rocblas_int m
 
     rocblas_stride strideA = 0;
 
+    // block size selection (only when autotuning is enabled)
+    rocsolver_getrf_autotune<T>(handle,m,n,batch_count);
+
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;
     size_t size_3;
-    rocsolver_getrf_getMemorySize<T>(m,n,batch_count,&size_1,&size_2,&size_3);
-
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *pivotGPU, *iinfo;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&pivotGPU,size_2);
-    hipMalloc(&iinfo,size_3);
-    if (!scalars || (size_2 && !pivotGPU) || (size_3 && !iinfo))
+    size_t size_4;  //size of arrays of pointers (for batched cases)
+    size_t size_5;  //partial results of the pivot search
+    size_t size_6;
+    rocsolver_getrf_getMemorySize<true,T>(handle,m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4,size_5,size_6);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"getrf_batched",size_2,size_3,size_4,size_5,size_6);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *pivotGPU = mem[0], *iinfo = mem[1], *workArr = mem[2], *pivotVal = mem[3], *pivotIdx = mem[4];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -54,11 +62,11 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle, rocblas_int m
                                                     info,batch_count,
                                                     (T*)scalars,
                                                     (T*)pivotGPU,
-                                                    (rocblas_int*)iinfo);
+                                                    (rocblas_int*)iinfo,
+                                                    (T**)workArr,
+                                                    (real_t<T>*)pivotVal,
+                                                    (rocblas_int*)pivotIdx);
 
-    hipFree(scalars);
-    hipFree(pivotGPU);
-    hipFree(iinfo);
     return status;
 }
 
@@ -96,5 +104,3 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched(rocblas_handle handle,
 }
 
 } //extern C
-
-#undef batched
@@ -0,0 +1,246 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf.hpp"
+#include "plan.hpp"
+
+template <bool BATCHED, typename T>
+rocblas_status rocsolver_getrf_plan_create_impl(rocblas_handle handle, const char *routine, const rocblas_int m,
+                                                const rocblas_int n, const rocblas_int lda, const rocblas_stride strideA,
+                                                const rocblas_stride strideP, const rocblas_int batch_count,
+                                                rocsolver_plan *plan)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if (m < 0 || n < 0 || batch_count < 0 || lda < m)
+        return rocblas_status_invalid_size;
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+
+    // block size selection (only when autotuning is enabled)
+    rocsolver_getrf_autotune<T>(handle,m,n,batch_count);
+
+    // memory managment
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
+    size_t size_2;
+    size_t size_3;
+    size_t size_4;  //size of arrays of pointers (for batched cases)
+    size_t size_5;  //partial results of the pivot search
+    size_t size_6;
+    rocsolver_getrf_getMemorySize<BATCHED,T>(handle,m,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5,&size_6);
+
+    std::unique_ptr<_rocsolver_plan> p(new _rocsolver_plan(handle,routine,rocsolver_precision<T>()));
+    p->m = m;
+    p->n = n;
+    p->lda = lda;
+    p->strideA = strideA;
+    p->strideP = strideP;
+    p->batch_count = batch_count;
+
+    // tuning values and memory allocation (the workspace is owned by the plan)
+    if (!rocsolver_plan_prepare(p.get(),min(m,n),size_2,size_3,size_4,size_5,size_6))
+        return rocblas_status_memory_error;
+
+    // scalars constants for rocblas functions calls
+    p->scalars = rocsolver_get_constants<T>(handle);
+    if (!p->scalars)
+        return rocblas_status_memory_error;
+
+    *plan = p.release();
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_getrf_plan_execute_impl(rocsolver_plan plan, const char *routine, U A,
+                                                 rocblas_int *ipiv, rocblas_int* info)
+{
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+    if (!plan->is(routine,rocsolver_precision<T>()))
+        return rocblas_status_invalid_value;
+
+    // logging (as a call to the routine)
+    rocsolver_logger log(plan->handle,plan->log,routine,rocsolver_precision<T>());
+    log.arg("m",plan->m,"sizem").arg("n",plan->n,"sizen").arg("A",A).arg("lda",plan->lda,"lda");
+    if (STRIDED)
+        log.arg("strideA",plan->strideA,"bsa");
+    log.arg("ipiv",ipiv);
+    if (BATCHED || STRIDED)
+        log.arg("strideP",plan->strideP,"bsp");
+    log.arg("info",info);
+    if (BATCHED || STRIDED)
+        log.arg("batch_count",plan->batch_count,"batch");
+    log.start();
+
+    // argument checking
+    if (!A || !ipiv || !info)
+        return rocblas_status_invalid_pointer;
+
+    // execution (with the tuning values of the plan), or replay of its graph
+    rocsolver_plan_scope scope(plan);
+    void **buf = plan->buffers;
+    return rocsolver_plan_run(plan,{A,ipiv,info},[&] {
+        return rocsolver_getrf_template<BATCHED,STRIDED,T>(plan->handle,plan->m,plan->n,
+                                                            A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                            plan->lda,plan->strideA,
+                                                            ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
+                                                            plan->strideP,
+                                                            info,plan->batch_count,
+                                                            (T*)plan->scalars,
+                                                            (T*)buf[0],
+                                                            (rocblas_int*)buf[1],
+                                                            (T**)buf[2],
+                                                            (real_t<T>*)buf[3],
+                                                            (rocblas_int*)buf[4]);
+    });
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,float>(handle, "getrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,double>(handle, "getrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,rocblas_float_complex>(handle, "getrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,rocblas_double_complex>(handle, "getrf", m, n, lda, 0, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideP, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<true,float>(handle, "getrf_batched", m, n, lda, 0, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideP, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<true,double>(handle, "getrf_batched", m, n, lda, 0, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideP, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<true,rocblas_float_complex>(handle, "getrf_batched", m, n, lda, 0, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideP, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<true,rocblas_double_complex>(handle, "getrf_batched", m, n, lda, 0, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,float>(handle, "getrf_strided_batched", m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,double>(handle, "getrf_strided_batched", m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,rocblas_float_complex>(handle, "getrf_strided_batched", m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP, const rocblas_int batch_count,
+                 rocsolver_plan *plan)
+{
+    return rocsolver_getrf_plan_create_impl<false,rocblas_double_complex>(handle, "getrf_strided_batched", m, n, lda, strideA, strideP, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_plan_execute(rocsolver_plan plan, float *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,false,float>(plan, "getrf", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_plan_execute(rocsolver_plan plan, double *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,false,double>(plan, "getrf", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,false,rocblas_float_complex>(plan, "getrf", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,false,rocblas_double_complex>(plan, "getrf", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_batched_plan_execute(rocsolver_plan plan, float *const A[], rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<true,false,float>(plan, "getrf_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_batched_plan_execute(rocsolver_plan plan, double *const A[], rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<true,false,double>(plan, "getrf_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<true,false,rocblas_float_complex>(plan, "getrf_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<true,false,rocblas_double_complex>(plan, "getrf_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_strided_batched_plan_execute(rocsolver_plan plan, float *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,true,float>(plan, "getrf_strided_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_strided_batched_plan_execute(rocsolver_plan plan, double *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,true,double>(plan, "getrf_strided_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,true,rocblas_float_complex>(plan, "getrf_strided_batched", A, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int *ipiv, rocblas_int* info)
+{
+    return rocsolver_getrf_plan_execute_impl<false,true,rocblas_double_complex>(plan, "getrf_strided_batched", A, ipiv, info);
+}
+
+} //extern C
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getrs.hpp"
+#include "handle.hpp"
 
 template <typename T>
 rocblas_status rocsolver_getrs_impl(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
@@ -12,7 +13,10 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle, const rocblas_operati
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"getrs",rocsolver_precision<T>());
+    log.arg("trans",trans,"transposeA").arg("n",n,"sizem").arg("nrhs",nrhs,"sizen").arg("A",A)
+       .arg("lda",lda,"lda").arg("ipiv",ipiv).arg("B",B).arg("ldb",ldb,"ldb").start();
     
     // argument checking
     if (n < 0 || nrhs < 0 || lda < n || ldb < n) 
@@ -27,8 +31,17 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle, const rocblas_operati
     rocblas_int batch_count = 1;
 
     // memory managment
-    // this function does not requiere memory work space
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
+    size_t size;  //size of arrays of pointers (for batched cases)
+    rocsolver_getrs_getMemorySize<false,T>(n,nrhs,batch_count,&size);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"getrs",size);
+    if (!mem)
+        return rocblas_status_memory_error;
+    void *workArr = mem[0];
 
     return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
                                         A,0,
@@ -36,7 +49,8 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle, const rocblas_operati
                                         ipiv,strideP,
                                         B,0,
                                         ldb,strideB,
-                                        batch_count);
+                                        batch_count,
+                                        (T**)workArr);
 }
 
 
@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrs.hpp"
+#include "plan.hpp"
+
+template <bool BATCHED, typename T>
+rocblas_status rocsolver_getrs_plan_create_impl(rocblas_handle handle, const char *routine, const rocblas_operation trans,
+                                                const rocblas_int n, const rocblas_int nrhs, const rocblas_int lda,
+                                                const rocblas_stride strideA, const rocblas_stride strideP,
+                                                const rocblas_int ldb, const rocblas_stride strideB,
+                                                const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+
+    // memory managment
+    size_t size;  //size of arrays of pointers (for batched cases)
+    rocsolver_getrs_getMemorySize<BATCHED,T>(n,nrhs,batch_count,&size);
+
+    std::unique_ptr<_rocsolver_plan> p(new _rocsolver_plan(handle,routine,rocsolver_precision<T>()));
+    p->trans = trans;
+    p->n = n;
+    p->nrhs = nrhs;
+    p->lda = lda;
+    p->ldb = ldb;
+    p->strideA = strideA;
+    p->strideP = strideP;
+    p->strideB = strideB;
+    p->batch_count = batch_count;
+
+    // memory allocation (the workspace is owned by the plan)
+    if (!rocsolver_plan_prepare(p.get(),n,size))
+        return rocblas_status_memory_error;
+
+    *plan = p.release();
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_getrs_plan_execute_impl(rocsolver_plan plan, const char *routine, U A,
+                                                 const rocblas_int *ipiv, U B)
+{
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+    if (!plan->is(routine,rocsolver_precision<T>()))
+        return rocblas_status_invalid_value;
+
+    // logging (as a call to the routine)
+    rocsolver_logger log(plan->handle,plan->log,routine,rocsolver_precision<T>());
+    log.arg("trans",plan->trans,"transposeA").arg("n",plan->n,"sizem").arg("nrhs",plan->nrhs,"sizen").arg("A",A)
+       .arg("lda",plan->lda,"lda");
+    if (STRIDED)
+        log.arg("strideA",plan->strideA,"bsa");
+    log.arg("ipiv",ipiv);
+    if (BATCHED || STRIDED)
+        log.arg("strideP",plan->strideP,"bsp");
+    log.arg("B",B).arg("ldb",plan->ldb,"ldb");
+    if (STRIDED)
+        log.arg("strideB",plan->strideB,"bsb");
+    if (BATCHED || STRIDED)
+        log.arg("batch_count",plan->batch_count,"batch");
+    log.start();
+
+    // argument checking
+    if (!A || !ipiv || !B)
+        return rocblas_status_invalid_pointer;
+
+    // execution, or replay of its graph
+    void **buf = plan->buffers;
+    return rocsolver_plan_run(plan,{A,ipiv,B},[&] {
+        return rocsolver_getrs_template<T>(plan->handle,plan->trans,plan->n,plan->nrhs,
+                                            A,0,
+                                            plan->lda,plan->strideA,
+                                            ipiv,plan->strideP,
+                                            B,0,
+                                            plan->ldb,plan->strideB,
+                                            plan->batch_count,
+                                            (T**)buf[0]);
+    });
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_int ldb, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,float>(handle, "getrs", trans, n, nrhs, lda, 0, 0, ldb, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_int ldb, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,double>(handle, "getrs", trans, n, nrhs, lda, 0, 0, ldb, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_int ldb, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,rocblas_float_complex>(handle, "getrs", trans, n, nrhs, lda, 0, 0, ldb, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_int ldb, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,rocblas_double_complex>(handle, "getrs", trans, n, nrhs, lda, 0, 0, ldb, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideP, const rocblas_int ldb,
+                 const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<true,float>(handle, "getrs_batched", trans, n, nrhs, lda, 0, strideP, ldb, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideP, const rocblas_int ldb,
+                 const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<true,double>(handle, "getrs_batched", trans, n, nrhs, lda, 0, strideP, ldb, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideP, const rocblas_int ldb,
+                 const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<true,rocblas_float_complex>(handle, "getrs_batched", trans, n, nrhs, lda, 0, strideP, ldb, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideP, const rocblas_int ldb,
+                 const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<true,rocblas_double_complex>(handle, "getrs_batched", trans, n, nrhs, lda, 0, strideP, ldb, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_strided_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP,
+                 const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,float>(handle, "getrs_strided_batched", trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_strided_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP,
+                 const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,double>(handle, "getrs_strided_batched", trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_strided_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP,
+                 const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,rocblas_float_complex>(handle, "getrs_strided_batched", trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched_plan_create(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, const rocblas_int lda, const rocblas_stride strideA, const rocblas_stride strideP,
+                 const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_getrs_plan_create_impl<false,rocblas_double_complex>(handle, "getrs_strided_batched", trans, n, nrhs, lda, strideA, strideP, ldb, strideB, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_plan_execute(rocsolver_plan plan, float *A, const rocblas_int *ipiv, float *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,false,float>(plan, "getrs", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_plan_execute(rocsolver_plan plan, double *A, const rocblas_int *ipiv, double *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,false,double>(plan, "getrs", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, const rocblas_int *ipiv, rocblas_float_complex *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,false,rocblas_float_complex>(plan, "getrs", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, const rocblas_int *ipiv, rocblas_double_complex *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,false,rocblas_double_complex>(plan, "getrs", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_batched_plan_execute(rocsolver_plan plan, float *const A[], const rocblas_int *ipiv,
+                 float *const B[])
+{
+    return rocsolver_getrs_plan_execute_impl<true,false,float>(plan, "getrs_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_batched_plan_execute(rocsolver_plan plan, double *const A[], const rocblas_int *ipiv,
+                 double *const B[])
+{
+    return rocsolver_getrs_plan_execute_impl<true,false,double>(plan, "getrs_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], const rocblas_int *ipiv,
+                 rocblas_float_complex *const B[])
+{
+    return rocsolver_getrs_plan_execute_impl<true,false,rocblas_float_complex>(plan, "getrs_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], const rocblas_int *ipiv,
+                 rocblas_double_complex *const B[])
+{
+    return rocsolver_getrs_plan_execute_impl<true,false,rocblas_double_complex>(plan, "getrs_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_strided_batched_plan_execute(rocsolver_plan plan, float *A, const rocblas_int *ipiv, float *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,true,float>(plan, "getrs_strided_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_strided_batched_plan_execute(rocsolver_plan plan, double *A, const rocblas_int *ipiv, double *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,true,double>(plan, "getrs_strided_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, const rocblas_int *ipiv, rocblas_float_complex *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,true,rocblas_float_complex>(plan, "getrs_strided_batched", A, ipiv, B);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, const rocblas_int *ipiv, rocblas_double_complex *B)
+{
+    return rocsolver_getrs_plan_execute_impl<false,true,rocblas_double_complex>(plan, "getrs_strided_batched", A, ipiv, B);
+}
+
+} //extern C
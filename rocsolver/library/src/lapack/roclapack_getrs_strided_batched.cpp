@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getrs.hpp"
+#include "handle.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
@@ -12,7 +13,12 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle, const
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"getrs_strided_batched",rocsolver_precision<T>());
+    log.arg("trans",trans,"transposeA").arg("n",n,"sizem").arg("nrhs",nrhs,"sizen").arg("A",A)
+       .arg("lda",lda,"lda").arg("strideA",strideA,"bsa").arg("ipiv",ipiv)
+       .arg("strideP",strideP,"bsp").arg("B",B).arg("ldb",ldb,"ldb").arg("strideB",strideB,"bsb")
+       .arg("batch_count",batch_count,"batch").start();
 
     if (n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0) 
         return rocblas_status_invalid_size;
@@ -20,13 +26,27 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle, const
     if (!A || !ipiv || !B)
         return rocblas_status_invalid_pointer;
 
+    // memory managment
+    size_t size;  //size of arrays of pointers (for batched cases)
+    rocsolver_getrs_getMemorySize<false,T>(n,nrhs,batch_count,&size);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"getrs_strided_batched",size);
+    if (!mem)
+        return rocblas_status_memory_error;
+    void *workArr = mem[0];
+
     return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
                                         A,0,
                                         lda,strideA,
                                         ipiv,strideP,
                                         B,0,
                                         ldb,strideB,
-                                        batch_count);
+                                        batch_count,
+                                        (T**)workArr);
 }
 
 
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_potf2.hpp"
+#include "handle.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_potf2_impl(rocblas_handle handle, const rocblas_fill uplo,    
@@ -11,7 +12,9 @@ rocblas_status rocsolver_potf2_impl(rocblas_handle handle, const rocblas_fill up
     if(!handle)
         return rocblas_status_invalid_handle;
     
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"potf2",rocsolver_precision<T>());
+    log.arg("uplo",uplo,"uplo").arg("n",n,"sizen").arg("A",A).arg("lda",lda,"lda").arg("info",info).start();
     
     // argument checking
     if (!A || !info)
@@ -23,26 +26,25 @@ rocblas_status rocsolver_potf2_impl(rocblas_handle handle, const rocblas_fill up
     rocblas_int batch_count = 1;
 
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;
     rocsolver_potf2_getMemorySize<T>(n,batch_count,&size_1,&size_2,&size_3);
 
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *pivotGPU;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&pivotGPU,size_3);
-    if (!scalars || (size_2 && !work) || (size_3 && !pivotGPU))
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"potf2",size_2,size_3);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *pivotGPU = mem[1];
 
-    // scalars constants for rocblas functions calls 
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // scalars constants for rocblas functions calls
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status = 
@@ -54,9 +56,6 @@ rocblas_status rocsolver_potf2_impl(rocblas_handle handle, const rocblas_fill up
                                         (T*)work,
                                         (T*)pivotGPU);
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(pivotGPU);
     return status;
 }
 
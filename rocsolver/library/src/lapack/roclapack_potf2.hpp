@@ -86,6 +86,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     // quick return
     if (n == 0 || batch_count == 0) 
         return rocblas_status_success;
+
+    ROCSOLVER_PHASE(handle, "potf2");
     
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
@@ -100,7 +102,7 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     dim3 threads(BLOCKSIZE, 1, 1);
 
     //info=0 (starting with a positive definite matrix)
-    hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
 
     if (uplo == rocblas_fill_upper) { // Compute the Cholesky factorization A = U'*U.
         for (rocblas_int j = 0; j < n; ++j) {
@@ -108,8 +110,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
             rocblasCall_dot<COMPLEX,T>(handle, j, A, shiftA + idx2D(0, j, lda), 1, strideA,
                                  A, shiftA + idx2D(0, j, lda), 1, strideA, batch_count, pivotGPU, work);
 
-            hipLaunchKernelGGL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, 
-                               A, shiftA, strideA, idx2D(j, j, lda), j, pivotGPU, info);
+            ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, 
+                                    A, shiftA, strideA, idx2D(j, j, lda), j, pivotGPU, info);
 
             // Compute elements J+1:N of row J
             if (j < n - 1) {
@@ -134,8 +136,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
             rocblasCall_dot<COMPLEX,T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda, strideA,
                                  A, shiftA + idx2D(j, 0, lda), lda, strideA, batch_count, pivotGPU, work);
 
-            hipLaunchKernelGGL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, 
-                               A, shiftA, strideA, idx2D(j, j, lda), j, pivotGPU, info);
+            ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, 
+                                    A, shiftA, strideA, idx2D(j, j, lda), j, pivotGPU, info);
 
             // Compute elements J+1:N of row J
             if (j < n - 1) {
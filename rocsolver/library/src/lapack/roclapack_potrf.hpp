@@ -13,6 +13,8 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "tuning.hpp"
+#include "autotune.hpp"
 #include "ideal_sizes.hpp"
 #include "roclapack_potf2.hpp"
 
@@ -25,16 +27,25 @@ __global__ void chk_positive(rocblas_int *iinfo, rocblas_int *info, int j)
             info[id] = iinfo[id] + j;   
 }
 
-template <typename T>
-void rocsolver_potrf_getMemorySize(const rocblas_int n, const rocblas_int batch_count,
-                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4)
+template <bool BATCHED, typename T>
+void rocsolver_potrf_getMemorySize(rocblas_handle handle, const rocblas_int n, const rocblas_int batch_count,
+                                  size_t *size_1, size_t *size_2, size_t *size_3, size_t *size_4, size_t *size_5)
 {
-    if (n < POTRF_POTF2_SWITCHSIZE) {
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_potrf_blocksize, n, batch_count);
+
+    if (n < nb) {
         rocsolver_potf2_getMemorySize<T>(n,batch_count,size_1,size_2,size_3);
         *size_4 = 0;
+        *size_5 = 0;
     } else {
-        rocsolver_potf2_getMemorySize<T>(POTRF_POTF2_SWITCHSIZE,batch_count,size_1,size_2,size_3);
+        rocsolver_potf2_getMemorySize<T>(nb,batch_count,size_1,size_2,size_3);
         *size_4 = sizeof(rocblas_int)*batch_count;
+
+        // size of arrays of pointers (for batched trsm)
+        if (BATCHED)
+            *size_5 = 2*sizeof(T*)*batch_count;
+        else
+            *size_5 = 0;
     }   
 }
 
@@ -44,12 +55,14 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                         const rocblas_int shiftA,
                                         const rocblas_int lda, const rocblas_stride strideA,
                                         rocblas_int *info, const rocblas_int batch_count,
-                                        T*scalars, T* work, T* pivotGPU, rocblas_int *iinfo)
+                                        T*scalars, T* work, T* pivotGPU, rocblas_int *iinfo, T** workArr)
 {
     // quick return
     if (n == 0 || batch_count == 0) 
         return rocblas_status_success;
 
+    ROCSOLVER_PHASE(handle, "potrf");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     
@@ -58,19 +71,13 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     rocblas_get_pointer_mode(handle,&old_mode);
     rocblas_set_pointer_mode(handle,rocblas_pointer_mode_host);
 
+    // block size (the same as in the memory size query)
+    rocblas_int nb = rocsolver_get_tuning<T>(handle, tuning_potrf_blocksize, n, batch_count);
+
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the algorithm
-    if (n < POTRF_POTF2_SWITCHSIZE) 
+    if (n < nb) 
         return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, scalars, work, pivotGPU);
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
-
     //constants for rocblas functions calls
     T t_one = 1;
     S s_one = 1;
@@ -79,33 +86,27 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BLOCKSIZE, 1, 1);
-    T* M;
     rocblas_int jb;
 
     //info=0 (starting with a positive definite matrix)
-    hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
-
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
+    ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
 
     if (uplo == rocblas_fill_upper) { // Compute the Cholesky factorization A = U'*U.
-        for (rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE) {
+        for (rocblas_int j = 0; j < n; j += nb) {
             // Factor diagonal and subdiagonal blocks 
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE);  //number of columns in the block
-            hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
+            jb = min(n - j, nb);  //number of columns in the block
+            ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, iinfo, batch_count, scalars, work, pivotGPU);
             
             // test for non-positive-definiteness.
-            hipLaunchKernelGGL(chk_positive<U>,gridReset,threads,0,stream,iinfo,info,j);
+            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>,gridReset,threads,0,stream,iinfo,info,j);
             
             if (j + jb < n) {
                 // update trailing submatrix
-                for (int b=0;b<batch_count;++b) {
-                    M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                    rocblas_trsm(handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
-                             rocblas_diagonal_non_unit, jb, (n - j - jb), &t_one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j, j + jb, lda)), lda);
-                }
+                rocblasCall_trsm<T>(handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+                                    rocblas_diagonal_non_unit, jb, (n - j - jb), &t_one,
+                                    A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                    A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, workArr);
 
                 rocblasCall_herk<S,T>(handle, uplo, rocblas_operation_conjugate_transpose, n-j-jb, jb, &s_minone,
                                 A, shiftA + idx2D(j,j+jb,lda), lda, strideA, &s_one,
@@ -114,23 +115,21 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         }
 
     } else { // Compute the Cholesky factorization A = L'*L.
-        for (rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE) {
+        for (rocblas_int j = 0; j < n; j += nb) {
             // Factor diagonal and subdiagonal blocks 
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE);  //number of columns in the block
-            hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
+            jb = min(n - j, nb);  //number of columns in the block
+            ROCSOLVER_LAUNCH_KERNEL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, iinfo, batch_count, scalars, work, pivotGPU);
             
             // test for non-positive-definiteness.
-            hipLaunchKernelGGL(chk_positive<U>,gridReset,threads,0,stream,iinfo,info,j);
+            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>,gridReset,threads,0,stream,iinfo,info,j);
             
             if (j + jb < n) {
                 // update trailing submatrix
-                for (int b=0;b<batch_count;++b) {
-                    M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                    rocblas_trsm(handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
-                             rocblas_diagonal_non_unit, (n - j - jb), jb, &t_one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j + jb, j, lda)), lda);
-                }
+                rocblasCall_trsm<T>(handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+                                    rocblas_diagonal_non_unit, (n - j - jb), jb, &t_one,
+                                    A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                    A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count, workArr);
 
                 rocblasCall_herk<S,T>(handle, uplo, rocblas_operation_none, n-j-jb, jb, &s_minone,
                                 A, shiftA + idx2D(j+jb,j,lda), lda, strideA, &s_one,
@@ -143,4 +142,36 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+// chooses the block size for the given problem if autotuning is enabled and
+// there is no value for it yet (see autotune.hpp)
+template <typename T>
+void rocsolver_potrf_autotune(rocblas_handle handle, const rocblas_int n, const rocblas_int batch_count)
+{
+    if (!rocsolver_autotune_wanted(handle, tuning_potrf_blocksize, rocsolver_precision<T>(), n, batch_count))
+        return;
+
+    rocsolver_autotune_scratch<T> scratch(n, n, batch_count);
+    if (!scratch)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    auto run = [&]() {
+        size_t size_1, size_2, size_3, size_4, size_5;
+        rocsolver_potrf_getMemorySize<false,T>(handle,n,scratch.batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+        rocsolver_device_malloc mem(handle,"potrf_autotune",size_2,size_3,size_4,size_5);
+        T *scalars = rocsolver_get_constants<T>(handle);
+        if (!mem || !scalars)
+            return rocblas_status_memory_error;
+
+        scratch.init(stream);
+        return rocsolver_potrf_template<real_t<T>,T>(handle,rocblas_fill_upper,n,scratch.A,0,scratch.lda,scratch.strideA,
+                                                     scratch.info,scratch.batch_count,
+                                                     scalars,(T*)mem[0],(T*)mem[1],(rocblas_int*)mem[2],(T**)mem[3]);
+    };
+    rocsolver_autotune<T>(handle, tuning_potrf_blocksize, n, batch_count, {32, 64, 128, 256}, run);
+}
+
 #endif /* ROCLAPACK_POTRF_HPP */
@@ -2,8 +2,8 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_potrf.hpp"
+#include "handle.hpp"
 
 template <typename S, typename T, typename U>
 rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle, const rocblas_fill uplo,    
@@ -13,7 +13,10 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle, const rocblas
     if(!handle)
         return rocblas_status_invalid_handle;
     
-    //logging is missing ???    
+    // logging
+    rocsolver_logger log(handle,"potrf_batched",rocsolver_precision<T>());
+    log.arg("uplo",uplo,"uplo").arg("n",n,"sizen").arg("A",A).arg("lda",lda,"lda").arg("info",info)
+       .arg("batch_count",batch_count,"batch").start();
     
     // argument checking
     if (!A || !info)
@@ -23,29 +26,31 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle, const rocblas
 
     rocblas_stride strideA = 0;
 
+    // block size selection (only when autotuning is enabled)
+    rocsolver_potrf_autotune<T>(handle,n,batch_count);
+
     // memory managment
-    size_t size_1;  //size of constants
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
     size_t size_2;  //size of workspace
     size_t size_3;  
     size_t size_4;
-    rocsolver_potrf_getMemorySize<T>(n,batch_count,&size_1,&size_2,&size_3,&size_4);
-
-    // (TODO) MEMORY SIZE QUERIES AND ALLOCATIONS TO BE DONE WITH ROCBLAS HANDLE
-    void *scalars, *work, *pivotGPU, *iinfo;
-    hipMalloc(&scalars,size_1);
-    hipMalloc(&work,size_2);
-    hipMalloc(&pivotGPU,size_3);
-    hipMalloc(&iinfo,size_4);
-    if (!scalars || (size_2 && !work) || (size_3 && !pivotGPU) || (size_4 && !iinfo))
+    size_t size_5;  //size of arrays of pointers (for batched cases)
+    rocsolver_potrf_getMemorySize<true,T>(handle,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+    if (rocsolver_is_device_memory_size_query(handle))
+        return rocsolver_set_optimal_device_memory_size(handle,size_2,size_3,size_4,size_5);
+
+    // memory allocation (all the workspace is taken at once from the handle)
+    rocsolver_device_malloc mem(handle,"potrf_batched",size_2,size_3,size_4,size_5);
+    if (!mem)
         return rocblas_status_memory_error;
+    void *work = mem[0], *pivotGPU = mem[1], *iinfo = mem[2], *workArr = mem[3];
 
     // scalars constants for rocblas functions calls
-    // (to standarize and enable re-use, size_1 always equals 3)
-    std::vector<T> sca(size_1);
-    sca[0] = -1;
-    sca[1] = 0;
-    sca[2] = 1;
-    RETURN_IF_HIP_ERROR(hipMemcpy(scalars, sca.data(), sizeof(T)*size_1, hipMemcpyHostToDevice));
+    // (they are kept on the device by the handle, so no transfer is needed here)
+    T *scalars = rocsolver_get_constants<T>(handle);
+    if (!scalars)
+        return rocblas_status_memory_error;
 
     // execution
     rocblas_status status =
@@ -56,12 +61,9 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle, const rocblas
                                        (T*)scalars,
                                        (T*)work,
                                        (T*)pivotGPU,
-                                       (rocblas_int*)iinfo);            
+                                       (rocblas_int*)iinfo,
+                                       (T**)workArr);            
 
-    hipFree(scalars);
-    hipFree(work);
-    hipFree(pivotGPU);
-    hipFree(iinfo);
     return status;
 }
 
@@ -101,5 +103,3 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
 }
 
 }
-
-#undef batched
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potrf.hpp"
+#include "plan.hpp"
+
+template <bool BATCHED, typename T>
+rocblas_status rocsolver_potrf_plan_create_impl(rocblas_handle handle, const char *routine, const rocblas_fill uplo,
+                                                const rocblas_int n, const rocblas_int lda, const rocblas_stride strideA,
+                                                const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if (n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+
+    // block size selection (only when autotuning is enabled)
+    rocsolver_potrf_autotune<T>(handle,n,batch_count);
+
+    // memory managment
+    size_t size_1;  //size of constants (not used; they are provided by the handle)
+    size_t size_2;  //size of workspace
+    size_t size_3;
+    size_t size_4;
+    size_t size_5;  //size of arrays of pointers (for batched cases)
+    rocsolver_potrf_getMemorySize<BATCHED,T>(handle,n,batch_count,&size_1,&size_2,&size_3,&size_4,&size_5);
+
+    std::unique_ptr<_rocsolver_plan> p(new _rocsolver_plan(handle,routine,rocsolver_precision<T>()));
+    p->uplo = uplo;
+    p->n = n;
+    p->lda = lda;
+    p->strideA = strideA;
+    p->batch_count = batch_count;
+
+    // tuning values and memory allocation (the workspace is owned by the plan)
+    if (!rocsolver_plan_prepare(p.get(),n,size_2,size_3,size_4,size_5))
+        return rocblas_status_memory_error;
+
+    // scalars constants for rocblas functions calls
+    p->scalars = rocsolver_get_constants<T>(handle);
+    if (!p->scalars)
+        return rocblas_status_memory_error;
+
+    *plan = p.release();
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename S, typename T, typename U>
+rocblas_status rocsolver_potrf_plan_execute_impl(rocsolver_plan plan, const char *routine, U A, rocblas_int* info)
+{
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+    if (!plan->is(routine,rocsolver_precision<T>()))
+        return rocblas_status_invalid_value;
+
+    // logging (as a call to the routine)
+    rocsolver_logger log(plan->handle,plan->log,routine,rocsolver_precision<T>());
+    log.arg("uplo",plan->uplo,"uplo").arg("n",plan->n,"sizen").arg("A",A).arg("lda",plan->lda,"lda");
+    if (STRIDED)
+        log.arg("strideA",plan->strideA,"bsa");
+    log.arg("info",info);
+    if (BATCHED || STRIDED)
+        log.arg("batch_count",plan->batch_count,"batch");
+    log.start();
+
+    // argument checking
+    if (!A || !info)
+        return rocblas_status_invalid_pointer;
+
+    // execution (with the tuning values of the plan), or replay of its graph
+    rocsolver_plan_scope scope(plan);
+    void **buf = plan->buffers;
+    return rocsolver_plan_run(plan,{A,info},[&] {
+        return rocsolver_potrf_template<S,T>(plan->handle,plan->uplo,plan->n,
+                                             A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                             plan->lda,plan->strideA,
+                                             info,plan->batch_count,
+                                             (T*)plan->scalars,
+                                             (T*)buf[0],
+                                             (T*)buf[1],
+                                             (rocblas_int*)buf[2],
+                                             (T**)buf[3]);
+    });
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,float>(handle, "potrf", uplo, n, lda, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,double>(handle, "potrf", uplo, n, lda, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,rocblas_float_complex>(handle, "potrf", uplo, n, lda, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,rocblas_double_complex>(handle, "potrf", uplo, n, lda, 0, 1, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<true,float>(handle, "potrf_batched", uplo, n, lda, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<true,double>(handle, "potrf_batched", uplo, n, lda, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<true,rocblas_float_complex>(handle, "potrf_batched", uplo, n, lda, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<true,rocblas_double_complex>(handle, "potrf_batched", uplo, n, lda, 0, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,float>(handle, "potrf_strided_batched", uplo, n, lda, strideA, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,double>(handle, "potrf_strided_batched", uplo, n, lda, strideA, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,rocblas_float_complex>(handle, "potrf_strided_batched", uplo, n, lda, strideA, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched_plan_create(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int lda, const rocblas_stride strideA, const rocblas_int batch_count, rocsolver_plan *plan)
+{
+    return rocsolver_potrf_plan_create_impl<false,rocblas_double_complex>(handle, "potrf_strided_batched", uplo, n, lda, strideA, batch_count, plan);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_plan_execute(rocsolver_plan plan, float *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,false,float,float>(plan, "potrf", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_plan_execute(rocsolver_plan plan, double *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,false,double,double>(plan, "potrf", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,false,float,rocblas_float_complex>(plan, "potrf", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,false,double,rocblas_double_complex>(plan, "potrf", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched_plan_execute(rocsolver_plan plan, float *const A[], rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<true,false,float,float>(plan, "potrf_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched_plan_execute(rocsolver_plan plan, double *const A[], rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<true,false,double,double>(plan, "potrf_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *const A[], rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<true,false,float,rocblas_float_complex>(plan, "potrf_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *const A[], rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<true,false,double,rocblas_double_complex>(plan, "potrf_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched_plan_execute(rocsolver_plan plan, float *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,true,float,float>(plan, "potrf_strided_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched_plan_execute(rocsolver_plan plan, double *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,true,double,double>(plan, "potrf_strided_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cpotrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_float_complex *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,true,float,rocblas_float_complex>(plan, "potrf_strided_batched", A, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zpotrf_strided_batched_plan_execute(rocsolver_plan plan, rocblas_double_complex *A, rocblas_int* info)
+{
+    return rocsolver_potrf_plan_execute_impl<false,true,double,rocblas_double_complex>(plan, "potrf_strided_batched", A, info);
+}
+
+} //extern C
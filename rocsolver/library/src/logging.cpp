@@ -0,0 +1,314 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include "utility.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+// maximum number of profiled calls in progress before the completed ones are collected
+#define PROFILE_MAX_PENDING 64
+
+/*
+ * ===========================================================================
+ *    Output streams
+ * ===========================================================================
+ */
+
+static std::mutex& log_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+// the file given by the environment variable env (opened the first time it is
+// needed, in append mode), or stderr if env is not set
+static std::ostream& open_log(std::unique_ptr<std::ofstream> &file, const char *env)
+{
+    if (!file) {
+        file.reset(new std::ofstream);
+        const char *path = getenv(env);
+        if (path && *path)
+            file->open(path, std::ios::app);
+    }
+    return file->is_open() ? *file : std::cerr;
+}
+
+// stream of a layer (to be used with log_mutex locked)
+static std::ostream& log_stream(const rocblas_layer_mode layer)
+{
+    static std::unique_ptr<std::ofstream> trace, bench, profile;
+    switch (layer) {
+        case rocblas_layer_mode_log_trace:
+            return open_log(trace, "ROCSOLVER_LOG_TRACE_PATH");
+        case rocblas_layer_mode_log_bench:
+            return open_log(bench, "ROCSOLVER_LOG_BENCH_PATH");
+        default:
+            return open_log(profile, "ROCSOLVER_LOG_PROFILE_PATH");
+    }
+}
+
+
+/*
+ * ===========================================================================
+ *    Values of the arguments
+ * ===========================================================================
+ */
+
+std::string rocsolver_log_value(const rocblas_int value)
+{
+    return std::to_string(value);
+}
+
+std::string rocsolver_log_value(const rocblas_stride value)
+{
+    return std::to_string(value);
+}
+
+std::string rocsolver_log_value(const rocblas_operation value)
+{
+    return std::string(1, rocblas_transpose_letter(value));
+}
+
+std::string rocsolver_log_value(const rocblas_fill value)
+{
+    return std::string(1, rocblas_fill_letter(value));
+}
+
+std::string rocsolver_log_value(const rocblas_side value)
+{
+    return std::string(1, rocblas_side_letter(value));
+}
+
+std::string rocsolver_log_value(const rocblas_direct value)
+{
+    return value == rocblas_forward_direction ? "F" : "B";
+}
+
+std::string rocsolver_log_value(const rocblas_storev value)
+{
+    return value == rocblas_column_wise ? "C" : "R";
+}
+
+std::string rocsolver_log_value(const void *value)
+{
+    std::ostringstream s;
+    s << value;
+    return s.str();
+}
+
+
+/*
+ * ===========================================================================
+ *    Profile
+ * ===========================================================================
+ */
+
+void rocsolver_logging_load_environment(rocsolver_logging *log)
+{
+    const char *layers = getenv("ROCSOLVER_LAYER");
+    if (layers && *layers)
+        log->layers = strtol(layers, nullptr, 0);
+}
+
+// adds the time of the profiled calls that have completed (or of all of them, waiting
+// for those in progress, if wait is true) to their entries
+static void collect_profile(rocsolver_logging *log, const bool wait)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < log->pending.size(); ++i) {
+        rocsolver_profile_call &call = log->pending[i];
+        if (wait)
+            hipEventSynchronize(call.stop);
+        else if (hipEventQuery(call.stop) != hipSuccess) {
+            // (still in progress)
+            log->pending[kept++] = std::move(call);
+            continue;
+        }
+
+        float ms = 0;
+        hipEventElapsedTime(&ms, call.start, call.stop);
+        log->profile[call.key].time += ms * 1000.0;
+        log->free_events.push_back(call.start);
+        log->free_events.push_back(call.stop);
+    }
+    log->pending.resize(kept);
+}
+
+void rocsolver_logging_write_profile(rocsolver_logging *log)
+{
+    collect_profile(log, true);
+    if (log->profile.empty())
+        return;
+
+    // (every entry can be run with rocsolver-bench --file)
+    std::lock_guard<std::mutex> lock(log_mutex());
+    std::ostream &out = log_stream(rocblas_layer_mode_log_profile);
+    out << "# rocSOLVER profile: number of calls and total device time of every routine and set of arguments.\n"
+        << "# Replay with: rocsolver-bench --file <this file>\n";
+    for (auto &e : log->profile)
+        out << "- {" << e.first << "}  # calls: " << e.second.calls << ", time(us): " << e.second.time << '\n';
+    out.flush();
+    log->profile.clear();
+}
+
+void rocsolver_logging_release(rocsolver_logging *log)
+{
+    collect_profile(log, true);
+    for (hipEvent_t e : log->free_events)
+        hipEventDestroy(e);
+    log->free_events.clear();
+}
+
+static hipEvent_t get_event(rocsolver_logging *log)
+{
+    hipEvent_t e = nullptr;
+    if (!log->free_events.empty()) {
+        e = log->free_events.back();
+        log->free_events.pop_back();
+    } else if (hipEventCreate(&e) != hipSuccess)
+        e = nullptr;
+    return e;
+}
+
+
+/*
+ * ===========================================================================
+ *    Logger
+ * ===========================================================================
+ */
+
+rocsolver_logging* rocsolver_get_logging(rocblas_handle handle)
+{
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (data)
+        return &data->log;
+
+    // handles without state only have the layers that keep nothing between calls
+    static rocsolver_logging *environment = [] {
+        rocsolver_logging *log = new rocsolver_logging;
+        rocsolver_logging_load_environment(log);
+        log->layers &= rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench;
+        return log;
+    }();
+    return environment;
+}
+
+rocsolver_logger::rocsolver_logger(rocblas_handle handle, const char *routine, const char precision)
+    : handle(handle), routine(routine), precision(precision)
+{
+    rocsolver_logging *handle_log = rocsolver_get_logging(handle);
+    // (device memory size queries do not execute anything and are not logged)
+    if (handle_log->layers && !rocsolver_is_device_memory_size_query(handle))
+        log = handle_log;
+}
+
+rocsolver_logger::rocsolver_logger(rocblas_handle handle, rocsolver_logging *handle_log, const char *routine,
+                                   const char precision)
+    : handle(handle), routine(routine), precision(precision)
+{
+    if (handle_log->layers)
+        log = handle_log;
+}
+
+void rocsolver_logger::add(const char *name, const std::string &value, const char *bench_option)
+{
+    trace_args += (trace_args.empty() ? "" : ", ") + std::string(name) + "=" + value;
+    if (bench_option) {
+        bench_args += " --" + std::string(bench_option) + " " + value;
+        profile_args += ", " + std::string(bench_option) + ": " + value;
+    }
+}
+
+void rocsolver_logger::start()
+{
+    if (!log)
+        return;
+
+    if (log->layers & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench)) {
+        std::lock_guard<std::mutex> lock(log_mutex());
+        if (log->layers & rocblas_layer_mode_log_trace) {
+            log_stream(rocblas_layer_mode_log_trace)
+                << "rocsolver_" << precision << routine << "(" << trace_args << ")" << std::endl;
+        }
+        if (log->layers & rocblas_layer_mode_log_bench) {
+            log_stream(rocblas_layer_mode_log_bench)
+                << "rocsolver-bench -f " << routine << " -r " << precision << bench_args << std::endl;
+        }
+    }
+
+    if (log->layers & rocblas_layer_mode_log_profile) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        // (the events recorded during a graph capture cannot be timed; the call is not profiled)
+        if (rocsolver_stream_is_capturing(stream))
+            return;
+        start_event = get_event(log);
+        if (start_event)
+            hipEventRecord(start_event, stream);
+    }
+}
+
+rocsolver_logger::~rocsolver_logger()
+{
+    if (!start_event)
+        return;
+
+    std::string key = "function: " + std::string(routine) + ", precision: " + precision + profile_args;
+    log->profile[key].calls++;
+
+    hipEvent_t stop_event = get_event(log);
+    if (!stop_event) {
+        log->free_events.push_back(start_event);
+        return;
+    }
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    hipEventRecord(stop_event, stream);
+    log->pending.push_back({key, start_event, stop_event});
+
+    if (log->pending.size() >= PROFILE_MAX_PENDING)
+        collect_profile(log, false);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_layer_mode(rocblas_handle handle, const rocblas_int layer_mode)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    data->log.layers = layer_mode;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_log_write_profile(rocblas_handle handle)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+
+    // (nothing is profiled on a handle without state)
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (data)
+        rocsolver_logging_write_profile(&data->log);
+    return rocblas_status_success;
+}
+
+} //extern C
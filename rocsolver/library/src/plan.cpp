@@ -0,0 +1,64 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "plan.hpp"
+
+bool rocsolver_plan_prepare(rocsolver_plan plan, const rocblas_int size, std::initializer_list<size_t> sizes)
+{
+    for (int p = 0; p < tuning_num_params; ++p)
+        plan->tuning[p] = rocsolver_get_tuning(plan->handle, rocsolver_tuning_param(p), plan->precision,
+                                               size, plan->batch_count);
+
+    if (hipEventCreateWithFlags(&plan->done, hipEventDisableTiming) != hipSuccess) {
+        plan->done = nullptr;
+        return false;
+    }
+
+    size_t total = rocsolver_workspace_size(sizes);
+    if (total > 0 && (hipMalloc(&plan->memory, total) != hipSuccess || !plan->memory)) {
+        plan->memory = nullptr;
+        return false;
+    }
+
+    char *ptr = (char*)plan->memory;
+    int i = 0;
+    for (size_t s : sizes) {
+        plan->buffers[i++] = s > 0 ? ptr : nullptr;
+        ptr += rocsolver_workspace_align(s);
+    }
+    return true;
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_destroy_plan(rocsolver_plan plan)
+{
+    delete plan;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_plan_graphs(rocsolver_plan plan, const rocblas_int enable)
+{
+    if (!plan)
+        return rocblas_status_invalid_pointer;
+
+    if (!enable) {
+        rocsolver_graph_cache_release(plan->graphs);
+        plan->graphs = nullptr;
+    } else if (!plan->graphs) {
+        plan->graphs = rocsolver_graph_cache_create();
+        if (!plan->graphs)
+            return rocblas_status_not_implemented;
+    }
+    return rocblas_status_success;
+}
+
+} //extern C
@@ -0,0 +1,357 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "profiler.hpp"
+#include "graph.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef ROCSOLVER_PHASE_PROFILER
+
+#ifdef ROCSOLVER_USE_ROCTX
+#include <roctx.h>
+#endif
+
+std::atomic<int> rocsolver_phase_mode(0);
+
+// kernels launched and rocBLAS functions called within the outermost phases, since
+// rocsolver_start_phase_counters
+static std::atomic<rocblas_int> phase_launches(0);
+static std::atomic<rocblas_int> phase_blas_calls(0);
+
+// maximum number of phases kept for the trace. When it is full, the phases that completed
+// are appended to the trace requested from the environment; otherwise (or if none has
+// completed), the new phases are dropped.
+#define ROCSOLVER_PHASE_MAX_RECORDS 65536
+
+/*
+ * ===========================================================================
+ *    Recorded phases
+ * ===========================================================================
+ */
+
+// a phase recorded for the trace. (The events are only read when the trace is
+// written, so that the profiler does not synchronize the device.)
+struct rocsolver_phase_record
+{
+    const char *name;
+    int device;
+    hipStream_t stream;
+    hipEvent_t start, stop;
+    rocblas_int launches, blas_calls, depth;
+};
+
+struct rocsolver_phase_trace
+{
+    std::mutex mtx;
+    std::vector<rocsolver_phase_record> records;
+    std::vector<hipEvent_t> free_events;
+    // origin of the timestamps of every device (recorded before its first phase)
+    std::map<int, hipEvent_t> origins;
+    // phases not recorded because the trace was full
+    size_t dropped = 0;
+
+    // trace requested from the environment: a JSON array of events (the closing bracket
+    // is optional in the Chrome trace format), opened when the first phases are appended
+    std::string env_path;
+    std::ofstream env_out;
+    std::map<hipStream_t, int> env_streams;
+    bool env_first = true;
+};
+
+// (never destroyed: nothing is done at exit, when HIP may already be torn down)
+static rocsolver_phase_trace& phase_trace()
+{
+    static rocsolver_phase_trace *trace = new rocsolver_phase_trace;
+    return *trace;
+}
+
+// innermost phase of every thread
+static thread_local rocsolver_phase *current_phase = nullptr;
+
+// (to be called with the trace mutex locked)
+static hipEvent_t get_event(rocsolver_phase_trace &trace)
+{
+    hipEvent_t e = nullptr;
+    if (!trace.free_events.empty()) {
+        e = trace.free_events.back();
+        trace.free_events.pop_back();
+    } else if (hipEventCreate(&e) != hipSuccess)
+        e = nullptr;
+    return e;
+}
+
+
+/*
+ * ===========================================================================
+ *    Chrome trace
+ * ===========================================================================
+ */
+
+// writes a recorded phase (that has completed) as a Chrome trace event. Every device is a
+// process and every stream a thread (numbered in streams); the timestamps are relative to
+// the first phase of the device.
+static void write_phase_event(std::ostream &out, rocsolver_phase_trace &trace, const rocsolver_phase_record &r,
+                              std::map<hipStream_t, int> &streams, bool &first)
+{
+    float ts = 0, dur = 0;
+    if (hipEventElapsedTime(&ts, trace.origins[r.device], r.start) != hipSuccess
+        || hipEventElapsedTime(&dur, r.start, r.stop) != hipSuccess)
+        return;
+
+    int tid = streams.emplace(r.stream, int(streams.size())).first->second;
+    out << (first ? "\n" : ",\n")
+        << "{\"name\": \"" << r.name << "\", \"cat\": \"rocsolver\", \"ph\": \"X\""
+        << ", \"ts\": " << ts * 1000.0 << ", \"dur\": " << dur * 1000.0
+        << ", \"pid\": " << r.device << ", \"tid\": " << tid
+        << ", \"args\": {\"kernels\": " << r.launches << ", \"rocblas_calls\": " << r.blas_calls
+        << ", \"depth\": " << r.depth << "}}";
+    first = false;
+}
+
+// appends the recorded phases that have completed (or all of them, waiting for them, if
+// wait is true) to the trace requested from the environment, and releases them.
+// (to be called with the trace mutex locked)
+static void append_env_trace(rocsolver_phase_trace &trace, const bool wait)
+{
+    if (!trace.env_out.is_open()) {
+        trace.env_out.open(trace.env_path);
+        trace.env_out << "[";
+    }
+
+    auto kept = trace.records.begin();
+    for (auto &r : trace.records) {
+        if (wait)
+            hipEventSynchronize(r.stop);
+        else if (hipEventQuery(r.stop) != hipSuccess) {
+            *kept++ = r;
+            continue;
+        }
+        if (trace.env_out.is_open())
+            write_phase_event(trace.env_out, trace, r, trace.env_streams, trace.env_first);
+        trace.free_events.push_back(r.start);
+        trace.free_events.push_back(r.stop);
+    }
+    trace.records.erase(kept, trace.records.end());
+    trace.env_out.flush();
+}
+
+// writes the recorded phases as a Chrome trace and releases them
+static bool write_phase_trace(const char *filename)
+{
+    rocsolver_phase_trace &trace = phase_trace();
+    std::lock_guard<std::mutex> lock(trace.mtx);
+
+    std::ofstream out;
+    if (filename && *filename)
+        out.open(filename);
+
+    std::map<hipStream_t, int> streams;
+    bool first = true;
+    if (out.is_open())
+        out << "{\"traceEvents\": [";
+    for (auto &r : trace.records) {
+        hipEventSynchronize(r.stop);
+        if (out.is_open())
+            write_phase_event(out, trace, r, streams, first);
+        trace.free_events.push_back(r.start);
+        trace.free_events.push_back(r.stop);
+    }
+    if (out.is_open())
+        out << "\n],\n\"displayTimeUnit\": \"ms\",\n\"otherData\": {\"dropped_phases\": " << trace.dropped << "}}\n";
+
+    trace.records.clear();
+    trace.dropped = 0;
+    // (the trace requested from the environment keeps the origins of its timestamps)
+    if (trace.env_path.empty()) {
+        for (auto &o : trace.origins)
+            trace.free_events.push_back(o.second);
+        trace.origins.clear();
+    }
+
+    return out.is_open() && out.good();
+}
+
+void rocsolver_phase_flush()
+{
+    rocsolver_phase_trace &trace = phase_trace();
+    std::lock_guard<std::mutex> lock(trace.mtx);
+    if (!trace.env_path.empty() && !trace.records.empty())
+        append_env_trace(trace, true);
+}
+
+// the profiler can be enabled for the whole execution from the environment
+static struct rocsolver_phase_environment
+{
+    rocsolver_phase_environment()
+    {
+        const char *p = getenv("ROCSOLVER_PHASE_TRACE");
+        if (p && *p) {
+            phase_trace().env_path = p;
+            rocsolver_phase_mode.fetch_or(ROCSOLVER_PHASE_TRACE);
+        }
+        const char *roctx = getenv("ROCSOLVER_PHASE_ROCTX");
+        if (roctx && *roctx && *roctx != '0')
+            rocsolver_phase_mode.fetch_or(ROCSOLVER_PHASE_ROCTX);
+    }
+} phase_environment;
+
+/*
+ * ===========================================================================
+ *    Phases
+ * ===========================================================================
+ */
+
+void rocsolver_phase::begin(rocblas_handle handle, const char *phase_name)
+{
+    name = phase_name;
+    parent = current_phase;
+    depth = parent ? parent->depth + 1 : 0;
+    current_phase = this;
+
+#ifdef ROCSOLVER_USE_ROCTX
+    if (rocsolver_get_phase_mode() & ROCSOLVER_PHASE_ROCTX)
+        roctxRangePushA(name);
+#endif
+
+    if (rocsolver_get_phase_mode() & ROCSOLVER_PHASE_TRACE) {
+        rocblas_get_stream(handle, &stream);
+        // (the events recorded during a graph capture cannot be timed)
+        if (rocsolver_stream_is_capturing(stream))
+            return;
+        int device;
+        hipGetDevice(&device);
+
+        rocsolver_phase_trace &trace = phase_trace();
+        std::lock_guard<std::mutex> lock(trace.mtx);
+        if (!trace.origins.count(device)) {
+            hipEvent_t origin = get_event(trace);
+            if (!origin)
+                return;
+            hipEventRecord(origin, stream);
+            trace.origins[device] = origin;
+        }
+        start_event = get_event(trace);
+        if (start_event)
+            hipEventRecord(start_event, stream);
+    }
+}
+
+void rocsolver_phase::end()
+{
+    current_phase = parent;
+    // (the launches within a phase also count in its parent)
+    if (parent) {
+        parent->launches += launches;
+        parent->blas_calls += blas_calls;
+    } else if (rocsolver_get_phase_mode() & ROCSOLVER_PHASE_COUNT) {
+        phase_launches += launches;
+        phase_blas_calls += blas_calls;
+    }
+
+#ifdef ROCSOLVER_USE_ROCTX
+    if (rocsolver_get_phase_mode() & ROCSOLVER_PHASE_ROCTX)
+        roctxRangePop();
+#endif
+
+    if (!start_event)
+        return;
+
+    rocsolver_phase_trace &trace = phase_trace();
+    std::lock_guard<std::mutex> lock(trace.mtx);
+    hipEvent_t stop_event = get_event(trace);
+    if (!stop_event) {
+        trace.free_events.push_back(start_event);
+        return;
+    }
+    hipEventRecord(stop_event, stream);
+    int device;
+    hipGetDevice(&device);
+
+    if (trace.records.size() >= ROCSOLVER_PHASE_MAX_RECORDS && !trace.env_path.empty())
+        append_env_trace(trace, false);
+    if (trace.records.size() >= ROCSOLVER_PHASE_MAX_RECORDS) {
+        trace.free_events.push_back(start_event);
+        trace.free_events.push_back(stop_event);
+        trace.dropped++;
+        return;
+    }
+    trace.records.push_back({name, device, stream, start_event, stop_event, launches, blas_calls, depth});
+}
+
+void rocsolver_phase::count(const bool blas)
+{
+    if (current_phase) {
+        if (blas)
+            current_phase->blas_calls++;
+        else
+            current_phase->launches++;
+    }
+}
+
+
+#endif /* ROCSOLVER_PHASE_PROFILER */
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_phase_trace(void)
+{
+#ifdef ROCSOLVER_PHASE_PROFILER
+    rocsolver_phase_mode.fetch_or(ROCSOLVER_PHASE_TRACE);
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_phase_trace(const char *filename)
+{
+#ifdef ROCSOLVER_PHASE_PROFILER
+    rocsolver_phase_mode.fetch_and(~ROCSOLVER_PHASE_TRACE);
+    if (!write_phase_trace(filename) && filename)
+        return rocblas_status_internal_error;
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_phase_counters(void)
+{
+#ifdef ROCSOLVER_PHASE_PROFILER
+    phase_launches = 0;
+    phase_blas_calls = 0;
+    rocsolver_phase_mode.fetch_or(ROCSOLVER_PHASE_COUNT);
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_phase_counters(rocblas_int *launches, rocblas_int *blas_calls)
+{
+#ifdef ROCSOLVER_PHASE_PROFILER
+    rocsolver_phase_mode.fetch_and(~ROCSOLVER_PHASE_COUNT);
+    if (launches)
+        *launches = phase_launches;
+    if (blas_calls)
+        *blas_calls = phase_blas_calls;
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+} //extern C
@@ -73,6 +73,76 @@ rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
     return rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
+template <>
+rocblas_status rocblas_trsm_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const float *alpha, const float *const A[], rocblas_int lda,
+                            float *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocblas_strsm_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+template <>
+rocblas_status rocblas_trsm_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const double *alpha, const double *const A[], rocblas_int lda,
+                            double *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocblas_dtrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+template <>
+rocblas_status rocblas_trsm_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const rocblas_float_complex *alpha, const rocblas_float_complex *const A[], rocblas_int lda,
+                            rocblas_float_complex *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocblas_ctrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+template <>
+rocblas_status rocblas_trsm_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const rocblas_double_complex *alpha, const rocblas_double_complex *const A[], rocblas_int lda,
+                            rocblas_double_complex *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocblas_ztrsm_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+template <>
+rocblas_status rocblas_trsm_strided_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const float *alpha, const float *A, rocblas_int lda, rocblas_stride strideA,
+                            float *B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count) {
+    return rocblas_strsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, strideA,
+                                          B, ldb, strideB, batch_count);
+}
+template <>
+rocblas_status rocblas_trsm_strided_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const double *alpha, const double *A, rocblas_int lda, rocblas_stride strideA,
+                            double *B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count) {
+    return rocblas_dtrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, strideA,
+                                          B, ldb, strideB, batch_count);
+}
+template <>
+rocblas_status rocblas_trsm_strided_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const rocblas_float_complex *alpha, const rocblas_float_complex *A, rocblas_int lda, rocblas_stride strideA,
+                            rocblas_float_complex *B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count) {
+    return rocblas_ctrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, strideA,
+                                          B, ldb, strideB, batch_count);
+}
+template <>
+rocblas_status rocblas_trsm_strided_batched(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const rocblas_double_complex *alpha, const rocblas_double_complex *A, rocblas_int lda, rocblas_stride strideA,
+                            rocblas_double_complex *B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count) {
+    return rocblas_ztrsm_strided_batched(handle, side, uplo, transA, diag, m, n, alpha, A, lda, strideA,
+                                          B, ldb, strideB, batch_count);
+}
+
 template <>
 rocblas_status rocblas_trmm(rocblas_handle handle, rocblas_side side, rocblas_fill uplo,
                             rocblas_operation trans, rocblas_diagonal diag, rocblas_int m, rocblas_int n,
@@ -0,0 +1,407 @@
+/* ************************************************************************
+ * Copyright 2019-2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "tuning.hpp"
+#include "handle.hpp"
+#include "autotune.hpp"
+#include "graph.hpp"
+#include "ideal_sizes.hpp"
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+/*
+ * ===========================================================================
+ *    Parameters
+ * ===========================================================================
+ */
+
+static const struct
+{
+    const char *name;
+    rocblas_int value;
+} tuning_params[tuning_num_params] = {
+    {"getrf_blocksize", GETRF_GETF2_SWITCHSIZE},
+    {"getrf_rgetf2_cutoff", GETRF_RGETF2_CUTOFF},
+    {"potrf_blocksize", POTRF_POTF2_SWITCHSIZE},
+    {"geqrf_switchsize", GEQRF_GEQR2_SWITCHSIZE},
+    {"geqrf_blocksize", GEQRF_GEQR2_BLOCKSIZE},
+    {"ormqr_blocksize", ORMQR_ORM2R_BLOCKSIZE},
+    {"ormlq_blocksize", ORMLQ_ORML2_BLOCKSIZE},
+};
+
+rocblas_int rocsolver_tuning_default(const rocsolver_tuning_param param)
+{
+    return tuning_params[param].value;
+}
+
+const char* rocsolver_tuning_param_name(const rocsolver_tuning_param param)
+{
+    return tuning_params[param].name;
+}
+
+bool rocsolver_tuning_param_from_name(const char *name, rocsolver_tuning_param *param)
+{
+    for (int i = 0; i < tuning_num_params; ++i) {
+        if (!strcmp(name, tuning_params[i].name)) {
+            *param = rocsolver_tuning_param(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/*
+ * ===========================================================================
+ *    Tuning tables
+ * ===========================================================================
+ */
+
+// reads a bound of a range ('*' means no bound)
+static bool read_bound(const std::string &s, const rocblas_int unbounded, rocblas_int *bound)
+{
+    if (s == "*") {
+        *bound = unbounded;
+        return true;
+    }
+    char *end;
+    long v = strtol(s.c_str(), &end, 10);
+    if (*end || v < 0 || v > INT_MAX)
+        return false;
+    *bound = rocblas_int(v);
+    return true;
+}
+
+static bool parse_entry(const std::string &line, rocsolver_tuning_entry *entry)
+{
+    std::istringstream in(line);
+    std::string name, prec, smin, smax, bmin, bmax, value, extra;
+    if (!(in >> name >> prec >> smin >> smax >> bmin >> bmax >> value) || (in >> extra))
+        return false;
+
+    if (!rocsolver_tuning_param_from_name(name.c_str(), &entry->param))
+        return false;
+    if (prec.size() != 1 || !strchr("sdcz*", prec[0]))
+        return false;
+    entry->precision = prec[0];
+
+    return read_bound(smin, 0, &entry->size_min) && read_bound(smax, INT_MAX, &entry->size_max)
+           && read_bound(bmin, 0, &entry->batch_min) && read_bound(bmax, INT_MAX, &entry->batch_max)
+           && read_bound(value, 0, &entry->value) && entry->value > 0;
+}
+
+bool rocsolver_tuning_parse(const std::string &text, rocsolver_tuning_table *table)
+{
+    std::vector<rocsolver_tuning_entry> entries;
+    size_t start = 0;
+
+    while (start <= text.size()) {
+        size_t end = text.find_first_of(";\n", start);
+        if (end == std::string::npos)
+            end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+
+        // skip comments and blank lines
+        line = line.substr(0, line.find('#'));
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        rocsolver_tuning_entry entry;
+        if (!parse_entry(line, &entry))
+            return false;
+        entries.push_back(entry);
+    }
+
+    // the table is only modified if all the entries are valid
+    table->entries.insert(table->entries.end(), entries.begin(), entries.end());
+    return true;
+}
+
+static bool load_file(const char *filename, rocsolver_tuning_table *table)
+{
+    std::ifstream file(filename);
+    if (!file)
+        return false;
+    std::stringstream text;
+    text << file.rdbuf();
+    return rocsolver_tuning_parse(text.str(), table);
+}
+
+void rocsolver_tuning_load_environment(rocsolver_tuning_table *table)
+{
+    // (invalid files or entries in the environment are ignored)
+    const char *filename = getenv("ROCSOLVER_TUNING_FILE");
+    if (filename && *filename)
+        load_file(filename, table);
+
+    const char *entries = getenv("ROCSOLVER_TUNING");
+    if (entries && *entries)
+        rocsolver_tuning_parse(entries, table);
+
+    const char *autotune = getenv("ROCSOLVER_AUTOTUNE");
+    if (autotune && *autotune && strcmp(autotune, "0"))
+        rocsolver_tuning_enable_autotune(table);
+}
+
+static const rocsolver_tuning_entry* find_entry(const rocsolver_tuning_table &table, const rocsolver_tuning_param param,
+                                                const char precision, const rocblas_int size, const rocblas_int batch_count)
+{
+    for (auto it = table.entries.rbegin(); it != table.entries.rend(); ++it) {
+        if (it->param == param && (it->precision == '*' || it->precision == precision)
+            && size >= it->size_min && size <= it->size_max
+            && batch_count >= it->batch_min && batch_count <= it->batch_max)
+            return &*it;
+    }
+    return nullptr;
+}
+
+thread_local const rocblas_int *rocsolver_pinned_tuning = nullptr;
+
+// tuning table of the handles without state: the table given by the environment
+// (and the cache file, if autotuning is enabled by the environment), never autotuned
+static const rocsolver_tuning_table& environment_table()
+{
+    static const rocsolver_tuning_table *table = [] {
+        rocsolver_tuning_table *t = new rocsolver_tuning_table;
+        rocsolver_tuning_load_environment(t);
+        t->autotune = false;
+        return t;
+    }();
+    return *table;
+}
+
+rocblas_int rocsolver_get_tuning(rocblas_handle handle, const rocsolver_tuning_param param, const char precision,
+                                 const rocblas_int size, const rocblas_int batch_count)
+{
+    if (rocsolver_pinned_tuning)
+        return rocsolver_pinned_tuning[param];
+
+    const rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    const rocsolver_tuning_table &table = data ? data->tuning : environment_table();
+
+    if (table.overrides[param] > 0)
+        return table.overrides[param];
+
+    const rocsolver_tuning_entry *entry = find_entry(table, param, precision, size, batch_count);
+    return entry ? entry->value : rocsolver_tuning_default(param);
+}
+
+
+/*
+ * ===========================================================================
+ *    Autotuning and cache file
+ * ===========================================================================
+ */
+
+#define TUNING_CACHE_HEADER "rocsolver_tuning_cache 1"
+
+// name of the current device, without blanks
+static std::string device_name()
+{
+    int device;
+    hipDeviceProp_t props;
+    if (hipGetDevice(&device) != hipSuccess || hipGetDeviceProperties(&props, device) != hipSuccess)
+        return "unknown";
+
+    std::string name(props.name);
+    for (char &c : name) {
+        if (c == ' ' || c == '\t')
+            c = '_';
+    }
+    return name.empty() ? "unknown" : name;
+}
+
+// loads the entries of the cache file for the device. Lines have the form
+// "device param precision size_min size_max batch_min batch_max value"
+// (a cache file with another version is ignored, and will be overwritten)
+static void load_cache(rocsolver_tuning_table *table)
+{
+    std::ifstream file(table->cache_file);
+    std::string line;
+    if (!file || !std::getline(file, line) || line != TUNING_CACHE_HEADER)
+        return;
+    table->cache_loaded = true;
+
+    while (std::getline(file, line)) {
+        std::istringstream in(line);
+        std::string device, entry;
+        if (in >> device && device == table->device && std::getline(in, entry))
+            rocsolver_tuning_parse(entry, table);
+    }
+}
+
+void rocsolver_tuning_enable_autotune(rocsolver_tuning_table *table)
+{
+    if (table->autotune)
+        return;
+    table->autotune = true;
+    table->device = device_name();
+
+    const char *cache = getenv("ROCSOLVER_TUNING_CACHE");
+    const char *home = getenv("HOME");
+    if (cache && *cache)
+        table->cache_file = cache;
+    else if (home && *home)
+        table->cache_file = std::string(home) + "/.rocsolver_tuning_cache";
+
+    if (!table->cache_file.empty())
+        load_cache(table);
+}
+
+// power-of-two band that contains x
+static void band(const rocblas_int x, rocblas_int *lo, rocblas_int *hi)
+{
+    *lo = 1;
+    while (*lo <= x / 2)
+        *lo *= 2;
+    *hi = *lo > INT_MAX / 2 ? INT_MAX : 2 * *lo - 1;
+}
+
+bool rocsolver_autotune_wanted(rocblas_handle handle, const rocsolver_tuning_param param, const char precision,
+                               const rocblas_int size, const rocblas_int batch_count)
+{
+    // (no timing runs during size queries, or when the user manages the workspace)
+    const rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return false;
+    const rocsolver_tuning_table &table = data->tuning;
+    if (!table.autotune || data->workspace || rocsolver_is_device_memory_size_query(handle))
+        return false;
+    // (the timing runs synchronize, which is not allowed while the stream is captured into a graph)
+    if (rocsolver_is_capturing(handle))
+        return false;
+    return size > 0 && batch_count > 0 && !table.overrides[param]
+           && !find_entry(table, param, precision, size, batch_count);
+}
+
+void rocsolver_autotune_try(rocblas_handle handle, const rocsolver_tuning_param param, const rocblas_int value)
+{
+    rocsolver_get_handle_data(handle)->tuning.overrides[param] = value;
+}
+
+void rocsolver_autotune_record(rocblas_handle handle, const rocsolver_tuning_param param, const char precision,
+                               const rocblas_int size, const rocblas_int batch_count, const rocblas_int value)
+{
+    rocsolver_tuning_table &table = rocsolver_get_handle_data(handle)->tuning;
+
+    rocsolver_tuning_entry entry;
+    entry.param = param;
+    entry.precision = precision;
+    entry.value = value;
+    band(size, &entry.size_min, &entry.size_max);
+    band(batch_count, &entry.batch_min, &entry.batch_max);
+    table.entries.push_back(entry);
+
+    if (table.cache_file.empty())
+        return;
+
+    // a new cache file (or one with another version) is started from scratch
+    std::ofstream file(table.cache_file, table.cache_loaded ? std::ios::app : std::ios::trunc);
+    if (!file)
+        return;
+    if (!table.cache_loaded) {
+        file << TUNING_CACHE_HEADER << "\n";
+        table.cache_loaded = true;
+    }
+    file << table.device << " " << rocsolver_tuning_param_name(param) << " " << precision << " "
+         << entry.size_min << " " << entry.size_max << " " << entry.batch_min << " " << entry.batch_max << " "
+         << value << "\n";
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_load_tuning_file(rocblas_handle handle, const char *filename)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!filename)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    if (!load_file(filename, &data->tuning))
+        return rocblas_status_invalid_value;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_autotuning(rocblas_handle handle, const rocblas_int enable)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    rocsolver_tuning_table &table = data->tuning;
+    if (enable)
+        rocsolver_tuning_enable_autotune(&table);
+    else
+        table.autotune = false;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_tuning_parameter(rocblas_handle handle, const char *param,
+                                                                const char precision, const rocblas_int size,
+                                                                const rocblas_int batch_count, rocblas_int *value)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!param || !value)
+        return rocblas_status_invalid_pointer;
+    if (size < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!precision || !strchr("sdcz", precision))
+        return rocblas_status_invalid_value;
+
+    // (limits of the library that cannot be tuned)
+    if (!strcmp(param, "getrf_small_maxsize")) {
+        *value = GETRF_SMALL_MAXSIZE;
+        return rocblas_status_success;
+    }
+    if (!strcmp(param, "getf2_panel_ldssize")) {
+        *value = GETF2_PANEL_LDSSIZE;
+        return rocblas_status_success;
+    }
+
+    rocsolver_tuning_param p;
+    if (!rocsolver_tuning_param_from_name(param, &p))
+        return rocblas_status_invalid_value;
+    *value = rocsolver_get_tuning(handle, p, precision, size, batch_count);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_tuning_parameter(rocblas_handle handle, const char *param,
+                                                                const rocblas_int value)
+{
+    if (!handle)
+        return rocblas_status_invalid_handle;
+    if (!param)
+        return rocblas_status_invalid_pointer;
+    if (value < 0)
+        return rocblas_status_invalid_size;
+
+    rocsolver_tuning_param p;
+    if (!rocsolver_tuning_param_from_name(param, &p))
+        return rocblas_status_invalid_value;
+
+    rocsolver_handle_data *data = rocsolver_get_handle_data(handle);
+    if (!data)
+        return rocblas_status_invalid_handle;
+    data->tuning.overrides[p] = value;
+    return rocblas_status_success;
+}
+
+} //extern C